@@ -0,0 +1,23 @@
+#-------------------------------------------------
+#
+# Headless recorder: loads a project, connects to the slave, records and
+# exits. No GUI, runs on servers without a display.
+#
+#-------------------------------------------------
+
+QT       -= gui
+
+CONFIG   += console
+CONFIG   -= app_bundle
+
+TARGET = Qt_Open_XCP_headless
+TEMPLATE = app
+
+include(Qt_Open_XCP_core.pri)
+
+SOURCES += \
+    main/headless.cpp \
+    main/headlessRecorder.cpp
+
+HEADERS += \
+    main/headlessRecorder.h
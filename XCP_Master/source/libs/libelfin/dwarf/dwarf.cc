@@ -100,9 +100,12 @@ dwarf::get_type_unit(uint64_t type_signature) const
                 }
                 m->have_type_units = true;
         }
-        if (!m->type_units.count(type_signature))
+        // find() does not modify the map, the DWARF parser looks up
+        // the loaded type units from several threads
+        auto it = m->type_units.find(type_signature);
+        if (it == m->type_units.end())
                 throw out_of_range("type signature 0x" + to_hex(type_signature));
-        return m->type_units[type_signature];
+        return it->second;
 }
 
 std::shared_ptr<section>
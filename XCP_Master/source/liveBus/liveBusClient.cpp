@@ -0,0 +1,233 @@
+/**
+*@file liveBusClient.cpp
+*@author Michael Wolf
+*@date 19.10.2026
+*@brief Client library of the live bus: reads the values which OpenXCP publishes in POSIX shared memory. The memory is
+* mapped read-only, the client never blocks or slows down OpenXCP. Build with liveBusClient.pro, link with -lrt on Linux.
+*/
+
+#include "liveBusClient.h"
+
+#include <cstring>
+#include <algorithm>
+
+#if defined(__unix__) || defined(__APPLE__)
+#define LIVE_BUS_POSIX
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <cerrno>
+#endif
+
+namespace {
+std::string toString(const char* text, const size_t size) {
+    return std::string(text, strnlen(text, size));
+}
+}
+
+LiveBusClient::LiveBusClient()
+    : memory(nullptr),
+      size(0),
+      header(nullptr),
+      latest(nullptr),
+      ring(nullptr),
+      ringMask(0),
+      readIndex(0),
+      samplesLost(0) {
+
+}
+
+LiveBusClient::~LiveBusClient() {
+    close();
+}
+
+/**
+ * The size of the object is checked against every section before the directory is read.
+ */
+bool LiveBusClient::open(const std::string& name) {
+    close();
+    error.clear();
+#ifdef LIVE_BUS_POSIX
+    int fileDescriptor = shm_open(name.c_str(), O_RDONLY, 0);
+    if(fileDescriptor < 0) {
+        return fail("can not open shared memory " + name + ": " + std::strerror(errno));
+    }
+    struct stat status;
+    if(fstat(fileDescriptor, &status) != 0 || (size_t) status.st_size < sizeof(LiveBusHeader)) {
+        ::close(fileDescriptor);
+        return fail("shared memory " + name + " is not a live bus");
+    }
+    size = (size_t) status.st_size;
+    void* mapped = mmap(nullptr, size, PROT_READ, MAP_SHARED, fileDescriptor, 0);
+    ::close(fileDescriptor); // the mapping stays valid
+    if(mapped == MAP_FAILED) {
+        return fail("can not map shared memory " + name + ": " + std::strerror(errno));
+    }
+    memory = mapped;
+
+    header = static_cast<const LiveBusHeader*>(memory);
+    if(std::memcmp(header->magic, LIVE_BUS::MAGIC, LIVE_BUS::MAGIC_SIZE) != 0) {
+        return fail("shared memory " + name + " is not a live bus or not initialized yet");
+    }
+    std::atomic_thread_fence(std::memory_order_acquire);
+    uint64_t capacity = header->ringCapacity;
+    uint64_t signalCount = header->signalCount;
+    bool isValid = header->version == LIVE_BUS::VERSION && header->size == size && capacity > 0 && (capacity & (capacity - 1)) == 0
+                   && header->directoryOffset + signalCount * sizeof(LiveBusSignal) <= size
+                   && header->latestOffset + signalCount * sizeof(LiveBusValue) <= size
+                   && header->ringOffset + capacity * sizeof(LiveBusSlot) <= size;
+    if(!isValid) {
+        return fail("live bus " + name + " has an unsupported version or is damaged");
+    }
+
+    const uint8_t* base = static_cast<const uint8_t*>(memory);
+    const LiveBusSignal* directory = reinterpret_cast<const LiveBusSignal*>(base + header->directoryOffset);
+    signalTable.reserve(signalCount);
+    for(uint64_t signalId = 0; signalId < signalCount; signalId++) {
+        const LiveBusSignal& entry = directory[signalId];
+        Signal signal;
+        signal.name = toString(entry.name, LIVE_BUS::NAME_SIZE);
+        signal.unit = toString(entry.unit, LIVE_BUS::UNIT_SIZE);
+        signal.conversion = toString(entry.conversion, LIVE_BUS::CONVERSION_SIZE);
+        signal.address = entry.address;
+        signal.lowerLimit = entry.lowerLimit;
+        signal.upperLimit = entry.upperLimit;
+        signal.size = entry.size;
+        signal.isFloat = (entry.flags & LIVE_BUS::SIGNAL_FLAG_FLOAT) != 0;
+        signal.isUnsigned = (entry.flags & LIVE_BUS::SIGNAL_FLAG_UNSIGNED) != 0;
+        signalTable.push_back(signal);
+    }
+    latest = reinterpret_cast<const LiveBusValue*>(base + header->latestOffset);
+    ring = reinterpret_cast<const LiveBusSlot*>(base + header->ringOffset);
+    ringMask = capacity - 1;
+    readIndex = header->writeIndex.load(std::memory_order_acquire);
+    samplesLost = 0;
+    return true;
+#else
+    return fail("the live bus needs POSIX shared memory: " + name);
+#endif
+}
+
+void LiveBusClient::close() {
+#ifdef LIVE_BUS_POSIX
+    if(memory != nullptr) {
+        munmap(const_cast<void*>(memory), size);
+    }
+#endif
+    memory = nullptr;
+    size = 0;
+    header = nullptr;
+    latest = nullptr;
+    ring = nullptr;
+    signalTable.clear();
+    ringMask = 0;
+    readIndex = 0;
+}
+
+bool LiveBusClient::getIsOpen() const {
+    return header != nullptr;
+}
+
+bool LiveBusClient::getIsAlive() const {
+    return header != nullptr && header->isAlive.load(std::memory_order_acquire) != 0;
+}
+
+const std::vector<LiveBusClient::Signal>& LiveBusClient::getSignals() const {
+    return signalTable;
+}
+
+uint32_t LiveBusClient::findSignal(const std::string& name) const {
+    for(uint32_t signalId = 0; signalId < signalTable.size(); signalId++) {
+        if(signalTable[signalId].name == name) {
+            return signalId;
+        }
+    }
+    return INVALID_ID;
+}
+
+int64_t LiveBusClient::getStartTimeMsSinceEpoch() const {
+    return header != nullptr ? header->startTimeMsSinceEpoch : 0;
+}
+
+uint64_t LiveBusClient::getGeneration() const {
+    return header != nullptr ? header->generation : 0;
+}
+
+/**
+ * If the publisher is more than the ring capacity ahead, the oldest samples are skipped. A slot whose sequence is not
+ * the expected one before and after the copy was overwritten meanwhile and is counted as lost.
+ */
+size_t LiveBusClient::read(Sample* samples, const size_t maxCount) {
+    if(header == nullptr) {
+        return 0;
+    }
+    uint64_t writeIndex = header->writeIndex.load(std::memory_order_acquire);
+    uint64_t capacity = ringMask + 1;
+    if(writeIndex - readIndex > capacity) {
+        samplesLost += writeIndex - capacity - readIndex;
+        readIndex = writeIndex - capacity;
+    }
+    size_t count = 0;
+    while(count < maxCount && readIndex < writeIndex) {
+        const LiveBusSlot& slot = ring[readIndex & ringMask];
+        uint64_t expected = readIndex + 1;
+        readIndex++;
+        if(slot.sequence.load(std::memory_order_acquire) != expected) {
+            samplesLost++;
+            continue;
+        }
+        Sample& sample = samples[count];
+        sample.signalId = slot.signalId;
+        sample.time = slot.time;
+        sample.raw = slot.raw;
+        sample.physical = slot.physical;
+        std::atomic_thread_fence(std::memory_order_acquire);
+        if(slot.sequence.load(std::memory_order_relaxed) != expected) {
+            samplesLost++;
+            continue;
+        }
+        count++;
+    }
+    return count;
+}
+
+bool LiveBusClient::readLatest(const uint32_t signalId, Sample& sample) const {
+    if(header == nullptr || signalId >= signalTable.size()) {
+        return false;
+    }
+    static const int MAX_ATTEMPTS = 8;
+    const LiveBusValue& value = latest[signalId];
+    for(int attempt = 0; attempt < MAX_ATTEMPTS; attempt++) {
+        uint64_t sequenceBefore = value.sequence.load(std::memory_order_acquire);
+        if(sequenceBefore == 0) {
+            return false; // no value yet
+        }
+        if(sequenceBefore & 1) {
+            continue;
+        }
+        sample.signalId = signalId;
+        sample.time = value.time;
+        sample.raw = value.raw;
+        sample.physical = value.physical;
+        std::atomic_thread_fence(std::memory_order_acquire);
+        if(value.sequence.load(std::memory_order_relaxed) == sequenceBefore) {
+            return true;
+        }
+    }
+    return false;
+}
+
+uint64_t LiveBusClient::getSamplesLost() const {
+    return samplesLost;
+}
+
+std::string LiveBusClient::getError() const {
+    return error;
+}
+
+bool LiveBusClient::fail(const std::string& error) {
+    close();
+    this->error = error;
+    return false;
+}
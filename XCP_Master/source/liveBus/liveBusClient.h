@@ -0,0 +1,111 @@
+/**
+*@file liveBusClient.h
+*@author Michael Wolf
+*@date 19.10.2026
+*@brief Client library of the live bus: reads the values which OpenXCP publishes in POSIX shared memory. The memory is
+* mapped read-only, the client never blocks or slows down OpenXCP. Build with liveBusClient.pro, link with -lrt on Linux.
+*
+* Usage:
+*   LiveBusClient client;
+*   client.open("/openxcp");
+*   uint32_t speed = client.findSignal("speed");
+*   LiveBusClient::Sample samples[256];
+*   while(client.getIsAlive()) {
+*       size_t count = client.read(samples, 256); // all samples since the last read
+*       client.readLatest(speed, samples[0]); // or the latest value of one signal
+*   }
+*/
+
+#ifndef LIVEBUSCLIENT_H
+#define LIVEBUSCLIENT_H
+
+#include "liveBusFormat.h"
+
+#include <string>
+#include <vector>
+#include <stdint.h>
+#include <stddef.h>
+
+class LiveBusClient {
+  public:
+    static const uint32_t INVALID_ID = 0xFFFFFFFF;
+
+    struct Signal {
+        std::string name;
+        std::string unit;
+        std::string conversion;
+        uint64_t address;
+        double lowerLimit;
+        double upperLimit;
+        uint8_t size;
+        bool isFloat;
+        bool isUnsigned;
+    };
+
+    struct Sample {
+        uint32_t signalId;
+        double time; // in s since getStartTimeMsSinceEpoch()
+        int64_t raw;
+        double physical;
+    };
+
+    LiveBusClient();
+    ~LiveBusClient();
+
+    LiveBusClient(const LiveBusClient&) = delete;
+    LiveBusClient& operator=(const LiveBusClient&) = delete;
+
+    /**
+     * @brief open maps the bus and reads the signal directory. The stream is read from the current position on.
+     * @return false if the bus does not exist or is not valid, see getError().
+     */
+    bool open(const std::string& name = LIVE_BUS::DEFAULT_NAME);
+    void close();
+
+    bool getIsOpen() const;
+
+    /**
+     * @return false if the publisher closed the bus, a new session is read after close() and open().
+     */
+    bool getIsAlive() const;
+
+    const std::vector<Signal>& getSignals() const;
+    uint32_t findSignal(const std::string& name) const; // signal id or INVALID_ID
+    int64_t getStartTimeMsSinceEpoch() const;
+    uint64_t getGeneration() const;
+
+    /**
+     * @brief read copies the samples published since the last read, in the order of publication.
+     * @return number of samples copied, at most maxCount.
+     */
+    size_t read(Sample* samples, const size_t maxCount);
+
+    /**
+     * @brief readLatest copies the latest value of a signal.
+     * @return false if the signal has no value yet or the value could not be read consistently.
+     */
+    bool readLatest(const uint32_t signalId, Sample& sample) const;
+
+    /**
+     * @return samples which the publisher overwrote before they were read, the reader was too slow.
+     */
+    uint64_t getSamplesLost() const;
+
+    std::string getError() const;
+
+  private:
+    bool fail(const std::string& error);
+
+    std::string error;
+    const void* memory;
+    size_t size;
+    const LiveBusHeader* header;
+    const LiveBusValue* latest;
+    const LiveBusSlot* ring;
+    std::vector<Signal> signalTable;
+    uint64_t ringMask;
+    uint64_t readIndex; // next sample to read
+    uint64_t samplesLost;
+};
+
+#endif // LIVEBUSCLIENT_H
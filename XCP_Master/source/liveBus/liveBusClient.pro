@@ -0,0 +1,22 @@
+#-------------------------------------------------
+#
+# Client library of the live bus for external consumers.
+# Only the std and POSIX shared memory, no Qt.
+#
+#-------------------------------------------------
+
+TEMPLATE = lib
+CONFIG += staticlib c++11
+CONFIG -= qt
+QT -= core gui
+
+TARGET = liveBusClient
+
+HEADERS += \
+    liveBusClient.h \
+    liveBusFormat.h
+
+SOURCES += \
+    liveBusClient.cpp
+
+unix:!macx: LIBS += -lrt
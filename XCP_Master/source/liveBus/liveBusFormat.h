@@ -0,0 +1,95 @@
+/**
+*@file liveBusFormat.h
+*@author Michael Wolf
+*@date 19.10.2026
+*@brief Layout of the live bus, a POSIX shared memory object which publishes the decoded values of a session to other
+* processes on the host. Shared by the publisher in OpenXCP and the client library, no dependencies besides the std.
+*
+* Layout, native byte order (the bus is local to the host):
+*   header:     LiveBusHeader
+*   directory:  LiveBusSignal per signal id, describes the signals of the session
+*   latest:     LiveBusValue per signal id, the latest value of every signal
+*   ring:       LiveBusSlot * ringCapacity, the stream of all samples
+*
+* One writer, any number of readers, no locks. Every slot and every latest value carries a sequence number: the reader
+* copies the slot and checks the sequence before and after the copy, a slot which the writer overwrote meanwhile is
+* detected and counted as lost. The readers do not slow down the writer.
+*/
+
+#ifndef LIVEBUSFORMAT_H
+#define LIVEBUSFORMAT_H
+
+#include <atomic>
+#include <stdint.h>
+#include <stddef.h>
+
+namespace LIVE_BUS {
+const char MAGIC[] =                        "OXLIVBUS";
+const uint32_t MAGIC_SIZE =                 8;
+const uint32_t VERSION =                    1;
+const char DEFAULT_NAME[] =                 "/openxcp";
+const uint64_t DEFAULT_RING_CAPACITY =      1 << 16;     /* slots, a power of two */
+
+const uint32_t NAME_SIZE =                  128;         /* including the terminating 0 */
+const uint32_t UNIT_SIZE =                  32;
+const uint32_t CONVERSION_SIZE =            96;
+
+const uint8_t SIGNAL_FLAG_FLOAT =           0x01;
+const uint8_t SIGNAL_FLAG_UNSIGNED =        0x02;
+const uint64_t ALIGNMENT =                  64;          /* of the sections, a cache line */
+}
+
+static_assert(ATOMIC_LLONG_LOCK_FREE == 2, "the live bus needs lock-free 64 bit atomics in shared memory");
+
+struct LiveBusHeader {
+    char magic[LIVE_BUS::MAGIC_SIZE];       // written last, the bus is valid when the magic is set
+    uint32_t version;
+    uint32_t signalCount;
+    uint64_t ringCapacity;
+    uint64_t directoryOffset;
+    uint64_t latestOffset;
+    uint64_t ringOffset;
+    uint64_t size;                          // of the shared memory object
+    int64_t startTimeMsSinceEpoch;          // time 0 of the samples
+    uint64_t generation;                    // changes when the publisher is restarted
+    std::atomic<uint64_t> writeIndex;       // number of samples published
+    std::atomic<uint32_t> isAlive;          // 0 after the publisher closed the bus
+    uint32_t reserved;
+};
+
+struct LiveBusSignal {
+    char name[LIVE_BUS::NAME_SIZE];
+    char unit[LIVE_BUS::UNIT_SIZE];
+    char conversion[LIVE_BUS::CONVERSION_SIZE]; // see ConversionFunction, empty: identity
+    uint64_t address;
+    double lowerLimit;
+    double upperLimit;
+    uint8_t size;
+    uint8_t flags;
+    uint16_t reserved0;
+    uint32_t reserved1;
+};
+
+/**
+ * Latest value of a signal: sequence is odd while the writer updates the value.
+ */
+struct LiveBusValue {
+    std::atomic<uint64_t> sequence;
+    double time;                            // in s since startTimeMsSinceEpoch
+    int64_t raw;                            // sign or zero extended, float signals as their bits
+    double physical;
+};
+
+/**
+ * Sample of the stream: sequence is the sample number + 1 when the slot is complete, 0 while it is written.
+ */
+struct LiveBusSlot {
+    std::atomic<uint64_t> sequence;
+    double time;
+    int64_t raw;
+    double physical;
+    uint32_t signalId;
+    uint32_t reserved;
+};
+
+#endif // LIVEBUSFORMAT_H
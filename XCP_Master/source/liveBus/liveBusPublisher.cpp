@@ -0,0 +1,196 @@
+/**
+*@file liveBusPublisher.cpp
+*@author Michael Wolf
+*@date 19.10.2026
+*@brief Publishes the decoded values of a session on the live bus, a POSIX shared memory object which other processes
+* read with the LiveBusClient. The publisher never waits for a reader, slow readers lose samples.
+*/
+
+#include "liveBusPublisher.h"
+
+#include <cstring>
+#include <chrono>
+#include <algorithm>
+
+#if defined(__unix__) || defined(__APPLE__)
+#define LIVE_BUS_POSIX
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <cerrno>
+#endif
+
+namespace {
+uint64_t alignUp(const uint64_t value) {
+    return (value + LIVE_BUS::ALIGNMENT - 1) & ~(LIVE_BUS::ALIGNMENT - 1);
+}
+
+void copyText(char* destination, const std::string& text, const size_t size) {
+    size_t length = std::min(text.size(), size - 1);
+    std::memcpy(destination, text.data(), length);
+    destination[length] = '\0';
+}
+}
+
+LiveBusPublisher::LiveBusPublisher()
+    : fileDescriptor(-1),
+      memory(nullptr),
+      size(0),
+      header(nullptr),
+      latest(nullptr),
+      ring(nullptr),
+      signalCount(0),
+      ringMask(0),
+      writeIndex(0) {
+
+}
+
+LiveBusPublisher::~LiveBusPublisher() {
+    close();
+}
+
+/**
+ * The object is filled completely before the magic is written, a reader which sees the magic sees a valid bus.
+ */
+bool LiveBusPublisher::open(const std::string& name, const std::vector<RecordSignal>& signalTable, const int64_t startTimeMsSinceEpoch,
+                            const uint64_t ringCapacity) {
+    close();
+    error.clear();
+    this->name = name;
+#ifdef LIVE_BUS_POSIX
+    uint64_t capacity = 1;
+    while(capacity < ringCapacity) {
+        capacity <<= 1;
+    }
+    uint64_t directoryOffset = alignUp(sizeof(LiveBusHeader));
+    uint64_t latestOffset = alignUp(directoryOffset + signalTable.size() * sizeof(LiveBusSignal));
+    uint64_t ringOffset = alignUp(latestOffset + signalTable.size() * sizeof(LiveBusValue));
+    size = (size_t) (ringOffset + capacity * sizeof(LiveBusSlot));
+
+    shm_unlink(name.c_str()); // readers of a previous session keep their mapping
+    fileDescriptor = shm_open(name.c_str(), O_CREAT | O_EXCL | O_RDWR, S_IRUSR | S_IWUSR | S_IRGRP | S_IROTH);
+    if(fileDescriptor < 0) {
+        return fail("can not create shared memory " + name + ": " + std::strerror(errno));
+    }
+    if(ftruncate(fileDescriptor, (off_t) size) != 0) {
+        return fail("can not resize shared memory " + name + ": " + std::strerror(errno));
+    }
+    memory = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, fileDescriptor, 0);
+    if(memory == MAP_FAILED) {
+        memory = nullptr;
+        return fail("can not map shared memory " + name + ": " + std::strerror(errno));
+    }
+
+    uint8_t* base = static_cast<uint8_t*>(memory); // zero filled by ftruncate
+    header = reinterpret_cast<LiveBusHeader*>(base);
+    header->version = LIVE_BUS::VERSION;
+    header->signalCount = (uint32_t) signalTable.size();
+    header->ringCapacity = capacity;
+    header->directoryOffset = directoryOffset;
+    header->latestOffset = latestOffset;
+    header->ringOffset = ringOffset;
+    header->size = size;
+    header->startTimeMsSinceEpoch = startTimeMsSinceEpoch;
+    header->generation = (uint64_t) std::chrono::system_clock::now().time_since_epoch().count();
+    header->writeIndex.store(0, std::memory_order_relaxed);
+    header->isAlive.store(1, std::memory_order_relaxed);
+
+    LiveBusSignal* directory = reinterpret_cast<LiveBusSignal*>(base + directoryOffset);
+    for(size_t signalId = 0; signalId < signalTable.size(); signalId++) {
+        const RecordSignal& signal = signalTable[signalId];
+        LiveBusSignal& entry = directory[signalId];
+        copyText(entry.name, signal.name, LIVE_BUS::NAME_SIZE);
+        copyText(entry.unit, signal.unit, LIVE_BUS::UNIT_SIZE);
+        copyText(entry.conversion, signal.conversion, LIVE_BUS::CONVERSION_SIZE);
+        entry.address = signal.address;
+        entry.lowerLimit = signal.lowerLimit;
+        entry.upperLimit = signal.upperLimit;
+        entry.size = signal.size;
+        entry.flags = (signal.isFloat ? LIVE_BUS::SIGNAL_FLAG_FLOAT : 0) | (signal.isUnsigned ? LIVE_BUS::SIGNAL_FLAG_UNSIGNED : 0);
+    }
+    latest = reinterpret_cast<LiveBusValue*>(base + latestOffset);
+    ring = reinterpret_cast<LiveBusSlot*>(base + ringOffset);
+    signalCount = (uint32_t) signalTable.size();
+    ringMask = capacity - 1;
+    writeIndex = 0;
+
+    std::atomic_thread_fence(std::memory_order_release);
+    std::memcpy(header->magic, LIVE_BUS::MAGIC, LIVE_BUS::MAGIC_SIZE);
+    return true;
+#else
+    (void) signalTable;
+    (void) startTimeMsSinceEpoch;
+    (void) ringCapacity;
+    return fail("the live bus needs POSIX shared memory");
+#endif
+}
+
+void LiveBusPublisher::close() {
+#ifdef LIVE_BUS_POSIX
+    if(header != nullptr) {
+        header->isAlive.store(0, std::memory_order_release);
+    }
+    if(memory != nullptr) {
+        munmap(memory, size);
+    }
+    if(fileDescriptor >= 0) {
+        ::close(fileDescriptor);
+        shm_unlink(name.c_str());
+    }
+#endif
+    fileDescriptor = -1;
+    memory = nullptr;
+    size = 0;
+    header = nullptr;
+    latest = nullptr;
+    ring = nullptr;
+    signalCount = 0;
+}
+
+/**
+ * Stream slot: the sequence is cleared before and set to the sample number + 1 after the slot is written.
+ * Latest value: the sequence is odd while the value is written.
+ */
+void LiveBusPublisher::publish(const uint32_t signalId, const double time, const int64_t raw, const double physical) {
+    if(header == nullptr || signalId >= signalCount) {
+        return;
+    }
+    LiveBusSlot& slot = ring[writeIndex & ringMask];
+    slot.sequence.store(0, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+    slot.time = time;
+    slot.raw = raw;
+    slot.physical = physical;
+    slot.signalId = signalId;
+    slot.sequence.store(writeIndex + 1, std::memory_order_release);
+    writeIndex++;
+    header->writeIndex.store(writeIndex, std::memory_order_release);
+
+    LiveBusValue& value = latest[signalId];
+    uint64_t sequence = value.sequence.load(std::memory_order_relaxed);
+    value.sequence.store(sequence + 1, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+    value.time = time;
+    value.raw = raw;
+    value.physical = physical;
+    value.sequence.store(sequence + 2, std::memory_order_release);
+}
+
+bool LiveBusPublisher::getIsOpen() const {
+    return header != nullptr;
+}
+
+std::string LiveBusPublisher::getName() const {
+    return name;
+}
+
+std::string LiveBusPublisher::getError() const {
+    return error;
+}
+
+bool LiveBusPublisher::fail(const std::string& error) {
+    this->error = error;
+    close();
+    return false;
+}
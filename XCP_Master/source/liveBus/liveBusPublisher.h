@@ -0,0 +1,69 @@
+/**
+*@file liveBusPublisher.h
+*@author Michael Wolf
+*@date 19.10.2026
+*@brief Publishes the decoded values of a session on the live bus, a POSIX shared memory object which other processes
+* read with the LiveBusClient. The publisher never waits for a reader, slow readers lose samples.
+*/
+
+#ifndef LIVEBUSPUBLISHER_H
+#define LIVEBUSPUBLISHER_H
+
+#include "liveBusFormat.h"
+#include "record/recordFileFormat.h"
+
+#include <string>
+#include <vector>
+#include <stdint.h>
+#include <stddef.h>
+
+class LiveBusPublisher {
+  public:
+    LiveBusPublisher();
+    ~LiveBusPublisher();
+
+    LiveBusPublisher(const LiveBusPublisher&) = delete;
+    LiveBusPublisher& operator=(const LiveBusPublisher&) = delete;
+
+    /**
+     * @brief open creates the shared memory object, an existing object with the same name is replaced.
+     * @param name POSIX shared memory name, e.g. "/openxcp".
+     * @param signalTable the signal id is the index in the table.
+     * @param ringCapacity samples in the stream, rounded up to a power of two.
+     * @return false if the object can not be created or the platform has no POSIX shared memory, see getError().
+     */
+    bool open(const std::string& name, const std::vector<RecordSignal>& signalTable, const int64_t startTimeMsSinceEpoch,
+              const uint64_t ringCapacity = LIVE_BUS::DEFAULT_RING_CAPACITY);
+
+    /**
+     * @brief close marks the bus as closed for the readers and removes the name.
+     */
+    void close();
+
+    /**
+     * @brief publish writes a sample to the stream and updates the latest value of the signal. Single writer, O(1), no system call.
+     * @param time in s since the start time of open().
+     */
+    void publish(const uint32_t signalId, const double time, const int64_t raw, const double physical);
+
+    bool getIsOpen() const;
+    std::string getName() const;
+    std::string getError() const;
+
+  private:
+    bool fail(const std::string& error);
+
+    std::string name;
+    std::string error;
+    int fileDescriptor;
+    void* memory;
+    size_t size;
+    LiveBusHeader* header;
+    LiveBusValue* latest;
+    LiveBusSlot* ring;
+    uint32_t signalCount;
+    uint64_t ringMask;
+    uint64_t writeIndex; // copy of the header's write index, only the publisher writes it
+};
+
+#endif // LIVEBUSPUBLISHER_H
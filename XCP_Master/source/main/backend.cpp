@@ -11,10 +11,10 @@
 #include "serialize/serializeA2l.h"
 #include "xcp/xcptask.h"
 #include "record/recordElement.h"
-#include "record/record.h"
 
 #include <memory>
 #include <string>
+#include <map>
 #include <QString>
 #include <QCryptographicHash>
 
@@ -32,9 +32,13 @@ Backend::Backend(QObject *parent)
     : QObject(parent),
       model(QSharedPointer<Model>::create()),
       xcpTask(model),
-      xcpState(XcpTask::State::Disconnected) {
+      xcpState(XcpTask::State::Disconnected),
+      recordWriter(new RecordWriter()),
+      sampleStore(std::make_shared<SampleStore>()) {
 
     recordStartTimestamp = 0;
+    connectTimestamp = 0;
+    createTimerExportProgress();
 
     //Signal backend to slot xcpTask
     QObject::connect(this, SIGNAL(sigConnectToClient()), &xcpTask, SLOT(slotConnect()));
@@ -42,9 +46,11 @@ Backend::Backend(QObject *parent)
     QObject::connect(this, SIGNAL(sigRecordStart()), &xcpTask, SLOT(slotRecordStart()));
     QObject::connect(this, SIGNAL(sigRecordStop()), &xcpTask, SLOT(slotRecordStop()));
     QObject::connect(this, SIGNAL(sigCalibration(int)), &xcpTask, SLOT(slotCalibration(int)));
+    QObject::connect(this, SIGNAL(sigVerifyChecksum()), &xcpTask, SLOT(slotVerifyChecksum()));
+    QObject::connect(this, SIGNAL(sigCalibrationDataset()), &xcpTask, SLOT(slotCalibrationDataset()));
 
     //Signal xcpTask to slot backend
-    QObject::connect(&xcpTask, SIGNAL(sigVariableValueUpdate(uint64_t, int64_t)), this, SLOT(slotVariableValueUpdate(uint64_t, int64_t)));
+    QObject::connect(&xcpTask, SIGNAL(sigVariableValueUpdate(uint32_t, int64_t)), this, SLOT(slotVariableValueUpdate(uint32_t, int64_t)));
     QObject::connect(&xcpTask, SIGNAL(sigStateChange(XcpTask::State)), this, SLOT(slotStateChangeXcpTask(XcpTask::State)));
     QObject::connect(&xcpTask, SIGNAL(sigPrintMessage(QString, bool)), this, SLOT(slotPrintMessage(QString, bool)));
 }
@@ -65,9 +71,16 @@ void Backend::parse() {
 
     QObject::connect(parserManager.get(), SIGNAL(sigParseProgress(int)), this, SLOT(slotParseProgress(int)));
 
-    parserManager->parse();
+    QByteArray elfFileHash = fileChecksum(elfFilePath);
+    string cacheFilePathName = ParseCache::getFilePathName(model->getFilesProjectFile().toStdString());
+    if(parserManager->loadCache(cacheFilePathName, elfFileHash.toStdString())) {
+        emit sigPrintMessage("ELF file unchanged, parse results loaded from cache.", false);
+    } else {
+        parserManager->parse();
+        parserManager->saveCache(cacheFilePathName, elfFileHash.toStdString());
+    }
 
-    model->setHashElfFile(fileChecksum(elfFilePath));
+    model->setHashElfFile(elfFileHash);
 
     updateModelWithParseResults(parserManager);
 
@@ -88,6 +101,8 @@ void Backend::loadProject() {
     bool isElfFileModified = hasFileBeenModified(model->getFilesElfFile(), model->getHashElfFile());
     if(isElfFileModified) {
         model->removeAllFromParseResults();
+    } else {
+        loadParseResultsFromCache();
     }
     for(const auto& parseResult : model->getParseResults()) {
         if(parseResult->getIsSelectedByUser()) {
@@ -132,6 +147,36 @@ XcpTask::State Backend::getXcpState() const {
     return xcpState;
 }
 
+bool Backend::getIsRecording() const {
+    return recordWriter->getIsRunning();
+}
+
+bool Backend::getIsExportRunning() const {
+    return timerExportProgress->isActive();
+}
+
+CsvExporter::State Backend::getExportState() const {
+    return csvExporter.getState();
+}
+
+std::shared_ptr<SampleStore> Backend::getSampleStore() const {
+    return sampleStore;
+}
+
+/**
+ * Runs in the thread of slotVariableValueUpdate(), so the statistics keep a single writer. The rows of the signals whose
+ * last window changed are updated like after a sample.
+ */
+void Backend::ageStatistics() {
+    static const double SECOND = 1000.0;
+    double secondsSinceConnect = (double) (QDateTime::currentMSecsSinceEpoch() - connectTimestamp) / SECOND;
+    std::vector<uint32_t> signalIds;
+    model->getSignalStatistics()->advance(secondsSinceConnect, signalIds);
+    for(uint32_t signalId : signalIds) {
+        emit sigUpdateRecordMeasurement(signalId);
+    }
+}
+
 QByteArray Backend::fileChecksum(const QString& fileName) {
     QFile f(fileName);
     if (f.open(QFile::ReadOnly)) {
@@ -160,6 +205,34 @@ void Backend::updateModelWithParseResults(const std::unique_ptr<ParserManager>&
     }
 }
 
+/**
+ * The project file holds only the selected parse results. The cache of the unchanged ELF file holds all of them,
+ * the selection of the project is applied to the results of the cache.
+ */
+bool Backend::loadParseResultsFromCache() {
+    std::unique_ptr<ParserManager> parserManager(new ParserManager(model->getFilesElfFile().toStdString(), model->getFilesSourcePath().toStdString()));
+    string cacheFilePathName = ParseCache::getFilePathName(model->getFilesProjectFile().toStdString());
+    if(!parserManager->loadCache(cacheFilePathName, model->getHashElfFile().toStdString())) {
+        return false;
+    }
+    QVector<shared_ptr<ParseResultBase>> selectedParseResults = model->getParseResults();
+    updateModelWithParseResults(parserManager);
+
+    std::map<std::pair<string, uint64_t>, shared_ptr<ParseResultBase>> parseResultsByNameAndAddress;
+    for(const auto& parseResult : model->getParseResults()) {
+        parseResultsByNameAndAddress[std::make_pair(parseResult->getName(), parseResult->getAddress())] = parseResult;
+    }
+    for(const auto& selected : selectedParseResults) {
+        auto found = parseResultsByNameAndAddress.find(std::make_pair(selected->getName(), selected->getAddress()));
+        if(found != parseResultsByNameAndAddress.end()) {
+            found->second->setIsSelectedByUser(true);
+        } else {
+            model->addToParseResults(selected);
+        }
+    }
+    return true;
+}
+
 void Backend::addToRecordElementsInModel(const shared_ptr<ParseResultBase> parseResult) {
     if(parseResult->getAbstractDataType().compare("array") == 0) {
         shared_ptr<ParseResultArray> array = std::dynamic_pointer_cast<ParseResultArray>(parseResult);
@@ -192,104 +265,113 @@ void Backend::removeFromRecordElementsInModel(const shared_ptr<ParseResultBase>
     }
 }
 
-bool Backend::isDataTypeUnSigned(const string& dataType) {
-    return (dataType.find("unsigned") != std::string::npos);
-}
-
 
 /***************************************************************
 *  Save Record
 ****************************************************************/
-void Backend::saveRecord(const QString& path) {
-    QStringList header;
-    QtCSV::StringData data;
-
-    writeRecordHeader(header, data);
-
-    QMap<uint64_t, int> idSignalPositionMap;
-    writeRecordSignalNames(idSignalPositionMap, data);
-
-    if(!recordList.isEmpty()) {
-        double lastRelativeTime = recordList.at(0).getRelativeTime();
-        QStringList row;
-        QMap<int, Record> recordsWithEqualTimestamp;
-        for(auto& record: recordList) {
-            double currentRelativeTime = record.getRelativeTime();
-
-            static const double EPSILON_ONE_MS = 0.001;
-            if((currentRelativeTime - lastRelativeTime) <= EPSILON_ONE_MS) {
-                addRecordEntryToRecordsWithEqualTimestamp(record, recordsWithEqualTimestamp, idSignalPositionMap);
-            } else {
-                row << QString::number(lastRelativeTime, 'f'); //time
-                int posOfRecord;
-                int posInRow = 1;
-                for(const auto& record : recordsWithEqualTimestamp.values()) {
-                    posOfRecord = record.getPosition();
-                    for(posInRow; posInRow < posOfRecord; posInRow++) {
-                        row << " "; //leading blanks
-                    }
-                    row << QString::number(record.getValue()); //value
-                    posInRow++; //for next loop
-                }
-                for(int i = posOfRecord; i <= idSignalPositionMap.last(); i++) {
-                    row << " "; //trailing blanks
-                }
-                data.addRow(row);
-
-                //reset
-                row.clear();
-                lastRelativeTime = currentRelativeTime;
-                recordsWithEqualTimestamp.clear();
-
-                //new time (first entry)
-                addRecordEntryToRecordsWithEqualTimestamp(record, recordsWithEqualTimestamp, idSignalPositionMap);
-            }
-
+/**
+ * The signal table of the recording file, the selected signals of the registry (sorted by address). The signal id is the index in the table.
+ */
+std::vector<RecordSignal> Backend::createRecordSignalTable() {
+    const shared_ptr<SignalRegistry> signalRegistry = model->getSignalRegistry();
+    std::vector<RecordSignal> signalTable;
+    recordSignalIds.assign(signalRegistry->getSize(), SignalRegistry::INVALID_ID);
+    for(uint32_t signalId = 0; signalId < signalRegistry->getSize(); signalId++) {
+        const SignalInfo& signalInfo = signalRegistry->getSignal(signalId);
+        if(!signalInfo.recordElement->getIsSelected()) {
+            continue;
         }
+        recordSignalIds[signalId] = (uint32_t) signalTable.size();
+        signalTable.push_back(createRecordSignal(signalInfo));
     }
-
-    writeRecordCsvFile(path, data, header);
+    return signalTable;
 }
 
-void Backend::writeRecordHeader(QStringList& header, QtCSV::StringData& data) {
-    header << "date" << "time";
-    QString date = QDateTime::currentDateTime().toString("dd.MM.yyyy");
-    QString time = QDateTime::currentDateTime().toString("hh:mm:ss");
-    QStringList dateTime;
-    dateTime << date << time;
-    data.addRow(dateTime);
-    data.addEmptyRow();
+RecordSignal Backend::createRecordSignal(const SignalInfo& signalInfo) {
+    shared_ptr<RecordElement> recordElement = signalInfo.recordElement;
+    shared_ptr<ParseResultBase> parseResult = recordElement->getParseResult();
+    RecordSignal signal;
+    signal.name = parseResult->getName();
+    SourceParserObj* srcParserObj = parseResult->getSrcParserObj();
+    if(srcParserObj != nullptr) {
+        signal.unit = srcParserObj->getPhyUnit();
+        signal.comment = srcParserObj->getComment();
+        signal.lowerLimit = srcParserObj->getLowerLimit();
+        signal.upperLimit = srcParserObj->getUpperLimit();
+    }
+    if(signalInfo.conversion.getError().empty()) {
+        signal.conversion = signalInfo.conversion.getText();
+    }
+    signal.address = signalInfo.address;
+    signal.size = signalInfo.size;
+    signal.isFloat = signalInfo.isFloat;
+    signal.isUnsigned = signalInfo.isUnsigned;
+    switch (recordElement->getTriggerMode()) {
+    case RecordElement::TriggerMode::Event:
+        signal.group = recordElement->getEvent().getChannel() + 1;
+        break;
+    case RecordElement::TriggerMode::Stimulation:
+        signal.group = RECORD_FILE::GROUP_STIM | (recordElement->getEvent().getChannel() + 1);
+        break;
+    default:
+        signal.group = RECORD_FILE::GROUP_POLLING;
+        break;
+    }
+    return signal;
 }
 
-void Backend::writeRecordSignalNames(QMap<uint64_t, int>& idSignalPositionMap, QtCSV::StringData& data) {
-    QMap<uint64_t, shared_ptr<RecordElement>> recordElementSorted;
-    for(const auto& recordElement: model->getRecordElements()) {
-        if(recordElement->getIsSelected()) {
-            recordElementSorted.insert(recordElement->getParseResult()->getAddress(), recordElement);
-        }
+/**
+ * All signals of the registry, the signal id is the id of the registry. Used by the live bus and the live sample store.
+ */
+std::vector<RecordSignal> Backend::createLiveSignalTable() {
+    const shared_ptr<SignalRegistry> signalRegistry = model->getSignalRegistry();
+    std::vector<RecordSignal> signalTable;
+    signalTable.reserve(signalRegistry->getSize());
+    for(uint32_t signalId = 0; signalId < signalRegistry->getSize(); signalId++) {
+        signalTable.push_back(createRecordSignal(signalRegistry->getSignal(signalId)));
     }
+    return signalTable;
+}
 
-    int position = 1;
-    QStringList signalNames;
-    signalNames << "t[s]";
-    for(const auto& recordElement : recordElementSorted.values()) {
-        idSignalPositionMap.insert(recordElement->getParseResult()->getAddress(), position++);
-        signalNames << QString::fromStdString(recordElement->getParseResult()->getName()) + "[" +QString::fromStdString(recordElement->getParseResult()->getSrcParserObj()->getPhyUnit()) + "]";
+/***************************************************************
+*  Live bus
+****************************************************************/
+/**
+ * The directory of the live bus holds all signals of the registry, the signal id of the bus is the id of the registry.
+ */
+void Backend::openLiveBus() {
+    std::vector<RecordSignal> signalTable = createLiveSignalTable();
+    QString name = model->getLiveBusName();
+    if(!liveBusPublisher.open(name.toStdString(), signalTable, connectTimestamp)) {
+        emit sigPrintMessage("Live bus " + QString::fromStdString(liveBusPublisher.getError()), true);
+        return;
     }
-    data.addRow(signalNames);
+    emit sigPrintMessage("Live bus published: " + name, false);
 }
 
-void Backend::addRecordEntryToRecordsWithEqualTimestamp(Record &record, QMap<int, Record> &recordsWithEqualTimestamp, const QMap<uint64_t, int> &idSignalPositionMap) {
-    int position = idSignalPositionMap.find(record.getId()).value();
-    record.setPosition(position);
-    recordsWithEqualTimestamp.insert(position, record);
+void Backend::closeLiveBus() {
+    liveBusPublisher.close();
 }
 
-void Backend::writeRecordCsvFile(const QString& path, const QtCSV::StringData& data, const QStringList& header) {
-    static const QString seperator = ";", textDelimeter = "";
-    QString filename = QDateTime::currentDateTime().toString("'Record_'yyyy-MM-dd_hh-mm-ss'.csv'");
-    QString filePath = path + "/" + filename;
-    QtCSV::Writer::write(filePath, data, seperator, textDelimeter, QtCSV::Writer::REWRITE, header);
+/**
+ * Starts the CSV export of the recording file in the background, the progress is polled by timerExportProgress.
+ * The file is read window by window, so the export of a long recording does not need the samples in memory.
+ * The rows are the samples grouped by millisecond or the signals resampled on the time base selected in the files tab.
+ */
+void Backend::saveRecord(const QString& path) {
+    if(csvExporter.getState() == CsvExporter::State::Running) {
+        emit sigPrintMessage("The previous CSV export is still running, the record is not exported.", true);
+        return;
+    }
+    QDateTime now = QDateTime::currentDateTime();
+    QString filePath = path + "/" + now.toString("'Record_'yyyy-MM-dd_hh-mm-ss'.csv'");
+    QString preamble = "date;time\n" + now.toString("dd.MM.yyyy") + ";" + now.toString("hh:mm:ss") + "\n\n";
+    if(!csvExporter.startFromRecordFile(recordFilePath.toStdString(), filePath.toStdString(), preamble.toStdString(), model->getCsvResampleSettings())) {
+        emit sigPrintMessage("Can not export " + recordFilePath + " to the CSV file " + filePath, true);
+        return;
+    }
+    emit sigExportProgress(0);
+    timerExportProgress->start();
 }
 
 /***************************************************************
@@ -299,23 +381,146 @@ void Backend::slotParseProgress(int percent) {
     emit sigParseProgress(percent);
 }
 
+void Backend::slotExportProgress() {
+    CsvExporter::State state = csvExporter.getState();
+    if(state == CsvExporter::State::Running) {
+        emit sigExportProgress(csvExporter.getProgress());
+        return;
+    }
+    timerExportProgress->stop();
+    csvExporter.wait();
+    QString filePath = QString::fromStdString(csvExporter.getPath());
+    if(state == CsvExporter::State::Finished) {
+        emit sigPrintMessage("CSV export finished: " + filePath, false);
+    } else if(state == CsvExporter::State::Cancelled) {
+        emit sigPrintMessage("CSV export cancelled.", false);
+    } else {
+        emit sigPrintMessage("CSV export failed, can not write " + filePath, true);
+    }
+    emit sigExportProgress(100);
+}
+
+void Backend::slotExportCancel() {
+    csvExporter.cancel();
+}
+
 void Backend::slotConnectToClient() {
+    model->getSignalRegistry()->build(model->getRecordElements()); // before the polling and DAQ lists are created
+    model->getSignalStatistics()->init(model->getSignalRegistry()->getSize());
+    const shared_ptr<SignalRegistry> signalRegistry = model->getSignalRegistry();
+    for(uint32_t signalId = 0; signalId < signalRegistry->getSize(); signalId++) {
+        const SignalInfo& signalInfo = signalRegistry->getSignal(signalId);
+        if(!signalInfo.conversion.getError().empty()) {
+            emit sigPrintMessage("Conversion of " + QString::fromStdString(signalInfo.recordElement->getParseResult()->getName()) + ": "
+                                 + QString::fromStdString(signalInfo.conversion.getError()) + ", raw values are used.", true);
+        }
+    }
+    static const size_t SAMPLE_STORE_MEMORY_LIMIT = 256 * 1024 * 1024; // older samples are dropped, a recording keeps all of them
+    connectTimestamp = QDateTime::currentMSecsSinceEpoch();
+    sampleStore = std::make_shared<SampleStore>(); // the live plot resets on a new store
+    sampleStore->init(createLiveSignalTable(), SAMPLE_STORE_MEMORY_LIMIT);
+    if(model->getIsLiveBusEnabled()) {
+        openLiveBus();
+    }
     emit sigConnectToClient();
 }
 
 void Backend::slotDisconnectClient() {
     emit sigDisconnectClient();
+    closeLiveBus();
 }
 
 void Backend::slotRecordStart() {
-    recordList.clear();
     recordStartTimestamp = QDateTime::currentMSecsSinceEpoch();
+    QString filename;
+    switch (model->getRecordFormatSelected()) {
+    case Model::RECORD_FORMAT::MDF4:
+        recordWriter.reset(new Mdf4Writer(false));
+        filename = QDateTime::currentDateTime().toString("'Record_'yyyy-MM-dd_hh-mm-ss'.mf4'");
+        break;
+    case Model::RECORD_FORMAT::MDF4_COMPRESSED:
+        recordWriter.reset(new Mdf4Writer(true));
+        filename = QDateTime::currentDateTime().toString("'Record_'yyyy-MM-dd_hh-mm-ss'.mf4'");
+        break;
+    default:
+        recordWriter.reset(new RecordWriter());
+        filename = QDateTime::currentDateTime().toString("'Record_'yyyy-MM-dd_hh-mm-ss'.oxr'");
+        break;
+    }
+    recordFilePath = model->getFilesRecordPath() + "/" + filename;
+    std::vector<RecordSignal> signalTable = createRecordSignalTable();
+    if(!recordWriter->start(recordFilePath.toStdString(), signalTable, recordStartTimestamp)) {
+        emit sigPrintMessage("Can not create record file " + recordFilePath, true);
+        recordWriter.reset(new RecordWriter()); // not running, the DAQ lists are not started
+        return;
+    }
+    if(model->getIsRecordTriggerEnabled()) {
+        startRecordTrigger(signalTable);
+    }
     emit sigRecordStart();
 }
 
+/**
+ * If a condition is invalid, the recording is not triggered but records all samples, so no data is lost.
+ * The pre-trigger ring is sized from the polling rate or the event rate of every recorded signal.
+ */
+void Backend::startRecordTrigger(const std::vector<RecordSignal>& signalTable) {
+    static const double MS_PER_SECOND = 1000.0;
+    const shared_ptr<SignalRegistry> signalRegistry = model->getSignalRegistry();
+    std::vector<double> sampleRates(signalTable.size(), 0.0);
+    for(uint32_t signalId = 0; signalId < recordSignalIds.size(); signalId++) {
+        if(recordSignalIds[signalId] == SignalRegistry::INVALID_ID) {
+            continue;
+        }
+        shared_ptr<RecordElement> recordElement = signalRegistry->getSignal(signalId).recordElement;
+        int rateInMs = (recordElement->getTriggerMode() == RecordElement::TriggerMode::Polling) ?
+                       recordElement->getPollingRateInMs() : recordElement->getEvent().getRateInMs();
+        if(rateInMs > 0) { // 0: non cyclic event, rate unknown
+            sampleRates[recordSignalIds[signalId]] = MS_PER_SECOND / rateInMs;
+        }
+    }
+
+    TriggerRecorder::Sink sink;
+    sink.append = [this](const RecordSample& sample) {
+        persistSample(sample.time, sample.signalId, sample.value);
+    };
+    sink.flush = [this](const std::vector<RecordSample>& samples) {
+        recordWriter->appendBlocking(samples); // the pre-trigger window must not be dropped
+    };
+    triggerRecorder.reset(new TriggerRecorder());
+    if(!triggerRecorder->start(model->getRecordTriggerSettings(), signalTable, sampleRates, sink)) {
+        emit sigPrintMessage("Record trigger " + QString::fromStdString(triggerRecorder->getError()) + ", recording all samples.", true);
+        triggerRecorder.reset();
+        return;
+    }
+    emit sigPrintMessage("Record trigger armed: " + QString::fromStdString(model->getRecordTriggerSettings().startExpression)
+                         + ", pre-trigger buffer " + QString::number(triggerRecorder->getRingDepth()) + " samples", false);
+}
+
+void Backend::persistSample(const double time, const uint32_t signalId, const int64_t value) {
+    recordWriter->append(time, signalId, value);
+}
+
 void Backend::slotRecordStop() {
     emit sigRecordStop();
-    saveRecord(model->getFilesRecordPath());
+    recordSignalIds.clear();
+    if(triggerRecorder) {
+        emit sigPrintMessage("Record trigger: " + QString::number(triggerRecorder->getTriggerCount()) + " trigger(s) recorded.", false);
+        triggerRecorder.reset();
+    }
+    if(!recordWriter->getIsRunning()) {
+        return;
+    }
+    if(!recordWriter->stop()) {
+        emit sigPrintMessage("Write error, the record file " + recordFilePath + " is incomplete.", true);
+        return;
+    }
+    if(recordWriter->getSamplesDropped() > 0) {
+        emit sigPrintMessage(QString::number(recordWriter->getSamplesDropped()) + " samples dropped, the disk did not keep up with the measurement.", true);
+    }
+    if(model->getRecordFormatSelected() == Model::RECORD_FORMAT::NATIVE) {
+        saveRecord(model->getFilesRecordPath()); // MDF4 is read by the measurement tools directly
+    }
 }
 
 void Backend::slotParseResultSelectedByUser(int parseResultIndex, bool isSelected) {
@@ -332,41 +537,69 @@ void Backend::slotCalibration(int recordElementsIndex) {
     emit sigCalibration(recordElementsIndex);
 }
 
+void Backend::slotVerifyChecksum() {
+    emit sigVerifyChecksum();
+}
+
+void Backend::slotCalibrationDataset() {
+    emit sigCalibrationDataset();
+}
+
 void Backend::slotPrintMessage(QString msg, bool isError) {
     emit sigPrintMessage(msg, isError);
 }
 
-void Backend::slotVariableValueUpdate(uint64_t id, int64_t value) {
-
-    for(auto& recordElement : model->getRecordElements()) {
-        uint64_t addr = recordElement->getParseResult()->getAddress();
-        if(id == addr) {
-            if(isDataTypeUnSigned(recordElement->getParseResult()->getDataType())) { //convert to signed/unisgned
-                value = (uint32_t) value; //unsigned
-            } else {
-                value = (int32_t) value; //signed
-            }
-            recordElement->setLatestValueIntAddHistory(value);
-            qint64 currentTime = QDateTime::currentMSecsSinceEpoch();
-            qint64 timeDiff = (currentTime - recordStartTimestamp);
-            static const double SECOND = 1000.0;
-            double secondsSinceRecordStart =  (double) timeDiff / SECOND;
-            Record record(secondsSinceRecordStart, addr, value);
-            recordList.append(record);
-
-            if(recordElement->getParseResult()->getSrcMeasurement() != nullptr) {
-                emit sigUpdateRecordMeasurement();
-            } else {
-                emit sigUpdateRecordCalibration();
-            }
-            break;
+/**
+ * The signal id indexes the registry directly, the type conversion is precomputed. Every sample goes to the statistics,
+ * the live bus and the live sample store of the plot, the selected signals also to the recording.
+ */
+void Backend::slotVariableValueUpdate(uint32_t signalId, int64_t value) {
+    const shared_ptr<SignalRegistry> signalRegistry = model->getSignalRegistry();
+    if(!signalRegistry->isValid(signalId)) {
+        return;
+    }
+    const SignalInfo& signal = signalRegistry->getSignal(signalId);
+    value = signalRegistry->toValue(signalId, (uint32_t) value); //convert to signed/unsigned
+    signal.recordElement->setLatestValueIntAddHistory(value);
+
+    static const double SECOND = 1000.0;
+    qint64 currentTime = QDateTime::currentMSecsSinceEpoch();
+    double secondsSinceConnect = (double) (currentTime - connectTimestamp) / SECOND;
+    double physical = signalRegistry->toPhysical(signalId, value);
+    model->getSignalStatistics()->add(signalId, secondsSinceConnect, physical);
+    liveBusPublisher.publish(signalId, secondsSinceConnect, value, physical);
+    sampleStore->append(signalId, secondsSinceConnect, value);
+
+    if(signalId < recordSignalIds.size() && recordSignalIds[signalId] != SignalRegistry::INVALID_ID) {
+        qint64 timeDiff = (currentTime - recordStartTimestamp);
+        double secondsSinceRecordStart =  (double) timeDiff / SECOND;
+        if(triggerRecorder) {
+            triggerRecorder->append(secondsSinceRecordStart, recordSignalIds[signalId], value);
+        } else {
+            persistSample(secondsSinceRecordStart, recordSignalIds[signalId], value);
         }
     }
+
+    if(signal.isMeasurement) {
+        emit sigUpdateRecordMeasurement(signalId);
+    } else {
+        emit sigUpdateRecordCalibration(signalId);
+    }
 }
 
 void Backend::slotStateChangeXcpTask(XcpTask::State newState) {
     xcpState = newState;
+    if(newState == XcpTask::State::Disconnected || newState == XcpTask::State::Error) {
+        closeLiveBus(); // the readers see the end of the session
+    }
 }
 
-
-
+/***************************************************************
+*  Timer
+****************************************************************/
+void Backend::createTimerExportProgress() {
+    static const int EXPORT_PROGRESS_INTERVAL_MS = 100;
+    timerExportProgress = QSharedPointer<QTimer>::create(this);
+    connect(timerExportProgress.data(), SIGNAL(timeout()), this, SLOT(slotExportProgress()));
+    timerExportProgress->setInterval(EXPORT_PROGRESS_INTERVAL_MS);
+}
@@ -12,14 +12,17 @@
 #include "parser/parserManager.h"
 #include "xcp/xcptask.h"
 #include <record/recordElement.h>
-#include <record/record.h>
+#include <record/recordWriter.h>
+#include <record/mdf4Writer.h>
+#include <record/sampleStore.h>
+#include <record/csvExporter.h>
+#include <record/triggerRecorder.h>
+#include <liveBus/liveBusPublisher.h>
 
 #include <memory>
 #include <QObject>
 #include <QSharedPointer>
-
-#include "libs/qtcsv/include/qtcsv/stringdata.h"
-#include "libs/qtcsv/include/qtcsv/writer.h"
+#include <QTimer>
 
 class Backend : public QObject {
 
@@ -32,6 +35,15 @@ class Backend : public QObject {
     void setModel(const QSharedPointer<Model> &value);
 
     XcpTask::State getXcpState() const;
+    bool getIsRecording() const;
+    bool getIsExportRunning() const; // until the result of the CSV export is reported
+    CsvExporter::State getExportState() const;
+    std::shared_ptr<SampleStore> getSampleStore() const; // live samples since the connect, source of the live plot
+
+    /**
+     * @brief ageStatistics completes the statistics windows of the signals without new samples, called per frame.
+     */
+    void ageStatistics();
 
   public slots:
     void parse();
@@ -44,13 +56,17 @@ class Backend : public QObject {
     void slotRecordStart();
     void slotRecordStop();
     void slotParseResultSelectedByUser(int parseResultIndex, bool isSelected);
-    void slotVariableValueUpdate(uint64_t id, int64_t value);
+    void slotVariableValueUpdate(uint32_t signalId, int64_t value);
     void slotStateChangeXcpTask(XcpTask::State newState);
     void slotCalibration(int recordElementsIndex);
+    void slotVerifyChecksum();
+    void slotCalibrationDataset();
     void slotPrintMessage(QString msg, bool isError);
+    void slotExportCancel();
 
   signals:
     void sigParseProgress(int percent);
+    void sigExportProgress(int percent);
     void sigLoadProjectCompleted(bool isElfFileModified);
     void sigUpdateGuiFromModel();
     void sigConnectToClient();
@@ -58,19 +74,22 @@ class Backend : public QObject {
     void sigRecordStart();
     void sigRecordStop();
     void sigCalibration(int recordElementsIndex);
-    void sigUpdateRecordMeasurement();
-    void sigUpdateRecordCalibration();
+    void sigVerifyChecksum();
+    void sigCalibrationDataset();
+    void sigUpdateRecordMeasurement(uint32_t signalId);
+    void sigUpdateRecordCalibration(uint32_t signalId);
     void sigPrintMessage(QString msg, bool isError);
 
 
   private slots:
     void slotParseProgress(int percent);
+    void slotExportProgress();
 
   private:
     void updateModelWithParseResults(const std::unique_ptr<ParserManager>& parserManager);
+    bool loadParseResultsFromCache();
     void addToRecordElementsInModel(const shared_ptr<ParseResultBase> parseResult);
     void removeFromRecordElementsInModel(const shared_ptr<ParseResultBase> parseResult);
-    bool isDataTypeUnSigned(const string& dataType);
     /**
      * @brief fileChecksum
      * @param fileName
@@ -79,11 +98,15 @@ class Backend : public QObject {
     QByteArray fileChecksum(const QString &fileName);
     bool hasFileBeenModified(const QString& fileName,const QByteArray& fileHash);
 
-    void saveRecord(const QString& filename);
-    void writeRecordHeader(QStringList& header, QtCSV::StringData& data);
-    void writeRecordSignalNames(QMap<uint64_t, int>& idSignalPositionMap, QtCSV::StringData& data);
-    void addRecordEntryToRecordsWithEqualTimestamp(Record& record, QMap<int, Record>& recordsWithEqualTimestamp, const QMap<uint64_t, int>& idSignalPositionMap);
-    void writeRecordCsvFile(const QString& path, const QtCSV::StringData& data, const QStringList& header);
+    std::vector<RecordSignal> createRecordSignalTable();
+    std::vector<RecordSignal> createLiveSignalTable();
+    RecordSignal createRecordSignal(const SignalInfo& signalInfo);
+    void saveRecord(const QString& path);
+    void startRecordTrigger(const std::vector<RecordSignal>& signalTable);
+    void persistSample(const double time, const uint32_t signalId, const int64_t value);
+    void createTimerExportProgress();
+    void openLiveBus();
+    void closeLiveBus();
 
 
 
@@ -91,8 +114,16 @@ class Backend : public QObject {
     QSharedPointer<Model> model;
     XcpTask xcpTask;
     XcpTask::State xcpState;
-    QList<Record> recordList;
+    std::unique_ptr<RecordWriter> recordWriter; // native or MDF4, selected at record start
+    std::unique_ptr<TriggerRecorder> triggerRecorder; // only while a triggered recording is running
+    std::shared_ptr<SampleStore> sampleStore; // newest samples of every signal since the connect, bounded, signal id of the registry
+    QString recordFilePath; // of the current or the last recording, source of the CSV export
+    CsvExporter csvExporter;
+    QSharedPointer<QTimer> timerExportProgress;
+    std::vector<uint32_t> recordSignalIds; // index: signal id of the registry, value: signal id in the recording file
     qint64 recordStartTimestamp;
+    qint64 connectTimestamp; // time base of the live statistics and the live bus
+    LiveBusPublisher liveBusPublisher; // open while connected, if enabled in the files tab
 };
 
 #endif // BACKEND_H
@@ -14,6 +14,7 @@
 #include <QHostAddress>
 #include <QNetworkInterface>
 #include <map>
+#include <cmath>
 #include <QCloseEvent>
 
 #include "ui/dialogDeviceEventsInsert.h"
@@ -31,6 +32,16 @@ Controller::Controller(QSharedPointer<Backend> backend, QWidget *parent) :
     ui(new Ui::MainWindow) {
 
     ui->setupUi(this);
+    recordMeasurementModel = new RecordTableModel(RecordTableModel::TABLE::MEASUREMENT, model, this);
+    recordCalibrationModel = new RecordTableModel(RecordTableModel::TABLE::CALIBRATION, model, this);
+    ui->recordMeasurementTable->setModel(recordMeasurementModel);
+    ui->recordCalibrationTable->setModel(recordCalibrationModel);
+    connect(ui->recordMeasurementTable->selectionModel(), SIGNAL(selectionChanged(QItemSelection, QItemSelection)),
+            this, SLOT(slotRecordMeasurementSelectionChanged()));
+    editorModel = new EditorTableModel(model, this);
+    ui->editorTable->setModel(editorModel);
+    createTimerGuiRefresh();
+    createTimerEditorSearch();
     setGuiInitalView();
 
     setComboBoxOptions();
@@ -151,6 +162,87 @@ void Controller::on_filesRecordPathButton_clicked() {
     }
 }
 
+void Controller::on_filesRecordFormatComboBox_currentIndexChanged(int index) {
+    if(isGUISetupFinished) {
+        Model::RECORD_FORMAT selection = static_cast<Model::RECORD_FORMAT>(index);
+        model->setRecordFormatSelected(selection);
+    }
+}
+
+void Controller::on_filesCsvTimeBaseComboBox_currentIndexChanged(int index) {
+    if(isGUISetupFinished) {
+        Resampler::Settings resampleSettings = model->getCsvResampleSettings();
+        resampleSettings.timeBase = static_cast<Resampler::TIME_BASE>(index);
+        model->setCsvResampleSettings(resampleSettings);
+        ui->filesCsvInterpolationComboBox->setEnabled(resampleSettings.timeBase != Resampler::TIME_BASE::SAMPLES);
+        ui->filesCsvRasterSpinBox->setEnabled(resampleSettings.timeBase == Resampler::TIME_BASE::RASTER);
+    }
+}
+
+void Controller::on_filesCsvInterpolationComboBox_currentIndexChanged(int index) {
+    if(isGUISetupFinished) {
+        Resampler::Settings resampleSettings = model->getCsvResampleSettings();
+        resampleSettings.interpolation = static_cast<Resampler::INTERPOLATION>(index);
+        model->setCsvResampleSettings(resampleSettings);
+    }
+}
+
+void Controller::on_filesCsvRasterSpinBox_valueChanged(int value) {
+    if(isGUISetupFinished) {
+        static const double MS_PER_SECOND = 1000.0;
+        Resampler::Settings resampleSettings = model->getCsvResampleSettings();
+        resampleSettings.rasterInterval = value / MS_PER_SECOND;
+        model->setCsvResampleSettings(resampleSettings);
+    }
+}
+
+void Controller::on_filesTriggerCheckBox_toggled(bool checked) {
+    model->setIsRecordTriggerEnabled(checked);
+}
+
+void Controller::on_filesTriggerStartEdit_textChanged() {
+    TriggerRecorder::Settings triggerSettings = model->getRecordTriggerSettings();
+    triggerSettings.startExpression = ui->filesTriggerStartEdit->text().toStdString();
+    model->setRecordTriggerSettings(triggerSettings);
+}
+
+void Controller::on_filesTriggerStopEdit_textChanged() {
+    TriggerRecorder::Settings triggerSettings = model->getRecordTriggerSettings();
+    triggerSettings.stopExpression = ui->filesTriggerStopEdit->text().toStdString();
+    model->setRecordTriggerSettings(triggerSettings);
+}
+
+void Controller::on_filesTriggerPreSpinBox_valueChanged(double value) {
+    if(isGUISetupFinished) {
+        TriggerRecorder::Settings triggerSettings = model->getRecordTriggerSettings();
+        triggerSettings.preTriggerSeconds = value;
+        model->setRecordTriggerSettings(triggerSettings);
+    }
+}
+
+void Controller::on_filesTriggerPostSpinBox_valueChanged(double value) {
+    if(isGUISetupFinished) {
+        TriggerRecorder::Settings triggerSettings = model->getRecordTriggerSettings();
+        triggerSettings.postTriggerSeconds = value;
+        model->setRecordTriggerSettings(triggerSettings);
+    }
+}
+
+void Controller::on_filesLiveBusCheckBox_toggled(bool checked) {
+    model->setIsLiveBusEnabled(checked);
+}
+
+void Controller::on_filesLiveBusNameEdit_textChanged() {
+    model->setLiveBusName(ui->filesLiveBusNameEdit->text());
+}
+
+void Controller::on_filesGuiRefreshRateSpinBox_valueChanged(int value) {
+    if(isGUISetupFinished) {
+        model->setGuiRefreshRate(value);
+        setGuiRefreshRate(model->getGuiRefreshRate());
+    }
+}
+
 void Controller::on_filesSourcePathButton_clicked() {
     static const QFileDialog::Options options = QFileDialog::DontResolveSymlinks | QFileDialog::ShowDirsOnly;
     QString directory = QFileDialog::getExistingDirectory(this,
@@ -208,34 +300,56 @@ void Controller::on_editorParseSourceBtn_clicked() {
 }
 
 
-void Controller::on_editorTable_itemDoubleClicked(QTableWidgetItem *item) {
-    int rowIndex = item->row();
-    shared_ptr<ParseResultBase> var = model->getParseResults().at(rowIndex);
-
-    bool isSelected = var->getIsSelectedByUser();
-    if(isSelected) { //toggle view
-        ui->editorTable->setItem(rowIndex, 0, new QTableWidgetItem(""));
-    } else {
-        setEditorTableItemSelected(rowIndex);
+void Controller::on_editorTable_doubleClicked(const QModelIndex &index) {
+    int parseResultIndex = editorModel->getParseResultIndex(index.row());
+    if(parseResultIndex < 0) {
+        return;
     }
+    shared_ptr<ParseResultBase> var = model->getParseResults().at(parseResultIndex);
 
-    emit sigParseResultSelectedByUser(rowIndex, isSelected); //toggle model
+    bool isSelected = var->getIsSelectedByUser();
+    emit sigParseResultSelectedByUser(parseResultIndex, isSelected); //toggle model
+    editorModel->updateRow(index.row()); //toggle view
 
     //update view
     updateRecordCalibrationTableView();
     updateRecordMeasurementTableView();
 }
 
-void Controller::on_editorTable_itemPressed(QTableWidgetItem *item) {
-    shared_ptr<ParseResultBase> var = model->getParseResults().at(item->row());
+void Controller::on_editorTable_pressed(const QModelIndex &index) {
+    int parseResultIndex = editorModel->getParseResultIndex(index.row());
+    if(parseResultIndex < 0) {
+        return;
+    }
+    shared_ptr<ParseResultBase> var = model->getParseResults().at(parseResultIndex);
     clearEditorVariableSettingsView();
     updateEditorVariableSettingsView(var);
 }
 
+void Controller::on_editorSearchEdit_textChanged(const QString &text) {
+    searchEditorTable(text);
+}
+
+/**
+ * The results of the running search are appended to the editor table until the search is finished.
+ */
+void Controller::slotEditorSearchResults() {
+    std::vector<uint32_t> results;
+    bool isRunning = symbolSearch.takeResults(symbolSearchGeneration, results);
+    editorModel->appendFilterRows(results);
+    if(!isRunning) {
+        timerEditorSearch->stop();
+    }
+}
+
 void Controller::on_recordConnectBtn_clicked() {
     emit sigConnectToClient();
+    updateRecordMeasurementTableView(); // new signal ids
+    updateRecordCalibrationTableView();
     ui->recordStartBtn->setEnabled(true);
     ui->recordDisconnectBtn->setEnabled(true);
+    ui->recordVerifyBtn->setEnabled(true);
+    ui->recordApplyDatasetBtn->setEnabled(true);
     ui->recordConnectBtn->setEnabled(false);
     ui->recordConfigBtn->setEnabled(false);
     ui->mainDeviceTab->setEnabled(false);
@@ -251,6 +365,8 @@ void Controller::on_recordDisconnectBtn_clicked() {
     ui->recordDisconnectBtn->setEnabled(false);
     ui->recordStartBtn->setEnabled(false);
     ui->recordStopBtn->setEnabled(false);
+    ui->recordVerifyBtn->setEnabled(false);
+    ui->recordApplyDatasetBtn->setEnabled(false);
 }
 
 void Controller::on_recordConfigBtn_clicked() {
@@ -265,6 +381,9 @@ void Controller::on_recordConfigBtn_clicked() {
 
 void Controller::on_recordStartBtn_clicked() {
     emit sigRecordStart();
+    if(!backend->getIsRecording()) {
+        return; // the record file could not be created
+    }
     ui->recordStopBtn->setEnabled(true);
     ui->recordStartBtn->setEnabled(false);
     ui->recordDisconnectBtn->setEnabled(false);
@@ -277,14 +396,49 @@ void Controller::on_recordStopBtn_clicked() {
     ui->recordStopBtn->setEnabled(false);
 }
 
-void Controller::on_recordCalibrationTable_itemDoubleClicked(QTableWidgetItem *item) {
+void Controller::on_recordVerifyBtn_clicked() {
+    emit sigVerifyChecksum();
+}
+
+void Controller::on_recordApplyDatasetBtn_clicked() {
+    emit sigCalibrationDataset();
+    recordCalibrationModel->updateValues();
+}
+
+void Controller::on_recordExportCancelBtn_clicked() {
+    ui->recordExportCancelBtn->setEnabled(false);
+    emit sigExportCancel();
+}
+
+void Controller::on_recordPlotModeComboBox_currentIndexChanged(int index) {
+    ui->recordPlotWidget->setMode(index == 1 ? PlotDecimator::MODE::LTTB : PlotDecimator::MODE::MIN_MAX);
+}
+
+/**
+ * The selected measurements are plotted, by name, so the selection survives a new recording.
+ */
+void Controller::slotRecordMeasurementSelectionChanged() {
+    QStringList names;
+    QList<shared_ptr<RecordElement>> recordElements = model->getRecordElements();
+    for(const QModelIndex& index : ui->recordMeasurementTable->selectionModel()->selectedRows()) {
+        int recordElementsIndex = recordMeasurementModel->getRecordElementsIndex(index.row());
+        if(recordElementsIndex >= 0 && recordElementsIndex < recordElements.size()) {
+            names.append(QString::fromStdString(recordElements[recordElementsIndex]->getParseResult()->getName()));
+        }
+    }
+    ui->recordPlotWidget->setSignalNames(names);
+}
+
+void Controller::on_recordCalibrationTable_doubleClicked(const QModelIndex &index) {
     if((backend->getXcpState() == XcpTask::State::Disconnected) || (backend->getXcpState() == XcpTask::State::Error)) {
         writeToLogWindow("Connect to slave before calibrating.", false);
         return;
     }
 
-    int row = item->row();
-    int recordElementsIndex = ui->recordCalibrationTable->item(row, 0)->text().toInt();
+    int recordElementsIndex = recordCalibrationModel->getRecordElementsIndex(index.row());
+    if(recordElementsIndex < 0) {
+        return;
+    }
     try {
         shared_ptr<RecordElement> recordElement = model->getRecordElements().at(recordElementsIndex);
         shared_ptr<ParseResultBase> parseResult = recordElement->getParseResult();
@@ -295,7 +449,7 @@ void Controller::on_recordCalibrationTable_itemDoubleClicked(QTableWidgetItem *i
                              parseResult->getSrcParserObj()->getLowerLimit(), parseResult->getSrcParserObj()->getUpperLimit(), 6, &ok);
             if (ok) {
                 recordElement->setValueToSetFloat(valueNew);
-                emit sigCalibration(recordElementsIndex);
+                calibrateOrCollect(recordElementsIndex);
             }
 
         } else {
@@ -306,11 +460,11 @@ void Controller::on_recordCalibrationTable_itemDoubleClicked(QTableWidgetItem *i
                                                 (int) parseResult->getSrcCharateristic()->getStepSize(), &ok);
             if (ok) {
                 recordElement->setValueToSetInt(valueNew);
-                emit sigCalibration(recordElementsIndex);
+                calibrateOrCollect(recordElementsIndex);
             }
         }
     } catch (const std::out_of_range& oor) {
-        std::cerr << "Out of Range error in on_recordCalibrationTable_itemDoubleClicked(): " << oor.what() << std::endl;
+        std::cerr << "Out of Range error in on_recordCalibrationTable_doubleClicked(): " << oor.what() << std::endl;
     }
 }
 
@@ -367,6 +521,10 @@ void Controller::on_deviceDaqComboBox_currentIndexChanged(int index) {
     }
 }
 
+void Controller::on_deviceDaqOverloadControlCheckBox_toggled(bool checked) {
+    model->getXcpHostConfig()->setIsOverloadControlEnabled(checked);
+}
+
 void Controller::on_deviceXcpTimeoutEdit_textChanged() {
     int timeout = ui->deviceXcpTimeoutEdit->text().toInt();
     model->getXcpHostConfig()->setTimeout(timeout);
@@ -420,6 +578,11 @@ void Controller::slotParseProgress(int percent) {
     }
 }
 
+void Controller::slotExportProgress(int percent) {
+    ui->recordExportProgressBar->setValue(percent);
+    ui->recordExportCancelBtn->setEnabled(percent < 100);
+}
+
 void Controller::slotLoadProjectCompleted(bool isElfFileModified) {
     updateGuiFromModel();
     if(isElfFileModified) {
@@ -437,12 +600,26 @@ void Controller::slotUpdateGuiFromModel() {
     updateRecordCalibrationTableView();
 }
 
-void Controller::slotUpdateRecordMeasurement() {
-    updateRecordMeasurementTableView();
+void Controller::slotUpdateRecordMeasurement(uint32_t signalId) {
+    recordMeasurementModel->markDirty(signalId); // painted with the next frame
 }
 
-void Controller::slotUpdateRecordCalibration() {
-    updateRecordCalibrationTableView();
+void Controller::slotUpdateRecordCalibration(uint32_t signalId) {
+    recordCalibrationModel->markDirty(signalId);
+}
+
+/**
+ * Nothing is painted while the window is minimized or the record tab is hidden, the dirty rows are kept until it is shown.
+ * The statistics windows are aged in any case, so a signal which stopped shows a rate of zero.
+ */
+void Controller::slotGuiRefresh() {
+    backend->ageStatistics();
+    if(isMinimized() || !ui->mainRecordTab->isVisible()) {
+        return;
+    }
+    recordMeasurementModel->refresh();
+    recordCalibrationModel->refresh();
+    ui->recordPlotWidget->refresh(backend->getSampleStore());
 }
 
 void Controller::slotPrintMessage(QString msg, bool isError) {
@@ -518,90 +695,32 @@ void Controller::exportToA2lFile() {
 }
 
 void Controller::updateRecordMeasurementTableView() {
-    QList<shared_ptr<RecordElement>> recordElements = model->getRecordElements();
-
-    ui->recordMeasurementTable->clearContents();
-
-    int rows = recordElements.size();
-    ui->recordMeasurementTable->setRowCount(rows);
-    int columns = ui->recordMeasurementTable->columnCount();
+    recordMeasurementModel->rebuild();
+}
 
-    int row = 0;
-    for(int i = 0; i < recordElements.size(); i++) {
-        shared_ptr<ParseResultBase> parseResult = recordElements[i]->getParseResult();
-        if(recordElements[i]->getIsSelected() && (parseResult->getSrcMeasurement() != nullptr)) {
-            for (int column=0; column<columns; column++) {
-                switch (column) {
-                case 0:
-                    ui->recordMeasurementTable->setItem( row, column, new QTableWidgetItem(QString::number(i)));
-                    break;
-                case 1:
-                    ui->recordMeasurementTable->setItem( row, column, new QTableWidgetItem(QString::fromStdString(parseResult->getName())));
-                    break;
-                case 2:
-                    ui->recordMeasurementTable->setItem( row, column, new QTableWidgetItem(QString::number(recordElements[i]->getLatestValueInt())));
-                    break;
-                case 3:
-                    ui->recordMeasurementTable->setItem( row, column, new QTableWidgetItem(QString::fromStdString(parseResult->getSrcParserObj()->getPhyUnit())));
-                    break;
-                case 4:
-                    ui->recordMeasurementTable->setItem( row, column, new QTableWidgetItem(QString::fromStdString(parseResult->getSrcParserObj()->getComment())));
-                    break;
-                default:
-                    break;
-                }
-            }
-            row++;
-        }
+void Controller::calibrateOrCollect(int recordElementsIndex) {
+    if(ui->recordDatasetCheckBox->isChecked()) {
+        model->getRecordElements().at(recordElementsIndex)->setIsCalibrationPending(true);
+        recordCalibrationModel->updateValues();
+    } else {
+        emit sigCalibration(recordElementsIndex);
     }
 }
 
 void Controller::updateRecordCalibrationTableView() {
-    QList<shared_ptr<RecordElement>> recordElements = model->getRecordElements();
-
-    ui->recordCalibrationTable->clearContents();
+    recordCalibrationModel->rebuild();
+}
 
-    int rows = recordElements.size();
-    ui->recordCalibrationTable->setRowCount(rows);
-    int columns = ui->recordCalibrationTable->columnCount();
+void Controller::createTimerGuiRefresh() {
+    timerGuiRefresh = QSharedPointer<QTimer>::create(this);
+    connect(timerGuiRefresh.data(), SIGNAL(timeout()), this, SLOT(slotGuiRefresh()));
+    setGuiRefreshRate(model->getGuiRefreshRate());
+    timerGuiRefresh->start();
+}
 
-    int row = 0;
-    for(int i = 0; i < recordElements.size(); i++) {
-        shared_ptr<ParseResultBase> parseResult = recordElements[i]->getParseResult();
-        if(recordElements[i]->getIsSelected() && (parseResult->getSrcCharateristic() != nullptr)) {
-            for (int column=0; column<columns; column++) {
-                switch (column) {
-                case 0:
-                    ui->recordCalibrationTable->setItem( row, column, new QTableWidgetItem(QString::number(i)));
-                    break;
-                case 1:
-                    ui->recordCalibrationTable->setItem( row, column, new QTableWidgetItem(QString::fromStdString(parseResult->getName())));
-                    break;
-                case 2:
-                    ui->recordCalibrationTable->setItem( row, column, new QTableWidgetItem(QString::number(recordElements[i]->getLatestValueInt())));
-                    break;
-                case 3:
-                    ui->recordCalibrationTable->setItem( row, column, new QTableWidgetItem(QString::fromStdString(parseResult->getSrcParserObj()->getPhyUnit())));
-                    break;
-                case 4:
-                    ui->recordCalibrationTable->setItem( row, column, new QTableWidgetItem(QString::fromStdString(parseResult->getSrcParserObj()->getComment())));
-                    break;
-                case 5:
-                    ui->recordCalibrationTable->setItem( row, column, new QTableWidgetItem(QString::number(parseResult->getSrcParserObj()->getLowerLimit())));
-                    break;
-                case 6:
-                    ui->recordCalibrationTable->setItem( row, column, new QTableWidgetItem(QString::number(parseResult->getSrcParserObj()->getUpperLimit())));
-                    break;
-                case 7:
-                    ui->recordCalibrationTable->setItem( row, column, new QTableWidgetItem(QString::number(parseResult->getSrcCharateristic()->getStepSize())));
-                    break;
-                default:
-                    break;
-                }
-            }
-            row++;
-        }
-    }
+void Controller::setGuiRefreshRate(const int rate) {
+    static const int MS_PER_SECOND = 1000;
+    timerGuiRefresh->setInterval(MS_PER_SECOND / rate);
 }
 
 void Controller::updateGuiFromModel() {
@@ -623,6 +742,7 @@ void Controller::updateGuiFromModel() {
     ui->deviceXcpTimeoutEdit->setText(QString::number(xcpConfig->getTimeout()));
     ui->deviceXcpMaxCtoEdit->setText(QString::number(xcpConfig->getMaxCto()));
     ui->deviceXcpMaxDtoEdit->setText(QString::number(xcpConfig->getMaxDto()));
+    ui->deviceDaqOverloadControlCheckBox->setChecked(xcpConfig->getIsOverloadControlEnabled());
     updateEventTableView();
 
     switch (model->getTransportProtocolSelected()) {
@@ -660,6 +780,28 @@ void Controller::updateFilesFromModel() {
     ui->filesA2LFileEdit->setText(path);
     path = model->getFilesRecordPath();
     ui->filesRecordPathEdit->setText(path);
+    try {
+        ui->filesRecordFormatComboBox->setCurrentText(Model::getRecordFormatsKeyValue().at(model->getRecordFormatSelected()));
+    } catch (const std::out_of_range& oor) {
+        std::cerr << "Out of Range error in updateFilesFromModel(): " << oor.what() << std::endl;
+    }
+    Resampler::Settings resampleSettings = model->getCsvResampleSettings();
+    static const double MS_PER_SECOND = 1000.0;
+    ui->filesCsvTimeBaseComboBox->setCurrentIndex(static_cast<int>(resampleSettings.timeBase));
+    ui->filesCsvInterpolationComboBox->setCurrentIndex(static_cast<int>(resampleSettings.interpolation));
+    ui->filesCsvRasterSpinBox->setValue((int) std::lround(resampleSettings.rasterInterval * MS_PER_SECOND));
+    ui->filesCsvInterpolationComboBox->setEnabled(resampleSettings.timeBase != Resampler::TIME_BASE::SAMPLES);
+    ui->filesCsvRasterSpinBox->setEnabled(resampleSettings.timeBase == Resampler::TIME_BASE::RASTER);
+    TriggerRecorder::Settings triggerSettings = model->getRecordTriggerSettings();
+    ui->filesTriggerCheckBox->setChecked(model->getIsRecordTriggerEnabled());
+    ui->filesTriggerStartEdit->setText(QString::fromStdString(triggerSettings.startExpression));
+    ui->filesTriggerStopEdit->setText(QString::fromStdString(triggerSettings.stopExpression));
+    ui->filesTriggerPreSpinBox->setValue(triggerSettings.preTriggerSeconds);
+    ui->filesTriggerPostSpinBox->setValue(triggerSettings.postTriggerSeconds);
+    ui->filesLiveBusCheckBox->setChecked(model->getIsLiveBusEnabled());
+    ui->filesLiveBusNameEdit->setText(model->getLiveBusName());
+    ui->filesGuiRefreshRateSpinBox->setValue(model->getGuiRefreshRate());
+    setGuiRefreshRate(model->getGuiRefreshRate());
 }
 
 bool Controller::setRecentFilePath(const QString &newFilePath) {
@@ -706,54 +848,31 @@ void Controller::updateEventTableView() {
 }
 
 void Controller::updateEditorTableView() {
-    QVector<shared_ptr<ParseResultBase>> parseResults = model->getParseResults();
-
-    int rows = parseResults.size();
-    ui->editorTable->setRowCount(rows);
-    int columns = ui->editorTable->columnCount();
-
-    int row = 0;
-    for(const shared_ptr<ParseResultBase>& var : parseResults) {
-        for (int column=0; column<columns; column++) {
-            switch (column) {
-            case 0:
-                ui->editorTable->setItem( row, column, new QTableWidgetItem(var->getIsSelectedByUser()));
-                break;
-            case 1:
-                ui->editorTable->setItem( row, column, new QTableWidgetItem(QString::fromStdString(var->getDataType())));
-                break;
-            case 2:
-                ui->editorTable->setItem( row, column, new QTableWidgetItem(QString::fromStdString(var->getName())));
-                break;
-            case 3:
-                ui->editorTable->setItem( row, column, new QTableWidgetItem(QString::number(var->getAddress(), 16).toUpper()));
-                break;
-            case 4: {
-                QString comment = "";
-                if(hasParseResultSourceComment(var)) {
-                    comment = QString::fromStdString(var->getSrcParserObj()->getComment());
+    editorModel->rebuild();
+    symbolSearch.build(editorModel->getNames());
+    searchEditorTable(ui->editorSearchEdit->text());
+}
 
-                }
-                ui->editorTable->setItem( row, column, new QTableWidgetItem(comment));
-                break;
-            }
-            case 5:
-                ui->editorTable->setItem( row, column, new QTableWidgetItem(QString::fromStdString(var->getAbstractDataType())));
-                break;
-            default:
-                break;
-            }
-        }
-        if(var->getIsSelectedByUser()) {
-            setEditorTableItemSelected(row);
-        }
-        row++;
+/**
+ * An empty text shows all parse results. Otherwise the search runs in the background and the table is filled
+ * with the results while it is running.
+ */
+void Controller::searchEditorTable(const QString& text) {
+    if(text.isEmpty()) {
+        timerEditorSearch->stop();
+        editorModel->clearFilter();
+        return;
     }
+    symbolSearchGeneration = symbolSearch.search(text.toStdString());
+    editorModel->beginFilter();
+    timerEditorSearch->start();
 }
 
-void Controller::setEditorTableItemSelected(int rowIndex) {
-    const static QIcon SELECT_ICON = QIcon(":/resource/icons_gnome/24x24/status/starred.png");
-    ui->editorTable->setItem(rowIndex, 0, new QTableWidgetItem(SELECT_ICON, "select", 0));
+void Controller::createTimerEditorSearch() {
+    static const int SEARCH_POLL_MS = 30;
+    timerEditorSearch = QSharedPointer<QTimer>::create(this);
+    connect(timerEditorSearch.data(), SIGNAL(timeout()), this, SLOT(slotEditorSearchResults()));
+    timerEditorSearch->setInterval(SEARCH_POLL_MS);
 }
 
 bool Controller::updateEditorVariableSettingsView(const shared_ptr<ParseResultBase>& var) {
@@ -822,10 +941,6 @@ void Controller::clearEditorVariableSettingsView() {
 
 }
 
-bool Controller::hasParseResultSourceComment(const shared_ptr<ParseResultBase> &var) {
-    return (var->getSrcParserObj() != nullptr);
-}
-
 void checkCheckBox(QCheckBox* checkBox, bool isChecked) {
     checkBox->setAttribute(Qt::WA_TransparentForMouseEvents, false);
     checkBox->setFocusPolicy(Qt::StrongFocus);
@@ -856,6 +971,15 @@ void Controller::setComboBoxOptions() {
     for(const auto& daqMode : XcpOptions::getDaqModesKeyValue()) {
         ui->deviceDaqComboBox->addItem(daqMode.second, daqMode.first);
     }
+    for(const auto& recordFormat : Model::getRecordFormatsKeyValue()) {
+        ui->filesRecordFormatComboBox->addItem(recordFormat.second, static_cast<int>(recordFormat.first));
+    }
+    for(const auto& timeBase : Model::getCsvTimeBasesKeyValue()) {
+        ui->filesCsvTimeBaseComboBox->addItem(timeBase.second, static_cast<int>(timeBase.first));
+    }
+    for(const auto& interpolation : Model::getCsvInterpolationsKeyValue()) {
+        ui->filesCsvInterpolationComboBox->addItem(interpolation.second, static_cast<int>(interpolation.first));
+    }
 }
 
 
@@ -18,6 +18,11 @@
 #include <string>
 
 #include <QTableWidgetItem>
+#include <QTimer>
+
+#include "ui/recordTableModel.h"
+#include "ui/editorTableModel.h"
+#include "parser/symbolIndex.h"
 
 
 namespace Ui {
@@ -33,10 +38,11 @@ class Controller : public QMainWindow {
 
   public slots:
     void slotParseProgress(int percent);
+    void slotExportProgress(int percent);
     void slotLoadProjectCompleted(bool isElfFileModified);
     void slotUpdateGuiFromModel();
-    void slotUpdateRecordMeasurement();
-    void slotUpdateRecordCalibration();
+    void slotUpdateRecordMeasurement(uint32_t signalId);
+    void slotUpdateRecordCalibration(uint32_t signalId);
     void slotPrintMessage(QString msg, bool isError);
 
   private slots:
@@ -48,9 +54,12 @@ class Controller : public QMainWindow {
     void on_editorParseElfBtn_clicked();
     void on_editorParseSourceBtn_clicked();
 
-    void on_editorTable_itemDoubleClicked(QTableWidgetItem *item);
+    void on_editorTable_doubleClicked(const QModelIndex &index);
+
+    void on_editorTable_pressed(const QModelIndex &index);
 
-    void on_editorTable_itemPressed(QTableWidgetItem *item);
+    void on_editorSearchEdit_textChanged(const QString &text);
+    void slotEditorSearchResults();
 
     void on_recordConnectBtn_clicked();
 
@@ -62,6 +71,14 @@ class Controller : public QMainWindow {
 
     void on_recordStopBtn_clicked();
 
+    void on_recordVerifyBtn_clicked();
+
+    void on_recordApplyDatasetBtn_clicked();
+
+    void on_recordExportCancelBtn_clicked();
+    void on_recordPlotModeComboBox_currentIndexChanged(int index);
+    void slotRecordMeasurementSelectionChanged();
+
     void on_actionExport_to_A2L_triggered();
 
     void on_deviceTransportEthernetIpClientEdit_textChanged();
@@ -94,16 +111,32 @@ class Controller : public QMainWindow {
 
     void on_deviceDaqComboBox_currentIndexChanged(int index);
 
+    void on_deviceDaqOverloadControlCheckBox_toggled(bool checked);
+
     void on_actionSave_triggered();
 
     void on_editorOnlySourceCommentCheckBox_stateChanged(int checkState);
 
     void on_deviceTransportEthernetIpHostComboBox_currentIndexChanged(const QString &arg1);
 
-    void on_recordCalibrationTable_itemDoubleClicked(QTableWidgetItem *item);
+    void on_recordCalibrationTable_doubleClicked(const QModelIndex &index);
 
     void on_filesRecordPathButton_clicked();
 
+    void on_filesRecordFormatComboBox_currentIndexChanged(int index);
+    void on_filesCsvTimeBaseComboBox_currentIndexChanged(int index);
+    void on_filesCsvInterpolationComboBox_currentIndexChanged(int index);
+    void on_filesCsvRasterSpinBox_valueChanged(int value);
+    void on_filesTriggerCheckBox_toggled(bool checked);
+    void on_filesTriggerStartEdit_textChanged();
+    void on_filesTriggerStopEdit_textChanged();
+    void on_filesTriggerPreSpinBox_valueChanged(double value);
+    void on_filesTriggerPostSpinBox_valueChanged(double value);
+    void on_filesLiveBusCheckBox_toggled(bool checked);
+    void on_filesLiveBusNameEdit_textChanged();
+    void on_filesGuiRefreshRateSpinBox_valueChanged(int value);
+    void slotGuiRefresh();
+
     void on_actionAbout_OpenXCP_triggered();
 
     void on_actionAbout_Qt_triggered();
@@ -124,16 +157,19 @@ class Controller : public QMainWindow {
     void sigRecordStop();
     void sigParseResultSelectedByUser(int parseResultIndex, bool isSelected);
     void sigCalibration(int recordElementsIndex);
+    void sigVerifyChecksum();
+    void sigCalibrationDataset();
+    void sigExportCancel();
 
   private:
     void writeToLogWindow(std::string message, bool isError);
     void closeEvent (QCloseEvent *event) override;
 
     void updateEditorTableView();
-    void setEditorTableItemSelected(int rowIndex);
+    void searchEditorTable(const QString& text);
+    void createTimerEditorSearch();
     bool updateEditorVariableSettingsView(const shared_ptr<ParseResultBase>& var);
     void clearEditorVariableSettingsView();
-    bool hasParseResultSourceComment(const shared_ptr<ParseResultBase>& var);
 
     void updateEventTableView();
     void updateGuiFromModel();
@@ -151,11 +187,21 @@ class Controller : public QMainWindow {
 
     void updateRecordMeasurementTableView();
     void updateRecordCalibrationTableView();
+    void calibrateOrCollect(int recordElementsIndex);
+    void createTimerGuiRefresh();
+    void setGuiRefreshRate(const int rate);
 
   private:
     Ui::MainWindow *ui;
     QSharedPointer<Backend> backend;
     QSharedPointer<Model> model;
+    RecordTableModel* recordMeasurementModel; // owned by the controller
+    RecordTableModel* recordCalibrationModel;
+    QSharedPointer<QTimer> timerGuiRefresh; // repaints the dirty rows of the record tables at the GUI refresh rate
+    EditorTableModel* editorModel;
+    SymbolSearch symbolSearch; // name search in the editor table
+    uint64_t symbolSearchGeneration = 0; // of the running search
+    QSharedPointer<QTimer> timerEditorSearch; // takes the results of the running search
 
     QString recentFilePath;
 
@@ -0,0 +1,62 @@
+/**
+*@file headless.cpp
+*@author Michael Wolf
+*@date 19.10.2026
+*@brief Main C++ file of the headless recorder, main method. Records without GUI, e.g. on a HIL server:
+* Qt_Open_XCP_headless [--duration <s>] [--record-path <dir>] [--connect-timeout <s>] <project.json>
+*/
+
+#include "headlessRecorder.h"
+#include "backend.h"
+
+#include <csignal>
+#include <QCoreApplication>
+#include <QCommandLineParser>
+#include <QSharedPointer>
+#include <QTimer>
+#include <QTextStream>
+
+extern "C" void handleStopSignal(int) {
+    HeadlessRecorder::requestStop();
+}
+
+int main(int argc, char *argv[]) {
+    QCoreApplication a(argc, argv);
+    QCoreApplication::setApplicationName("Qt_Open_XCP_headless");
+
+    QCommandLineParser parser;
+    parser.setApplicationDescription("OpenXCP headless recorder: loads a project, connects to the slave and records until the "
+                                     "duration has passed or SIGINT/SIGTERM is received.");
+    parser.addHelpOption();
+    parser.addPositionalArgument("project", "OpenXCP project file (*.json).");
+    QCommandLineOption durationOption(QStringList() << "d" << "duration", "Record for <seconds>, 0: until stopped.", "seconds", "0");
+    QCommandLineOption recordPathOption(QStringList() << "o" << "record-path", "Write the recording to <directory>.", "directory");
+    QCommandLineOption connectTimeoutOption("connect-timeout", "Give up connecting after <seconds>.", "seconds", "10");
+    parser.addOption(durationOption);
+    parser.addOption(recordPathOption);
+    parser.addOption(connectTimeoutOption);
+    parser.process(a);
+
+    HeadlessRecorder::Settings settings;
+    bool isDurationOk, isTimeoutOk;
+    settings.durationSeconds = parser.value(durationOption).toDouble(&isDurationOk);
+    settings.connectTimeoutMs = (int) (parser.value(connectTimeoutOption).toDouble(&isTimeoutOk) * 1000);
+    settings.recordPath = parser.value(recordPathOption);
+    if(parser.positionalArguments().size() != 1 || !isDurationOk || settings.durationSeconds < 0.0 || !isTimeoutOk) {
+        QTextStream(stderr) << parser.helpText();
+        return HeadlessRecorder::EXIT_USAGE;
+    }
+    settings.projectFile = parser.positionalArguments().first();
+
+    std::signal(SIGINT, handleStopSignal);
+    std::signal(SIGTERM, handleStopSignal);
+
+    QSharedPointer<Backend> backend = QSharedPointer<Backend>::create();
+    HeadlessRecorder recorder(backend, settings);
+    QObject::connect(&recorder, &HeadlessRecorder::sigFinished, [](int exitCode) {
+        QCoreApplication::exit(exitCode);
+    });
+    QTimer::singleShot(0, &recorder, SLOT(slotStart()));
+
+    return a.exec();
+}
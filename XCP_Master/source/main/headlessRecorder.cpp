@@ -0,0 +1,179 @@
+/**
+*@file headlessRecorder.cpp
+*@author Michael Wolf
+*@date 19.10.2026
+*@brief The HeadlessRecorder class runs a recording without GUI: loads an OpenXCP project, connects to the slave,
+* records for a duration or until a stop is requested (SIGINT, SIGTERM) and reports the result as exit code.
+*/
+
+#include "headlessRecorder.h"
+
+#include <QFileInfo>
+#include <QDateTime>
+#include <QTextStream>
+
+volatile std::sig_atomic_t HeadlessRecorder::isStopRequested = 0;
+
+HeadlessRecorder::HeadlessRecorder(const QSharedPointer<Backend>& backend, const Settings& settings, QObject *parent)
+    : QObject(parent),
+      backend(backend),
+      settings(settings),
+      phase(PHASE::Idle),
+      exitCode(EXIT_OK),
+      isElfFileModified(false) {
+
+    createTimerPoll();
+    QObject::connect(backend.data(), SIGNAL(sigPrintMessage(QString, bool)), this, SLOT(slotPrintMessage(QString, bool)));
+    QObject::connect(backend.data(), SIGNAL(sigLoadProjectCompleted(bool)), this, SLOT(slotLoadProjectCompleted(bool)));
+}
+
+void HeadlessRecorder::requestStop() {
+    isStopRequested = 1;
+}
+
+void HeadlessRecorder::slotStart() {
+    if(!loadProject()) {
+        finish(EXIT_PROJECT);
+        return;
+    }
+    slotPrintMessage("Connecting to the slave.", false);
+    backend->slotConnectToClient();
+    phase = PHASE::Connecting;
+    phaseTimer.start();
+    timerPoll->start();
+}
+
+/***************************************************************
+*  Slots
+****************************************************************/
+void HeadlessRecorder::slotPrintMessage(QString msg, bool isError) {
+    QTextStream stream(isError ? stderr : stdout);
+    stream << QDateTime::currentDateTime().toString("hh:mm:ss.zzz ") << (isError ? "Error: " : "") << msg << endl;
+}
+
+void HeadlessRecorder::slotLoadProjectCompleted(bool isElfFileModified) {
+    this->isElfFileModified = isElfFileModified;
+}
+
+void HeadlessRecorder::slotPoll() {
+    switch (phase) {
+    case PHASE::Connecting:
+        pollConnecting();
+        break;
+    case PHASE::Recording:
+        pollRecording();
+        break;
+    case PHASE::Stopping:
+        pollStopping();
+        break;
+    default:
+        break;
+    }
+}
+
+/***************************************************************
+*  Phases
+****************************************************************/
+bool HeadlessRecorder::loadProject() {
+    if(!QFileInfo(settings.projectFile).isFile()) {
+        slotPrintMessage("OpenXCP project file not found: " + settings.projectFile, true);
+        return false;
+    }
+    QSharedPointer<Model> model = backend->getModel();
+    model->setFilesProjectFile(settings.projectFile);
+    backend->loadProject();
+    if(isElfFileModified) {
+        slotPrintMessage("ELF file has been modified. Parse the project in OpenXCP and save it again.", true);
+        return false;
+    }
+    bool isSignalSelected = false;
+    for(const auto& recordElement : model->getRecordElements()) {
+        isSignalSelected = isSignalSelected || recordElement->getIsSelected();
+    }
+    if(!isSignalSelected) {
+        slotPrintMessage("No signal selected for recording in " + settings.projectFile, true);
+        return false;
+    }
+    if(!settings.recordPath.isEmpty()) {
+        model->setFilesRecordPath(settings.recordPath);
+    }
+    slotPrintMessage("OpenXCP project loaded from: " + settings.projectFile, false);
+    return true;
+}
+
+void HeadlessRecorder::pollConnecting() {
+    XcpTask::State state = backend->getXcpState();
+    if(isStopRequested) {
+        stopRecording(EXIT_INTERRUPTED);
+    } else if(state == XcpTask::State::Connected) {
+        backend->slotRecordStart();
+        if(!backend->getIsRecording()) {
+            stopRecording(EXIT_RECORD);
+            return;
+        }
+        QString duration = settings.durationSeconds > 0.0 ? QString::number(settings.durationSeconds) + " s" : "until stopped";
+        slotPrintMessage("Recording " + duration + ".", false);
+        phase = PHASE::Recording;
+        phaseTimer.start();
+    } else if(state == XcpTask::State::Error || phaseTimer.elapsed() > settings.connectTimeoutMs) {
+        slotPrintMessage("Can not connect to the slave.", true);
+        stopRecording(EXIT_CONNECT);
+    }
+}
+
+void HeadlessRecorder::pollRecording() {
+    static const double SECOND = 1000.0;
+    XcpTask::State state = backend->getXcpState();
+    if(state == XcpTask::State::Error || state == XcpTask::State::Disconnected) {
+        slotPrintMessage("Connection to the slave lost, recording stopped.", true);
+        stopRecording(EXIT_CONNECTION_LOST);
+    } else if(isStopRequested) {
+        slotPrintMessage("Stop requested.", false);
+        stopRecording(EXIT_OK);
+    } else if(settings.durationSeconds > 0.0 && phaseTimer.elapsed() / SECOND >= settings.durationSeconds) {
+        stopRecording(EXIT_OK);
+    }
+}
+
+/**
+ * Waits for the CSV export of a native recording and for the disconnect, so the slave is left in a defined state.
+ */
+void HeadlessRecorder::pollStopping() {
+    static const int DISCONNECT_TIMEOUT_MS = 1000;
+    XcpTask::State state = backend->getXcpState();
+    bool isDisconnected = (state == XcpTask::State::Disconnected || state == XcpTask::State::Error);
+    if(backend->getIsExportRunning() || (!isDisconnected && phaseTimer.elapsed() < DISCONNECT_TIMEOUT_MS)) {
+        return;
+    }
+    if(exitCode == EXIT_OK && backend->getExportState() == CsvExporter::State::Failed) {
+        exitCode = EXIT_EXPORT;
+    }
+    finish(exitCode);
+}
+
+void HeadlessRecorder::stopRecording(const int exitCode) {
+    this->exitCode = exitCode;
+    if(backend->getIsRecording()) {
+        backend->slotRecordStop();
+    }
+    backend->slotDisconnectClient();
+    phase = PHASE::Stopping;
+    phaseTimer.start();
+}
+
+void HeadlessRecorder::finish(const int exitCode) {
+    timerPoll->stop();
+    phase = PHASE::Idle;
+    slotPrintMessage("Finished with exit code " + QString::number(exitCode) + ".", exitCode != EXIT_OK);
+    emit sigFinished(exitCode);
+}
+
+/***************************************************************
+*  Timer
+****************************************************************/
+void HeadlessRecorder::createTimerPoll() {
+    static const int POLL_INTERVAL_MS = 100;
+    timerPoll = QSharedPointer<QTimer>::create(this);
+    connect(timerPoll.data(), SIGNAL(timeout()), this, SLOT(slotPoll()));
+    timerPoll->setInterval(POLL_INTERVAL_MS);
+}
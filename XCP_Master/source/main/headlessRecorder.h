@@ -0,0 +1,84 @@
+/**
+*@file headlessRecorder.h
+*@author Michael Wolf
+*@date 19.10.2026
+*@brief The HeadlessRecorder class runs a recording without GUI: loads an OpenXCP project, connects to the slave,
+* records for a duration or until a stop is requested (SIGINT, SIGTERM) and reports the result as exit code.
+*/
+
+#ifndef HEADLESSRECORDER_H
+#define HEADLESSRECORDER_H
+
+#include "backend.h"
+
+#include <csignal>
+#include <QObject>
+#include <QSharedPointer>
+#include <QTimer>
+#include <QElapsedTimer>
+#include <QString>
+
+class HeadlessRecorder : public QObject {
+
+    Q_OBJECT
+
+  public:
+    enum EXIT_CODE {
+        EXIT_OK = 0,
+        EXIT_USAGE = 1,
+        EXIT_PROJECT = 2, // project file missing, ELF file modified or no signal selected
+        EXIT_CONNECT = 3,
+        EXIT_RECORD = 4, // record file can not be created
+        EXIT_CONNECTION_LOST = 5, // recording stopped early, the record file is complete up to the loss
+        EXIT_EXPORT = 6, // CSV export of a native recording failed
+        EXIT_INTERRUPTED = 130 // stop requested before the recording started
+    };
+
+    struct Settings {
+        QString projectFile;
+        QString recordPath; // empty: record path of the project
+        double durationSeconds = 0.0; // 0: until a stop is requested
+        int connectTimeoutMs = 10000;
+    };
+
+    HeadlessRecorder(const QSharedPointer<Backend>& backend, const Settings& settings, QObject *parent = Q_NULLPTR);
+
+    /**
+     * @brief requestStop ends the recording at the next poll. Async-signal-safe, called by the signal handler.
+     */
+    static void requestStop();
+
+  public slots:
+    void slotStart();
+
+  signals:
+    void sigFinished(int exitCode);
+
+  private slots:
+    void slotPrintMessage(QString msg, bool isError);
+    void slotLoadProjectCompleted(bool isElfFileModified);
+    void slotPoll();
+
+  private:
+    enum class PHASE {Idle, Connecting, Recording, Stopping};
+
+    bool loadProject();
+    void pollConnecting();
+    void pollRecording();
+    void pollStopping();
+    void stopRecording(const int exitCode);
+    void finish(const int exitCode);
+    void createTimerPoll();
+
+    static volatile std::sig_atomic_t isStopRequested;
+
+    QSharedPointer<Backend> backend;
+    Settings settings;
+    PHASE phase;
+    int exitCode;
+    bool isElfFileModified;
+    QElapsedTimer phaseTimer;
+    QSharedPointer<QTimer> timerPoll;
+};
+
+#endif // HEADLESSRECORDER_H
@@ -34,15 +34,19 @@ int main(int argc, char *argv[]) {
     QObject::connect(&controller, SIGNAL(sigRecordStop()), backend.data(), SLOT(slotRecordStop()));
     QObject::connect(&controller, SIGNAL(sigParseResultSelectedByUser(int, bool)), backend.data(), SLOT(slotParseResultSelectedByUser(int, bool)));
     QObject::connect(&controller, SIGNAL(sigCalibration(int)), backend.data(), SLOT(slotCalibration(int)));
+    QObject::connect(&controller, SIGNAL(sigVerifyChecksum()), backend.data(), SLOT(slotVerifyChecksum()));
+    QObject::connect(&controller, SIGNAL(sigCalibrationDataset()), backend.data(), SLOT(slotCalibrationDataset()));
+    QObject::connect(&controller, SIGNAL(sigExportCancel()), backend.data(), SLOT(slotExportCancel()));
 
     /**************************************************************
      * Signal backend to slot controller
      * ***********************************************************/
     QObject::connect(backend.data(), SIGNAL(sigParseProgress(int)), &controller, SLOT(slotParseProgress(int)));
+    QObject::connect(backend.data(), SIGNAL(sigExportProgress(int)), &controller, SLOT(slotExportProgress(int)));
     QObject::connect(backend.data(), SIGNAL(sigLoadProjectCompleted(bool)), &controller, SLOT(slotLoadProjectCompleted(bool)));
     QObject::connect(backend.data(), SIGNAL(sigUpdateGuiFromModel()), &controller, SLOT(slotUpdateGuiFromModel()));
-    QObject::connect(backend.data(), SIGNAL(sigUpdateRecordMeasurement()), &controller, SLOT(slotUpdateRecordMeasurement()));
-    QObject::connect(backend.data(), SIGNAL(sigUpdateRecordCalibration()), &controller, SLOT(slotUpdateRecordCalibration()));
+    QObject::connect(backend.data(), SIGNAL(sigUpdateRecordMeasurement(uint32_t)), &controller, SLOT(slotUpdateRecordMeasurement(uint32_t)));
+    QObject::connect(backend.data(), SIGNAL(sigUpdateRecordCalibration(uint32_t)), &controller, SLOT(slotUpdateRecordCalibration(uint32_t)));
     QObject::connect(backend.data(), SIGNAL(sigPrintMessage(QString, bool)), &controller, SLOT(slotPrintMessage(QString, bool)));
 
 
@@ -10,8 +10,15 @@
 Model::Model()
     : xcpHostConfig(std::make_shared<XcpHostConfig>(XcpOptions::VERSION_1_0, XcpOptions::ENDIAN_LITTLE, XcpOptions::ADDRESS_GRANULARITY_BYTE, 1000, 8, 8, XcpOptions::DAQ_MODE_DYNAMIC)),
       xcpClientConfig(std::make_shared<XcpClientConfig>()),
+      signalRegistry(std::make_shared<SignalRegistry>()),
+      signalStatistics(std::make_shared<SignalStatistics>()),
       ethernetConfig(std::make_shared<EthernetConfig>(QHostAddress("127.0.0.1"), 5555, QHostAddress("127.0.0.1"), EthernetConfig::PROTOCOL_UDP)),
-      transportProtocolSelected(TRANSPORT_PROTOCOL::ETHERNET) {
+      transportProtocolSelected(TRANSPORT_PROTOCOL::ETHERNET),
+      recordFormatSelected(RECORD_FORMAT::NATIVE),
+      isRecordTriggerEnabled(false),
+      isLiveBusEnabled(false),
+      liveBusName(LIVE_BUS::DEFAULT_NAME),
+      guiRefreshRate(DEFAULT_GUI_REFRESH_RATE) {
 
     parseResults = QVector<shared_ptr<ParseResultBase>>();
     recordElements = QList<shared_ptr<RecordElement>>();
@@ -37,6 +44,58 @@ const std::map<const QString, const Model::TRANSPORT_PROTOCOL> Model::getTranspo
     return transportProtocols;
 }
 
+const std::map<const Model::RECORD_FORMAT, const QString> Model::getRecordFormatsKeyValue() {
+    static const std::map<const RECORD_FORMAT, const QString> recordFormats {
+        {RECORD_FORMAT::NATIVE, "OpenXCP (*.oxr)"},
+        {RECORD_FORMAT::MDF4, "MDF4 (*.mf4)"},
+        {RECORD_FORMAT::MDF4_COMPRESSED, "MDF4 compressed (*.mf4)"}
+    };
+    return recordFormats;
+}
+
+const std::map<const QString, const Model::RECORD_FORMAT> Model::getRecordFormatsValueKey() {
+    static const std::map<const QString, const Model::RECORD_FORMAT> recordFormats {
+        {"OpenXCP (*.oxr)", RECORD_FORMAT::NATIVE},
+        {"MDF4 (*.mf4)", RECORD_FORMAT::MDF4},
+        {"MDF4 compressed (*.mf4)", RECORD_FORMAT::MDF4_COMPRESSED}
+    };
+    return recordFormats;
+}
+
+const std::map<const Resampler::TIME_BASE, const QString> Model::getCsvTimeBasesKeyValue() {
+    static const std::map<const Resampler::TIME_BASE, const QString> timeBases {
+        {Resampler::TIME_BASE::SAMPLES, "Samples (1 ms rows)"},
+        {Resampler::TIME_BASE::UNION, "Union of timestamps"},
+        {Resampler::TIME_BASE::RASTER, "Raster"}
+    };
+    return timeBases;
+}
+
+const std::map<const QString, const Resampler::TIME_BASE> Model::getCsvTimeBasesValueKey() {
+    static const std::map<const QString, const Resampler::TIME_BASE> timeBases {
+        {"Samples (1 ms rows)", Resampler::TIME_BASE::SAMPLES},
+        {"Union of timestamps", Resampler::TIME_BASE::UNION},
+        {"Raster", Resampler::TIME_BASE::RASTER}
+    };
+    return timeBases;
+}
+
+const std::map<const Resampler::INTERPOLATION, const QString> Model::getCsvInterpolationsKeyValue() {
+    static const std::map<const Resampler::INTERPOLATION, const QString> interpolations {
+        {Resampler::INTERPOLATION::ZERO_ORDER_HOLD, "Zero-order hold"},
+        {Resampler::INTERPOLATION::LINEAR, "Linear"}
+    };
+    return interpolations;
+}
+
+const std::map<const QString, const Resampler::INTERPOLATION> Model::getCsvInterpolationsValueKey() {
+    static const std::map<const QString, const Resampler::INTERPOLATION> interpolations {
+        {"Zero-order hold", Resampler::INTERPOLATION::ZERO_ORDER_HOLD},
+        {"Linear", Resampler::INTERPOLATION::LINEAR}
+    };
+    return interpolations;
+}
+
 QString Model::getFilesProjectFile() const {
     return filesProjectFile;
 }
@@ -158,6 +217,14 @@ void Model::setHashElfFile(const QByteArray& value) {
     hashElfFile = value;
 }
 
+shared_ptr<SignalRegistry> Model::getSignalRegistry() const {
+    return signalRegistry;
+}
+
+shared_ptr<SignalStatistics> Model::getSignalStatistics() const {
+    return signalStatistics;
+}
+
 QString Model::getFilesRecordPath() const {
     return filesRecordPath;
 }
@@ -166,6 +233,68 @@ void Model::setFilesRecordPath(const QString &value) {
     filesRecordPath = value;
 }
 
+Model::RECORD_FORMAT Model::getRecordFormatSelected() const {
+    return recordFormatSelected;
+}
+
+void Model::setRecordFormatSelected(const RECORD_FORMAT& value) {
+    recordFormatSelected = value;
+}
+
+Resampler::Settings Model::getCsvResampleSettings() const {
+    return csvResampleSettings;
+}
+
+void Model::setCsvResampleSettings(const Resampler::Settings& value) {
+    csvResampleSettings = value;
+}
+
+bool Model::getIsRecordTriggerEnabled() const {
+    return isRecordTriggerEnabled;
+}
+
+void Model::setIsRecordTriggerEnabled(const bool value) {
+    isRecordTriggerEnabled = value;
+}
+
+TriggerRecorder::Settings Model::getRecordTriggerSettings() const {
+    return recordTriggerSettings;
+}
+
+void Model::setRecordTriggerSettings(const TriggerRecorder::Settings& value) {
+    recordTriggerSettings = value;
+}
+
+bool Model::getIsLiveBusEnabled() const {
+    return isLiveBusEnabled;
+}
+
+void Model::setIsLiveBusEnabled(const bool value) {
+    isLiveBusEnabled = value;
+}
+
+QString Model::getLiveBusName() const {
+    return liveBusName;
+}
+
+void Model::setLiveBusName(const QString& value) {
+    liveBusName = value;
+}
+
+int Model::getGuiRefreshRate() const {
+    return guiRefreshRate;
+}
+
+void Model::setGuiRefreshRate(const int value) {
+    if(value < MIN_GUI_REFRESH_RATE) {
+        guiRefreshRate = MIN_GUI_REFRESH_RATE;
+    } else if(value > MAX_GUI_REFRESH_RATE) {
+        guiRefreshRate = MAX_GUI_REFRESH_RATE;
+    } else {
+        guiRefreshRate = value;
+    }
+}
+
 shared_ptr<XcpClientConfig> Model::getXcpClientConfig() const {
     return xcpClientConfig;
 }
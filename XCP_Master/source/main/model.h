@@ -23,6 +23,11 @@
 #include "xcpConfig/xcpClientConfig.h"
 
 #include "record/recordElement.h"
+#include "record/signalRegistry.h"
+#include "record/resampler.h"
+#include "record/triggerRecorder.h"
+#include "liveBus/liveBusFormat.h"
+#include "record/signalStatistics.h"
 
 using std::shared_ptr;
 
@@ -35,6 +40,20 @@ class Model {
     static const std::map<const TRANSPORT_PROTOCOL, const QString> getTransportProtocolsKeyValue();
     static const std::map<const QString, const TRANSPORT_PROTOCOL> getTransportProtocolsValueKey();
 
+    enum class RECORD_FORMAT {NATIVE, MDF4, MDF4_COMPRESSED};
+
+    static const std::map<const RECORD_FORMAT, const QString> getRecordFormatsKeyValue();
+    static const std::map<const QString, const RECORD_FORMAT> getRecordFormatsValueKey();
+
+    static const std::map<const Resampler::TIME_BASE, const QString> getCsvTimeBasesKeyValue();
+    static const std::map<const QString, const Resampler::TIME_BASE> getCsvTimeBasesValueKey();
+    static const std::map<const Resampler::INTERPOLATION, const QString> getCsvInterpolationsKeyValue();
+    static const std::map<const QString, const Resampler::INTERPOLATION> getCsvInterpolationsValueKey();
+
+    static const int DEFAULT_GUI_REFRESH_RATE = 30;
+    static const int MIN_GUI_REFRESH_RATE = 1;
+    static const int MAX_GUI_REFRESH_RATE = 120;
+
     QString getFilesProjectFile() const;
     void setFilesProjectFile(const QString& value);
 
@@ -75,9 +94,33 @@ class Model {
     QByteArray getHashElfFile() const;
     void setHashElfFile(const QByteArray& value);
 
+    shared_ptr<SignalRegistry> getSignalRegistry() const;
+    shared_ptr<SignalStatistics> getSignalStatistics() const;
+
     QString getFilesRecordPath() const;
     void setFilesRecordPath(const QString &value);
 
+    RECORD_FORMAT getRecordFormatSelected() const;
+    void setRecordFormatSelected(const RECORD_FORMAT& value);
+
+    Resampler::Settings getCsvResampleSettings() const;
+    void setCsvResampleSettings(const Resampler::Settings& value);
+
+    bool getIsRecordTriggerEnabled() const;
+    void setIsRecordTriggerEnabled(const bool value);
+
+    TriggerRecorder::Settings getRecordTriggerSettings() const;
+    void setRecordTriggerSettings(const TriggerRecorder::Settings& value);
+
+    bool getIsLiveBusEnabled() const;
+    void setIsLiveBusEnabled(const bool value);
+
+    QString getLiveBusName() const;
+    void setLiveBusName(const QString& value);
+
+    int getGuiRefreshRate() const;
+    void setGuiRefreshRate(const int value);
+
   private:
     QString filesProjectFile;
     QString filesA2lFile;
@@ -88,10 +131,19 @@ class Model {
     QByteArray hashElfFile;
 
     TRANSPORT_PROTOCOL transportProtocolSelected;
+    RECORD_FORMAT recordFormatSelected;
+    Resampler::Settings csvResampleSettings;
+    bool isRecordTriggerEnabled;
+    TriggerRecorder::Settings recordTriggerSettings;
+    bool isLiveBusEnabled;
+    QString liveBusName; // POSIX shared memory name
+    int guiRefreshRate; // in Hz, of the record tables
 
     shared_ptr<EthernetConfig> ethernetConfig;
     shared_ptr<XcpHostConfig> xcpHostConfig;
     shared_ptr<XcpClientConfig> xcpClientConfig;
+    shared_ptr<SignalRegistry> signalRegistry;
+    shared_ptr<SignalStatistics> signalStatistics; // live statistics per signal id of the registry
 
   private:
     QVector<shared_ptr<ParseResultBase>> parseResults;
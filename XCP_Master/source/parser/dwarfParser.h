@@ -13,6 +13,7 @@
 
 #include <string>
 #include <memory>
+#include <vector>
 
 using std::string;
 using std::map;
@@ -29,24 +30,35 @@ class DwarfParser {
     void setElfFilePathName(const string &value);
 
   private:
+    /**
+     * @brief State of the walk through one compilation unit. Every unit is walked by one thread into its own partial tree.
+     */
+    struct CompileUnitScope {
+        string srcPathCompileUnitLast;
+        string structNameLast;
+        map<uint64_t, shared_ptr<DwarfTreeObj>> dwarfTree; // partial tree of the unit
+    };
+
     string elfFilePathName;
     map<uint64_t,shared_ptr<DwarfTreeObj>> dwarfTree;
-    string srcPathCompileUnitLast;
-    string structNameLast;
     static const int STRUCT_MEMBER_SEARCH_DEPTH_MAX = 3;
 
-    void resolveVariables(const dwarf::die& node, bool isGlobalVariable);
+    bool loadForConcurrentWalk(const dwarf::dwarf& dw);
+    void walkCompileUnits(const std::vector<dwarf::compilation_unit>& units, vector<CompileUnitScope>& scopes,
+                          const bool isConcurrent);
+
+    void resolveVariables(const dwarf::die& node, bool isGlobalVariable, CompileUnitScope& scope);
 
     bool isVariableLocationValid(const dwarf::die& node);
     bool isParentNodeSubProgramm(const dwarf::die& node);
 
-    void addInfoToDwarfTreeObj(const dwarf::die& node, DwarfTreeObj& dwarfTreeObj);
-    void addDwarfTreeObjToMap(uint64_t key, shared_ptr<DwarfTreeObj> dwarfTreeObj);
+    void addInfoToDwarfTreeObj(const dwarf::die& node, DwarfTreeObj& dwarfTreeObj, const CompileUnitScope& scope);
+    void addDwarfTreeObjToMap(uint64_t key, shared_ptr<DwarfTreeObj> dwarfTreeObj, CompileUnitScope& scope);
 
     AbstractType lookupAbstractTypeForVariable(const dwarf::die& node);
     std::pair<string, uint32_t> lookupDataType(const dwarf::die& node);
-    void lookupSrcPathCompileUnit(const dwarf::die& node);
-    void lookupStructs(const dwarf::die& node);
+    void lookupSrcPathCompileUnit(const dwarf::die& node, CompileUnitScope& scope);
+    void lookupStructs(const dwarf::die& node, CompileUnitScope& scope);
     uint64_t lookupAddrOfVariable(const dwarf::die& node, AbstractType absType);
     void lookupStructElementsInDwarfTree(DwarfTreeObj& dwarf, uint64_t dwarfKey, int depth);
     void addStructElementsToStruct(DwarfTreeObj& dwarfStruct,vector<uint64_t>& dwarfStructKeys);
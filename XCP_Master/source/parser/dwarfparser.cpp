@@ -8,6 +8,7 @@
 #include "dwarfParser.h"
 #include "dwarfTreeObj.h"
 #include "libs/libelfin/elf/elf++.hh"
+#include "libs/libelfin/dwarf/internal.hh"
 
 #include <fcntl.h>
 #include <map>
@@ -17,6 +18,10 @@
 #include <regex>
 
 #include <vector>
+#include <thread>
+#include <atomic>
+#include <exception>
+#include <algorithm>
 
 #include <unordered_set>
 
@@ -29,22 +34,103 @@ DwarfParser::DwarfParser(const string& elfFilePathName) : elfFilePathName(elfFil
 }
 
 
+/**
+ * The compilation units are walked concurrently, each into its own partial tree. The keys are section offsets, so the merged
+ * tree does not depend on the order in which the units finish. The struct members are resolved on the merged tree.
+ */
 void DwarfParser::parse() {
     int elfFile = open(elfFilePathName.data(), O_RDONLY);
     elf::elf ef(elf::create_mmap_loader(elfFile));
     dwarf::dwarf dw(dwarf::elf::create_loader(ef));
 
-    for (const auto& cu : dw.compilation_units()) {
-        resolveVariables(cu.root(), true);
-    }
+    const std::vector<dwarf::compilation_unit>& units = dw.compilation_units();
+    bool isConcurrent = loadForConcurrentWalk(dw);
+    vector<CompileUnitScope> scopes(units.size());
+    walkCompileUnits(units, scopes, isConcurrent);
 
+    dwarfTree.clear();
+    for(CompileUnitScope& scope : scopes) {
+        dwarfTree.insert(scope.dwarfTree.begin(), scope.dwarfTree.end());
+    }
 
     for(auto &dwarfTreeElement : dwarfTree) {
         lookupStructElementsInDwarfTree(*dwarfTreeElement.second, dwarfTreeElement.first, 0);
     }
 }
 
-void DwarfParser::resolveVariables(const dwarf::die& node, bool isParentNodeSubprogram) {
+/**
+ * libelfin loads the sections, the type units and the abbreviations of a unit on first use, without locking. They are
+ * loaded here, the concurrent walk only reads. The type units of .debug_types are read like dwarf::get_type_unit() does.
+ * @return false if a type unit can not be read, its error is reported by the sequential walk where it is referenced.
+ */
+bool DwarfParser::loadForConcurrentWalk(const dwarf::dwarf& dw) {
+    try {
+        dw.get_section(dwarf::section_type::str);
+    } catch(dwarf::format_error&) {
+        // no string section, the names are inline
+    }
+    for (const auto& cu : dw.compilation_units()) {
+        cu.root();
+    }
+
+    std::shared_ptr<dwarf::section> types;
+    try {
+        types = dw.get_section(dwarf::section_type::types);
+    } catch(dwarf::format_error&) {
+        return true; // no type units
+    }
+    try {
+        dwarf::cursor typesCursor(types);
+        while(!typesCursor.end()) {
+            dwarf::type_unit tu(dw, typesCursor.get_section_offset());
+            const dwarf::type_unit& loaded = dw.get_type_unit(tu.get_type_signature());
+            loaded.root();
+            loaded.type();
+            typesCursor.subsection();
+        }
+    } catch(std::exception&) {
+        return false;
+    }
+    return true;
+}
+
+/**
+ * The calling thread and hardware_concurrency() - 1 workers take the next unit until all are walked. The first error
+ * in unit order is rethrown, as in a sequential walk.
+ * @param isConcurrent false walks all units in the calling thread.
+ */
+void DwarfParser::walkCompileUnits(const std::vector<dwarf::compilation_unit>& units, vector<CompileUnitScope>& scopes,
+                                   const bool isConcurrent) {
+    vector<std::exception_ptr> errors(units.size());
+    std::atomic<size_t> nextUnit(0);
+    auto walk = [&]() {
+        for(size_t unit = nextUnit++; unit < units.size(); unit = nextUnit++) {
+            try {
+                resolveVariables(units[unit].root(), true, scopes[unit]);
+            } catch(...) {
+                errors[unit] = std::current_exception();
+            }
+        }
+    };
+
+    size_t threadCount = isConcurrent ? std::min<size_t>(std::max(1u, std::thread::hardware_concurrency()), units.size()) : 1;
+    vector<std::thread> workers;
+    for(size_t worker = 1; worker < threadCount; worker++) {
+        workers.emplace_back(walk);
+    }
+    walk();
+    for(std::thread& worker : workers) {
+        worker.join();
+    }
+
+    for(const std::exception_ptr& error : errors) {
+        if(error) {
+            std::rethrow_exception(error);
+        }
+    }
+}
+
+void DwarfParser::resolveVariables(const dwarf::die& node, bool isParentNodeSubprogram, CompileUnitScope& scope) {
     uint64_t sectionOffset = node.get_section_offset();
 
     if(node.tag == dwarf::DW_TAG::subprogram) {
@@ -56,21 +142,21 @@ void DwarfParser::resolveVariables(const dwarf::die& node, bool isParentNodeSubp
 
     if(!isParentNodeSubprogram) { //ignore local variables from methods/functions
         if(node.tag == dwarf::DW_TAG::compile_unit) {
-            lookupSrcPathCompileUnit(node);
+            lookupSrcPathCompileUnit(node, scope);
         } else if(node.tag == dwarf::DW_TAG::structure_type) {
-            lookupStructs(node);
+            lookupStructs(node, scope);
         } else if((node.tag == dwarf::DW_TAG::variable) || (node.tag == dwarf::DW_TAG::member)) {
             if(isVariableLocationValid(node) || (node.tag == dwarf::DW_TAG::member)) {  //@TODO refactor code (gcc 4.6 and gcc 4.9 compliance)
                 shared_ptr<DwarfTreeObj> dwarfTreeObj = std::make_shared<DwarfTreeObj>();
                 dwarfTreeObj->setTag(to_string(node.tag));
-                addInfoToDwarfTreeObj(node, *dwarfTreeObj);
-                addDwarfTreeObjToMap(sectionOffset, dwarfTreeObj);
+                addInfoToDwarfTreeObj(node, *dwarfTreeObj, scope);
+                addDwarfTreeObjToMap(sectionOffset, dwarfTreeObj, scope);
             }
         }
     }
 
     for (const auto& child : node) {
-        resolveVariables(child, isParentNodeSubprogram);
+        resolveVariables(child, isParentNodeSubprogram, scope);
     }
 }
 
@@ -84,7 +170,7 @@ bool DwarfParser::isVariableLocationValid(const dwarf::die &node) {
 
 
 
-void DwarfParser::lookupSrcPathCompileUnit(const dwarf::die& node) {
+void DwarfParser::lookupSrcPathCompileUnit(const dwarf::die& node, CompileUnitScope& scope) {
     string dir, src;
     for (const auto &attr : node.attributes()) {
         dwarf::DW_AT attributeName = attr.first;
@@ -99,16 +185,16 @@ void DwarfParser::lookupSrcPathCompileUnit(const dwarf::die& node) {
     }
     std::stringstream ss;
     ss << std::regex_replace(dir, std::regex(R"(\\+)"), "/" ) << "/" << src;
-    srcPathCompileUnitLast = ss.str();
+    scope.srcPathCompileUnitLast = ss.str();
 }
 
-void DwarfParser::lookupStructs(const dwarf::die& node) {
+void DwarfParser::lookupStructs(const dwarf::die& node, CompileUnitScope& scope) {
     for (const auto& attr : node.attributes()) {
         dwarf::DW_AT attributeName = attr.first;
         string value = to_string(attr.second);
 
         if(attributeName == dwarf::DW_AT::name) {
-            structNameLast = value;
+            scope.structNameLast = value;
             break;
         }
     }
@@ -180,7 +266,7 @@ void DwarfParser::addStructElementsToStruct(DwarfTreeObj &dwarfStruct,vector<uin
     }
 }
 
-void DwarfParser::addInfoToDwarfTreeObj(const dwarf::die& node, DwarfTreeObj& dwarfTreeObj) {
+void DwarfParser::addInfoToDwarfTreeObj(const dwarf::die& node, DwarfTreeObj& dwarfTreeObj, const CompileUnitScope& scope) {
     for (const auto &attr : node.attributes()) {
         dwarf::DW_AT attributeName = attr.first;
         string value = to_string(attr.second);
@@ -189,7 +275,7 @@ void DwarfParser::addInfoToDwarfTreeObj(const dwarf::die& node, DwarfTreeObj& dw
             dwarfTreeObj.setAttributeName(value);
         }
         if(attributeName == dwarf::DW_AT::decl_file) {
-            dwarfTreeObj.setSourcePath(srcPathCompileUnitLast);
+            dwarfTreeObj.setSourcePath(scope.srcPathCompileUnitLast);
         }
         if(attributeName == dwarf::DW_AT::decl_line) {
             dwarfTreeObj.setDeclLine(stringHexToDec(value));
@@ -202,7 +288,7 @@ void DwarfParser::addInfoToDwarfTreeObj(const dwarf::die& node, DwarfTreeObj& dw
     if(node.tag == dwarf::DW_TAG::member) {
         AbstractType absType = lookupAbstractTypeForVariable(node);
         dwarfTreeObj.setAbsType(absType);
-        dwarfTreeObj.setStructName(structNameLast);
+        dwarfTreeObj.setStructName(scope.structNameLast);
     } else if(node.tag == dwarf::DW_TAG::variable) {
         AbstractType absType = lookupAbstractTypeForVariable(node);
         dwarfTreeObj.setAbsType(absType);
@@ -278,12 +364,12 @@ uint64_t DwarfParser::lookupAddrOfVariable(const dwarf::die &node, AbstractType
     return addr;
 }
 
-void DwarfParser::addDwarfTreeObjToMap(uint64_t key, shared_ptr<DwarfTreeObj> dwarfTreeObj) {
+void DwarfParser::addDwarfTreeObjToMap(uint64_t key, shared_ptr<DwarfTreeObj> dwarfTreeObj, CompileUnitScope& scope) {
     size_t sizeName = dwarfTreeObj->getAttributeName().size();
     AbstractType absType = dwarfTreeObj->getAbsType();
 
     if((sizeName > 0) && (absType != AbstractType::NotFound)) {
-        dwarfTree.insert(std::make_pair(key, dwarfTreeObj));
+        scope.dwarfTree.insert(std::make_pair(key, dwarfTreeObj));
     }
 }
 
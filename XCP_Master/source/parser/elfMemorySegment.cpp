@@ -0,0 +1,48 @@
+/**
+*@file elfMemorySegment.cpp
+*@author Michael Wolf
+*@date 19.10.2026
+*@brief A loadable ELF section (address and initial content) as it is flashed to the slave.
+*/
+
+#include "elfMemorySegment.h"
+
+ElfMemorySegment::ElfMemorySegment() : addr(0), isWritable(false) {
+
+}
+
+string ElfMemorySegment::getName() const {
+    return name;
+}
+
+void ElfMemorySegment::setName(const string &name) {
+    this->name = name;
+}
+
+uint64_t ElfMemorySegment::getAddr() const {
+    return addr;
+}
+
+void ElfMemorySegment::setAddr(uint64_t addr) {
+    this->addr = addr;
+}
+
+uint32_t ElfMemorySegment::getSize() const {
+    return (uint32_t) data.size();
+}
+
+const vector<uint8_t>& ElfMemorySegment::getData() const {
+    return data;
+}
+
+void ElfMemorySegment::setData(const uint8_t* data, size_t size) {
+    this->data.assign(data, data + size);
+}
+
+bool ElfMemorySegment::getIsWritable() const {
+    return isWritable;
+}
+
+void ElfMemorySegment::setIsWritable(bool isWritable) {
+    this->isWritable = isWritable;
+}
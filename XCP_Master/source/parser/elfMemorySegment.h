@@ -0,0 +1,43 @@
+/**
+*@file elfMemorySegment.h
+*@author Michael Wolf
+*@date 19.10.2026
+*@brief A loadable ELF section (address and initial content) as it is flashed to the slave.
+*/
+
+#ifndef ELFMEMORYSEGMENT_H
+#define ELFMEMORYSEGMENT_H
+
+#include <string>
+#include <vector>
+#include <stdint.h>
+
+using std::string;
+using std::vector;
+
+class ElfMemorySegment {
+  public:
+    ElfMemorySegment();
+
+    string getName() const;
+    void setName(const string &name);
+
+    uint64_t getAddr() const;
+    void setAddr(uint64_t addr);
+
+    uint32_t getSize() const;
+
+    const vector<uint8_t>& getData() const;
+    void setData(const uint8_t* data, size_t size);
+
+    bool getIsWritable() const;
+    void setIsWritable(bool isWritable);
+
+  private:
+    string name;
+    uint64_t addr;
+    vector<uint8_t> data;
+    bool isWritable; // RAM section (e.g. .data), may hold calibration parameters
+};
+
+#endif // ELFMEMORYSEGMENT_H
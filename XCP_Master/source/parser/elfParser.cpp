@@ -17,7 +17,10 @@
 #include <sys/types.h>
 #include <sys/stat.h>
 #include <fcntl.h>
+#include <unistd.h>
 #include <inttypes.h>
+#include <cerrno>
+#include <system_error>
 
 
 ElfParser::ElfParser() {
@@ -55,6 +58,39 @@ void ElfParser::parseElfFile() {
     }
 }
 
+/**
+ * The mmap loader closes the file after mapping it, the file is closed here only if the loader fails.
+ */
+void ElfParser::parseMemorySegments() {
+    memorySegments.clear();
+    int elfFile = open(elfFilePathName.data(), O_RDONLY);
+    if(elfFile == -1) {
+        throw std::system_error(errno, std::generic_category(), "opening " + elfFilePathName);
+    }
+    std::shared_ptr<elf::loader> loader;
+    try {
+        loader = elf::create_mmap_loader(elfFile);
+    } catch(...) {
+        close(elfFile);
+        throw;
+    }
+    elf::elf f(loader);
+    for (const auto &sec : f.sections()) {
+        const auto &hdr = sec.get_hdr();
+        bool isAllocated = ((hdr.flags & elf::shf::alloc) == elf::shf::alloc);
+        if(!isAllocated || hdr.type != elf::sht::progbits || sec.size() == 0) {
+            continue;
+        }
+
+        ElfMemorySegment segment;
+        segment.setName(sec.get_name());
+        segment.setAddr(hdr.addr);
+        segment.setData(static_cast<const uint8_t*>(sec.data()), sec.size());
+        segment.setIsWritable((hdr.flags & elf::shf::write) == elf::shf::write);
+        memorySegments.push_back(segment);
+    }
+}
+
 /**************************************************************
  *  Getter / Setter
  * ***********************************************************/
@@ -62,6 +98,10 @@ vector<ElfInfo> ElfParser::getElfInfos() const {
     return elfInfos;
 }
 
+vector<ElfMemorySegment> ElfParser::getMemorySegments() const {
+    return memorySegments;
+}
+
 void ElfParser::setElfFilePathName(const string &value) {
     elfFilePathName = value;
 }
@@ -12,6 +12,7 @@
 #include <vector>
 
 #include "elfInfo.h"
+#include "elfMemorySegment.h"
 
 using std::string;
 using std::vector;
@@ -24,11 +25,18 @@ class ElfParser {
     void parseElfFile();
     vector<ElfInfo> getElfInfos() const;
 
+    /**
+     * @brief parseMemorySegments reads all allocated sections with file content (e.g. .text, .data, calibration sections).
+     */
+    void parseMemorySegments();
+    vector<ElfMemorySegment> getMemorySegments() const;
+
     void setElfFilePathName(const string &value);
 
   private:
     string elfFilePathName;
     vector<ElfInfo> elfInfos;
+    vector<ElfMemorySegment> memorySegments;
 
 };
 
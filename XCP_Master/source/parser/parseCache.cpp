@@ -0,0 +1,430 @@
+/**
+*@file parseCache.cpp
+*@author Michael Wolf
+*@date 19.10.2026
+*@brief Binary cache of the parse results (*.oxpc), stored next to the project file. The cache is valid for the ELF file
+* with the same MD5 hash, the same source path, unchanged source files of the results and the same PARSER_VERSION.
+* It is memory mapped on load, so an unchanged ELF file is not parsed again. All numbers are stored little endian.
+*/
+
+#include "parseCache.h"
+
+#include <QFile>
+#include <QFileInfo>
+#include <QDateTime>
+#include <QSaveFile>
+
+#include <cstring>
+#include <set>
+
+namespace {
+void writeU8(std::string& buffer, const uint8_t value) {
+    buffer.push_back((char) value);
+}
+
+void writeU32(std::string& buffer, const uint32_t value) {
+    for(int i = 0; i < 4; i++) {
+        buffer.push_back((char) (value >> (i * 8)));
+    }
+}
+
+void writeU64(std::string& buffer, const uint64_t value) {
+    for(int i = 0; i < 8; i++) {
+        buffer.push_back((char) (value >> (i * 8)));
+    }
+}
+
+void writeDouble(std::string& buffer, const double value) {
+    uint64_t raw;
+    std::memcpy(&raw, &value, sizeof(raw));
+    writeU64(buffer, raw);
+}
+
+void writeString(std::string& buffer, const std::string& str) {
+    writeU32(buffer, (uint32_t) str.size());
+    buffer.append(str);
+}
+}
+
+ParseCache::ParseCache(const std::string& filePathName, const std::string& elfFileHash, const std::string& sourcePath)
+    : filePathName(filePathName),
+      elfFileHash(elfFileHash),
+      sourcePath(sourcePath),
+      data(nullptr),
+      size(0) {
+
+}
+
+std::string ParseCache::getFilePathName(const std::string& projectFilePathName) {
+    if(projectFilePathName.empty()) {
+        return std::string();
+    }
+    QFileInfo project(QString::fromStdString(projectFilePathName));
+    return (project.absolutePath() + "/" + project.completeBaseName() + "." + PARSE_CACHE::FILE_SUFFIX).toStdString();
+}
+
+/***************************************************************
+*  Save
+****************************************************************/
+/**
+ * The file is built in memory and written with QSaveFile, a failed or interrupted save keeps the previous cache.
+ */
+bool ParseCache::save(const Results& results) {
+    if(filePathName.empty() || elfFileHash.empty()) {
+        return false;
+    }
+    std::string buffer;
+    buffer.append(PARSE_CACHE::MAGIC, PARSE_CACHE::MAGIC_SIZE);
+    writeU32(buffer, PARSE_CACHE::VERSION);
+    writeU32(buffer, PARSE_CACHE::PARSER_VERSION);
+    writeString(buffer, elfFileHash);
+    writeString(buffer, sourcePath);
+
+    std::vector<std::string> sourcePaths = collectSourcePaths(results);
+    writeU32(buffer, (uint32_t) sourcePaths.size());
+    for(const std::string& path : sourcePaths) {
+        SourceFile sourceFile = readSourceFile(path);
+        writeString(buffer, sourceFile.path);
+        writeU64(buffer, sourceFile.size);
+        writeU64(buffer, (uint64_t) sourceFile.lastModified);
+    }
+
+    writeU32(buffer, (uint32_t) results.variables.size());
+    for(const auto& variable : results.variables) {
+        writeResult(buffer, *variable, PARSE_CACHE::KIND_VARIABLE);
+    }
+    writeU32(buffer, (uint32_t) results.arrays.size());
+    for(const auto& array : results.arrays) {
+        writeResult(buffer, *array, PARSE_CACHE::KIND_ARRAY);
+    }
+    writeU32(buffer, (uint32_t) results.structs.size());
+    for(const auto& structure : results.structs) {
+        writeResult(buffer, *structure, PARSE_CACHE::KIND_STRUCT);
+    }
+
+    QSaveFile file(QString::fromStdString(filePathName));
+    if(!file.open(QIODevice::WriteOnly)) {
+        return false;
+    }
+    if(file.write(buffer.data(), (qint64) buffer.size()) != (qint64) buffer.size()) {
+        file.cancelWriting();
+        return false;
+    }
+    return file.commit();
+}
+
+void ParseCache::writeResult(std::string& buffer, const ParseResultBase& result, const uint8_t kind) {
+    writeU8(buffer, kind);
+    writeString(buffer, result.getName());
+    writeU64(buffer, result.getAddress());
+    writeU32(buffer, result.getSize());
+    writeString(buffer, result.getDataType());
+    writeString(buffer, result.getAbstractDataType());
+    writeString(buffer, result.getSourceFilePathName());
+    writeU32(buffer, result.getSourceFileLine());
+
+    if(result.getSrcMeasurement() != nullptr) {
+        const SourceParseMeasurement& measurement = *result.getSrcMeasurement();
+        writeU8(buffer, PARSE_CACHE::SOURCE_MEASUREMENT);
+        writeU8(buffer, measurement.getIsDiscrete() ? 1 : 0);
+        writeU32(buffer, measurement.getMaxRefreshRate());
+        writeString(buffer, measurement.getConversionFunction());
+        writeU8(buffer, measurement.getIsWriteable() ? 1 : 0);
+    } else if(result.getSrcCharateristic() != nullptr) {
+        writeU8(buffer, PARSE_CACHE::SOURCE_CHARACTERISTIC);
+        writeDouble(buffer, result.getSrcCharateristic()->getStepSize());
+    } else {
+        writeU8(buffer, PARSE_CACHE::SOURCE_NONE);
+    }
+    const SourceParserObj* srcParserObj = result.getSrcParserObj();
+    if(srcParserObj != nullptr) {
+        writeString(buffer, srcParserObj->getComment());
+        writeDouble(buffer, srcParserObj->getLowerLimit());
+        writeDouble(buffer, srcParserObj->getUpperLimit());
+        writeString(buffer, srcParserObj->getPhyUnit());
+    }
+
+    if(kind == PARSE_CACHE::KIND_ARRAY) {
+        const ParseResultArray& array = static_cast<const ParseResultArray&>(result);
+        writeU32(buffer, (uint32_t) array.getElements());
+        writeU32(buffer, (uint32_t) array.getSizePerElement());
+    } else if(kind == PARSE_CACHE::KIND_STRUCT) {
+        const ParseResultStruct& structure = static_cast<const ParseResultStruct&>(result);
+        std::vector<std::shared_ptr<ParseResultBase>> elements = structure.getElements();
+        writeU32(buffer, (uint32_t) elements.size());
+        for(const auto& element : elements) {
+            bool isArray = std::dynamic_pointer_cast<ParseResultArray>(element) != nullptr;
+            writeResult(buffer, *element, isArray ? PARSE_CACHE::KIND_ARRAY : PARSE_CACHE::KIND_VARIABLE);
+        }
+    }
+}
+
+/***************************************************************
+*  Load
+****************************************************************/
+/**
+ * The header and the source files are checked before any result is read. The results are read into local vectors,
+ * a truncated or corrupt file does not change results.
+ */
+bool ParseCache::load(Results& results) {
+    if(filePathName.empty() || elfFileHash.empty()) {
+        return false;
+    }
+    QFile file(QString::fromStdString(filePathName));
+    if(!file.open(QIODevice::ReadOnly) || file.size() < PARSE_CACHE::MAGIC_SIZE) {
+        return false;
+    }
+    size = (uint64_t) file.size();
+    data = file.map(0, file.size());
+    if(data == nullptr) {
+        return false;
+    }
+
+    Results loaded;
+    bool isValid = std::memcmp(data, PARSE_CACHE::MAGIC, PARSE_CACHE::MAGIC_SIZE) == 0;
+    uint64_t position = PARSE_CACHE::MAGIC_SIZE;
+    uint32_t version = 0;
+    uint32_t parserVersion = 0;
+    std::string hash;
+    std::string path;
+    isValid = isValid && readU32(position, version) && version == PARSE_CACHE::VERSION;
+    isValid = isValid && readU32(position, parserVersion) && parserVersion == PARSE_CACHE::PARSER_VERSION;
+    isValid = isValid && readString(position, hash) && hash == elfFileHash;
+    isValid = isValid && readString(position, path) && path == sourcePath;
+
+    uint32_t count = 0;
+    isValid = isValid && readU32(position, count);
+    for(uint32_t i = 0; isValid && i < count; i++) {
+        SourceFile cached;
+        uint64_t lastModified = 0;
+        isValid = readString(position, cached.path) && readU64(position, cached.size) && readU64(position, lastModified);
+        SourceFile current = readSourceFile(cached.path);
+        isValid = isValid && current.size == cached.size && current.lastModified == (int64_t) lastModified;
+    }
+
+    uint8_t kind = 0;
+    isValid = isValid && readU32(position, count);
+    for(uint32_t i = 0; isValid && i < count; i++) {
+        std::shared_ptr<ParseResultBase> result = readResult(position, kind);
+        isValid = result != nullptr && kind == PARSE_CACHE::KIND_VARIABLE;
+        if(isValid) {
+            loaded.variables.push_back(std::static_pointer_cast<ParseResultVariable>(result));
+        }
+    }
+    isValid = isValid && readU32(position, count);
+    for(uint32_t i = 0; isValid && i < count; i++) {
+        std::shared_ptr<ParseResultBase> result = readResult(position, kind);
+        isValid = result != nullptr && kind == PARSE_CACHE::KIND_ARRAY;
+        if(isValid) {
+            loaded.arrays.push_back(std::static_pointer_cast<ParseResultArray>(result));
+        }
+    }
+    isValid = isValid && readU32(position, count);
+    for(uint32_t i = 0; isValid && i < count; i++) {
+        std::shared_ptr<ParseResultBase> result = readResult(position, kind);
+        isValid = result != nullptr && kind == PARSE_CACHE::KIND_STRUCT;
+        if(isValid) {
+            loaded.structs.push_back(std::static_pointer_cast<ParseResultStruct>(result));
+        }
+    }
+
+    file.unmap(const_cast<uchar*>(data));
+    data = nullptr;
+    size = 0;
+    if(isValid) {
+        results = std::move(loaded);
+    }
+    return isValid;
+}
+
+std::shared_ptr<ParseResultBase> ParseCache::readResult(uint64_t& position, uint8_t& kind) {
+    if(!readU8(position, kind)) {
+        return nullptr;
+    }
+    std::shared_ptr<ParseResultBase> result;
+    if(kind == PARSE_CACHE::KIND_VARIABLE) {
+        result = std::make_shared<ParseResultVariable>();
+    } else if(kind == PARSE_CACHE::KIND_ARRAY) {
+        result = std::make_shared<ParseResultArray>();
+    } else if(kind == PARSE_CACHE::KIND_STRUCT) {
+        result = std::make_shared<ParseResultStruct>();
+    } else {
+        return nullptr;
+    }
+
+    std::string name, dataType, abstractDataType, sourceFilePathName;
+    uint64_t address = 0;
+    uint32_t resultSize = 0;
+    uint32_t sourceFileLine = 0;
+    if(!readString(position, name) || !readU64(position, address) || !readU32(position, resultSize) || !readString(position, dataType)
+            || !readString(position, abstractDataType) || !readString(position, sourceFilePathName) || !readU32(position, sourceFileLine)
+            || !readSourceParserObj(position, *result)) {
+        return nullptr;
+    }
+    result->setName(name);
+    result->setAddress(address);
+    result->setSize(resultSize);
+    result->setDataType(dataType);
+    result->setAbstractDataType(abstractDataType);
+    result->setSourceFilePathName(sourceFilePathName);
+    result->setSourceFileLine(sourceFileLine);
+
+    if(kind == PARSE_CACHE::KIND_ARRAY) {
+        uint32_t elements = 0;
+        uint32_t sizePerElement = 0;
+        if(!readU32(position, elements) || !readU32(position, sizePerElement)) {
+            return nullptr;
+        }
+        ParseResultArray& array = static_cast<ParseResultArray&>(*result);
+        array.setElements((int) elements);
+        array.setSizePerElement((int) sizePerElement);
+    } else if(kind == PARSE_CACHE::KIND_STRUCT) {
+        uint32_t count = 0;
+        if(!readU32(position, count)) {
+            return nullptr;
+        }
+        ParseResultStruct& structure = static_cast<ParseResultStruct&>(*result);
+        for(uint32_t i = 0; i < count; i++) {
+            uint8_t elementKind = 0;
+            std::shared_ptr<ParseResultBase> element = readResult(position, elementKind);
+            if(element == nullptr || elementKind == PARSE_CACHE::KIND_STRUCT) {
+                return nullptr;
+            }
+            structure.addElement(element);
+        }
+    }
+    return result;
+}
+
+bool ParseCache::readSourceParserObj(uint64_t& position, ParseResultBase& result) {
+    uint8_t source = 0;
+    if(!readU8(position, source)) {
+        return false;
+    }
+    if(source == PARSE_CACHE::SOURCE_MEASUREMENT) {
+        uint8_t isDiscrete = 0;
+        uint32_t maxRefreshRate = 0;
+        std::string conversionFunction;
+        uint8_t isWriteable = 0;
+        if(!readU8(position, isDiscrete) || !readU32(position, maxRefreshRate) || !readString(position, conversionFunction)
+                || !readU8(position, isWriteable)) {
+            return false;
+        }
+        std::shared_ptr<SourceParseMeasurement> measurement = std::make_shared<SourceParseMeasurement>();
+        measurement->setIsDiscrete(isDiscrete != 0);
+        measurement->setMaxRefreshRate(maxRefreshRate);
+        measurement->setConversionFunction(conversionFunction);
+        measurement->setIsWriteable(isWriteable != 0);
+        result.setSrcMeasurement(measurement);
+    } else if(source == PARSE_CACHE::SOURCE_CHARACTERISTIC) {
+        double stepSize = 0.0;
+        if(!readDouble(position, stepSize)) {
+            return false;
+        }
+        std::shared_ptr<SourceParseCharacteristic> characteristic = std::make_shared<SourceParseCharacteristic>();
+        characteristic->setStepSize(stepSize);
+        result.setSrcCharateristic(characteristic);
+    } else if(source != PARSE_CACHE::SOURCE_NONE) {
+        return false;
+    }
+
+    SourceParserObj* srcParserObj = result.getSrcParserObj();
+    if(srcParserObj != nullptr) {
+        std::string comment, phyUnit;
+        double lowerLimit = 0.0;
+        double upperLimit = 0.0;
+        if(!readString(position, comment) || !readDouble(position, lowerLimit) || !readDouble(position, upperLimit)
+                || !readString(position, phyUnit)) {
+            return false;
+        }
+        srcParserObj->setComment(comment);
+        srcParserObj->setLowerLimit(lowerLimit);
+        srcParserObj->setUpperLimit(upperLimit);
+        srcParserObj->setPhyUnit(phyUnit);
+    }
+    return true;
+}
+
+/***************************************************************
+*  Utility
+****************************************************************/
+ParseCache::SourceFile ParseCache::readSourceFile(const std::string& path) {
+    QFileInfo info(QString::fromStdString(path));
+    SourceFile sourceFile;
+    sourceFile.path = path;
+    sourceFile.size = info.exists() ? (uint64_t) info.size() : 0;
+    sourceFile.lastModified = info.exists() ? info.lastModified().toMSecsSinceEpoch() : 0;
+    return sourceFile;
+}
+
+/**
+ * The source parser reads the source file of every result, a changed XCP comment does not change the ELF file.
+ */
+std::vector<std::string> ParseCache::collectSourcePaths(const Results& results) {
+    std::set<std::string> paths;
+    for(const auto& variable : results.variables) {
+        paths.insert(variable->getSourceFilePathName());
+    }
+    for(const auto& array : results.arrays) {
+        paths.insert(array->getSourceFilePathName());
+    }
+    for(const auto& structure : results.structs) {
+        for(const auto& element : structure->getElements()) {
+            paths.insert(element->getSourceFilePathName());
+        }
+    }
+    paths.erase(std::string());
+    return std::vector<std::string>(paths.begin(), paths.end());
+}
+
+bool ParseCache::readU8(uint64_t& position, uint8_t& value) {
+    if(position + 1 > size) {
+        return false;
+    }
+    value = data[position];
+    position += 1;
+    return true;
+}
+
+bool ParseCache::readU32(uint64_t& position, uint32_t& value) {
+    if(position + 4 > size) {
+        return false;
+    }
+    value = 0;
+    for(int i = 0; i < 4; i++) {
+        value |= (uint32_t) data[position + i] << (i * 8);
+    }
+    position += 4;
+    return true;
+}
+
+bool ParseCache::readU64(uint64_t& position, uint64_t& value) {
+    if(position + 8 > size) {
+        return false;
+    }
+    value = 0;
+    for(int i = 0; i < 8; i++) {
+        value |= (uint64_t) data[position + i] << (i * 8);
+    }
+    position += 8;
+    return true;
+}
+
+bool ParseCache::readDouble(uint64_t& position, double& value) {
+    uint64_t raw;
+    if(!readU64(position, raw)) {
+        return false;
+    }
+    std::memcpy(&value, &raw, sizeof(value));
+    return true;
+}
+
+bool ParseCache::readString(uint64_t& position, std::string& str) {
+    uint32_t length;
+    if(!readU32(position, length) || position + length > size) {
+        return false;
+    }
+    str.assign(reinterpret_cast<const char*>(data + position), length);
+    position += length;
+    return true;
+}
@@ -0,0 +1,102 @@
+/**
+*@file parseCache.h
+*@author Michael Wolf
+*@date 19.10.2026
+*@brief Binary cache of the parse results (*.oxpc), stored next to the project file. The cache is valid for the ELF file
+* with the same MD5 hash, the same source path, unchanged source files of the results and the same PARSER_VERSION.
+* It is memory mapped on load, so an unchanged ELF file is not parsed again. All numbers are stored little endian.
+*
+* File layout:
+*   header:  MAGIC, VERSION, PARSER_VERSION, ELF file hash, source path
+*   sources: source file count, per file: path, size, last modification (ms since epoch)
+*   results: variable count, variables, array count, arrays, struct count, structs
+*   result:  kind, name, address, size, datatype, abstract datatype, source file, source line, source comment,
+*            array: elements, size per element, struct: element count, elements
+*/
+
+#ifndef PARSECACHE_H
+#define PARSECACHE_H
+
+#include "parseResultVariable.h"
+#include "parseResultArray.h"
+#include "parseResultStruct.h"
+
+#include <string>
+#include <vector>
+#include <memory>
+#include <stdint.h>
+
+namespace PARSE_CACHE {
+const char MAGIC[] =                        "OXPCACHE";
+const uint32_t MAGIC_SIZE =                 8;
+const uint32_t VERSION =                    1;
+const uint32_t PARSER_VERSION =             1;           /* increase when the parsers produce different results */
+const char FILE_SUFFIX[] =                  "oxpc";
+
+const uint8_t KIND_VARIABLE =               0;
+const uint8_t KIND_ARRAY =                  1;
+const uint8_t KIND_STRUCT =                 2;
+
+const uint8_t SOURCE_NONE =                 0;
+const uint8_t SOURCE_MEASUREMENT =          1;
+const uint8_t SOURCE_CHARACTERISTIC =       2;
+}
+
+class ParseCache {
+  public:
+    struct Results {
+        std::vector<std::shared_ptr<ParseResultVariable>> variables;
+        std::vector<std::shared_ptr<ParseResultArray>> arrays;
+        std::vector<std::shared_ptr<ParseResultStruct>> structs;
+    };
+
+    /**
+     * @param elfFileHash MD5 of the ELF file as hex string.
+     * @param sourcePath workspace source path of the parse.
+     */
+    ParseCache(const std::string& filePathName, const std::string& elfFileHash, const std::string& sourcePath);
+
+    /**
+     * @brief load reads the results if the cache is valid for the ELF file hash, the source path and the source files.
+     * @return false if there is no valid cache, results is unchanged.
+     */
+    bool load(Results& results);
+
+    /**
+     * @brief save replaces the cache atomically.
+     */
+    bool save(const Results& results);
+
+    /**
+     * @return cache file of the project file: same directory and name, suffix FILE_SUFFIX. Empty without project file.
+     */
+    static std::string getFilePathName(const std::string& projectFilePathName);
+
+  private:
+    struct SourceFile {
+        std::string path;
+        uint64_t size;
+        int64_t lastModified;
+    };
+
+    static SourceFile readSourceFile(const std::string& path);
+    static std::vector<std::string> collectSourcePaths(const Results& results);
+
+    void writeResult(std::string& buffer, const ParseResultBase& result, const uint8_t kind);
+    std::shared_ptr<ParseResultBase> readResult(uint64_t& position, uint8_t& kind);
+    bool readSourceParserObj(uint64_t& position, ParseResultBase& result);
+
+    bool readU8(uint64_t& position, uint8_t& value);
+    bool readU32(uint64_t& position, uint32_t& value);
+    bool readU64(uint64_t& position, uint64_t& value);
+    bool readDouble(uint64_t& position, double& value);
+    bool readString(uint64_t& position, std::string& str);
+
+    std::string filePathName;
+    std::string elfFileHash;
+    std::string sourcePath;
+    const uint8_t* data; // mapped file while loading
+    uint64_t size;
+};
+
+#endif // PARSECACHE_H
@@ -48,6 +48,28 @@ void ParserManager::parse() {
     emit sigParseProgress(90);
 }
 
+bool ParserManager::loadCache(const string& cacheFilePathName, const string& elfFileHash) {
+    ParseCache parseCache(cacheFilePathName, elfFileHash, workspaceSourcePath);
+    ParseCache::Results results;
+    if(!parseCache.load(results)) {
+        return false;
+    }
+    variables = results.variables;
+    arrays = results.arrays;
+    structs = results.structs;
+    emit sigParseProgress(90);
+    return true;
+}
+
+bool ParserManager::saveCache(const string& cacheFilePathName, const string& elfFileHash) const {
+    ParseCache parseCache(cacheFilePathName, elfFileHash, workspaceSourcePath);
+    ParseCache::Results results;
+    results.variables = variables;
+    results.arrays = arrays;
+    results.structs = structs;
+    return parseCache.save(results);
+}
+
 bool ParserManager::isInLocalWorkspace(const string& path) {
     return (path.find(workspaceSourcePath) != string::npos);
 }
@@ -15,6 +15,7 @@
 #include "parseResultVariable.h"
 #include "parseResultArray.h"
 #include "parseResultStruct.h"
+#include "parseCache.h"
 
 #include <string>
 #include <memory>
@@ -32,6 +33,14 @@ class ParserManager : public QObject {
     ParserManager(const string& elfFileName, const string& workspaceSourcePath);
     void parse();
 
+    /**
+     * @brief loadCache reads the results of a previous parse of the same ELF file instead of parsing, see ParseCache.
+     * @param elfFileHash MD5 of the ELF file as hex string.
+     * @return false if the cache is missing or not valid, parse() is required.
+     */
+    bool loadCache(const string& cacheFilePathName, const string& elfFileHash);
+    bool saveCache(const string& cacheFilePathName, const string& elfFileHash) const;
+
     vector<shared_ptr<ParseResultVariable>> getVariables() const;
     vector<shared_ptr<ParseResultArray>> getArrays() const;
     vector<shared_ptr<ParseResultStruct>> getStructs() const;
@@ -0,0 +1,216 @@
+/**
+*@file symbolIndex.cpp
+*@author Michael Wolf
+*@date 19.10.2026
+*@brief Case-insensitive substring search over the names of the parse results. SymbolIndex is a trigram index: a query
+* only verifies the names which contain all trigrams of the query. SymbolSearch builds the index and runs the queries
+* in a background thread, the results are taken in batches while the query is running.
+*/
+
+#include "symbolIndex.h"
+
+#include <algorithm>
+#include <iterator>
+#include <cctype>
+
+namespace {
+const size_t NAMES_PER_CANCEL_CHECK = 8192;
+}
+
+/***************************************************************
+*  SymbolIndex
+****************************************************************/
+void SymbolIndex::build(const std::vector<std::string>& names) {
+    this->names.clear();
+    this->names.reserve(names.size());
+    postings.clear();
+    for(uint32_t id = 0; id < names.size(); id++) {
+        this->names.push_back(toLower(names[id]));
+        const std::string& name = this->names.back();
+        for(size_t position = 0; position + GRAM_SIZE <= name.size(); position++) {
+            std::vector<uint32_t>& ids = postings[gramKey(name.data() + position)];
+            if(ids.empty() || ids.back() != id) {
+                ids.push_back(id);
+            }
+        }
+    }
+}
+
+/**
+ * The posting lists of the trigrams of the query are intersected, starting with the shortest. The remaining candidates
+ * contain all trigrams, the substring itself is verified on the name.
+ */
+bool SymbolIndex::query(const std::string& text, const size_t batchSize, const Batch& batch) const {
+    std::string lowerText = toLower(text);
+    if(lowerText.size() < GRAM_SIZE) {
+        std::vector<uint32_t> ids;
+        for(uint32_t id = 0; id < names.size(); id++) {
+            if(names[id].find(lowerText) != std::string::npos) {
+                ids.push_back(id);
+            }
+            if(ids.size() >= batchSize || (id + 1) % NAMES_PER_CANCEL_CHECK == 0) {
+                if(!batch(ids)) {
+                    return false;
+                }
+                ids.clear();
+            }
+        }
+        return ids.empty() || batch(ids);
+    }
+
+    std::vector<const std::vector<uint32_t>*> lists;
+    for(size_t position = 0; position + GRAM_SIZE <= lowerText.size(); position++) {
+        auto iterator = postings.find(gramKey(lowerText.data() + position));
+        if(iterator == postings.end()) {
+            return true; // a trigram which no name contains
+        }
+        lists.push_back(&iterator->second);
+    }
+    std::sort(lists.begin(), lists.end(), [](const std::vector<uint32_t>* a, const std::vector<uint32_t>* b) {
+        return a->size() < b->size();
+    });
+    lists.erase(std::unique(lists.begin(), lists.end()), lists.end());
+    std::vector<uint32_t> candidates(*lists.front());
+    std::vector<uint32_t> intersection;
+    for(size_t list = 1; list < lists.size() && !candidates.empty(); list++) {
+        intersection.clear();
+        std::set_intersection(candidates.begin(), candidates.end(), lists[list]->begin(), lists[list]->end(), std::back_inserter(intersection));
+        candidates.swap(intersection);
+    }
+    return emitIds(candidates, lowerText, batchSize, batch);
+}
+
+size_t SymbolIndex::getSize() const {
+    return names.size();
+}
+
+bool SymbolIndex::emitIds(const std::vector<uint32_t>& candidates, const std::string& text, const size_t batchSize, const Batch& batch) const {
+    std::vector<uint32_t> ids;
+    for(size_t candidate = 0; candidate < candidates.size(); candidate++) {
+        uint32_t id = candidates[candidate];
+        if(names[id].find(text) != std::string::npos) {
+            ids.push_back(id);
+        }
+        if(ids.size() >= batchSize || (candidate + 1) % NAMES_PER_CANCEL_CHECK == 0) {
+            if(!batch(ids)) {
+                return false;
+            }
+            ids.clear();
+        }
+    }
+    return ids.empty() || batch(ids);
+}
+
+uint32_t SymbolIndex::gramKey(const char* text) {
+    return ((uint32_t) (uint8_t) text[0] << 16) | ((uint32_t) (uint8_t) text[1] << 8) | (uint32_t) (uint8_t) text[2];
+}
+
+std::string SymbolIndex::toLower(const std::string& text) {
+    std::string lower(text);
+    for(char& character : lower) {
+        character = (char) std::tolower((unsigned char) character);
+    }
+    return lower;
+}
+
+/***************************************************************
+*  SymbolSearch
+****************************************************************/
+SymbolSearch::SymbolSearch()
+    : isStopRequested(false),
+      isBuildPending(false),
+      isQueryPending(false),
+      pendingGeneration(0),
+      generation(0),
+      resultGeneration(0),
+      isQueryFinished(true) {
+
+    worker = std::thread(&SymbolSearch::workerLoop, this);
+}
+
+SymbolSearch::~SymbolSearch() {
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        isStopRequested = true;
+        generation++; // cancels a running query
+    }
+    condition.notify_one();
+    worker.join();
+}
+
+void SymbolSearch::build(std::vector<std::string> names) {
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        pendingNames.swap(names);
+        isBuildPending = true;
+    }
+    condition.notify_one();
+}
+
+uint64_t SymbolSearch::search(const std::string& text) {
+    uint64_t queryGeneration;
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        queryGeneration = ++generation;
+        queryText = text;
+        pendingGeneration = queryGeneration;
+        isQueryPending = true;
+    }
+    condition.notify_one();
+    return queryGeneration;
+}
+
+bool SymbolSearch::takeResults(const uint64_t generation, std::vector<uint32_t>& results) {
+    std::lock_guard<std::mutex> lock(mutex);
+    if(resultGeneration != generation) {
+        return this->generation.load() == generation; // not started yet, or replaced by a newer query
+    }
+    results.insert(results.end(), this->results.begin(), this->results.end());
+    this->results.clear();
+    return !isQueryFinished;
+}
+
+/**
+ * A pending build runs before a pending query, so a query started after build() runs on the new index.
+ */
+void SymbolSearch::workerLoop() {
+    std::unique_lock<std::mutex> lock(mutex);
+    while(true) {
+        condition.wait(lock, [this] {
+            return isStopRequested || isBuildPending || isQueryPending;
+        });
+        if(isStopRequested) {
+            return;
+        }
+        if(isBuildPending) {
+            std::vector<std::string> names;
+            names.swap(pendingNames);
+            isBuildPending = false;
+            lock.unlock();
+            index.build(names);
+            lock.lock();
+            continue;
+        }
+        std::string text = queryText;
+        uint64_t queryGeneration = pendingGeneration;
+        isQueryPending = false;
+        resultGeneration = queryGeneration;
+        results.clear();
+        isQueryFinished = false;
+        lock.unlock();
+        index.query(text, BATCH_SIZE, [this, queryGeneration](const std::vector<uint32_t>& ids) {
+            if(generation.load() != queryGeneration) {
+                return false;
+            }
+            if(!ids.empty()) {
+                std::lock_guard<std::mutex> batchLock(mutex);
+                results.insert(results.end(), ids.begin(), ids.end());
+            }
+            return true;
+        });
+        lock.lock();
+        if(resultGeneration == queryGeneration) {
+            isQueryFinished = true;
+        }
+    }
+}
@@ -0,0 +1,104 @@
+/**
+*@file symbolIndex.h
+*@author Michael Wolf
+*@date 19.10.2026
+*@brief Case-insensitive substring search over the names of the parse results. SymbolIndex is a trigram index: a query
+* only verifies the names which contain all trigrams of the query. SymbolSearch builds the index and runs the queries
+* in a background thread, the results are taken in batches while the query is running.
+*/
+
+#ifndef SYMBOLINDEX_H
+#define SYMBOLINDEX_H
+
+#include <string>
+#include <vector>
+#include <unordered_map>
+#include <functional>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <atomic>
+#include <stdint.h>
+#include <stddef.h>
+
+class SymbolIndex {
+  public:
+    static const size_t GRAM_SIZE = 3;
+
+    /**
+     * @brief Batch receives the ids of the matching names in ascending order. Returns false to cancel the query.
+     */
+    typedef std::function<bool(const std::vector<uint32_t>& ids)> Batch;
+
+    /**
+     * @brief build indexes the names, the id of a name is its index.
+     */
+    void build(const std::vector<std::string>& names);
+
+    /**
+     * @brief query finds the names which contain the text, case-insensitive. Queries shorter than GRAM_SIZE scan all names.
+     * @param batchSize ids per call of the batch function.
+     * @return false if the batch function cancelled the query.
+     */
+    bool query(const std::string& text, const size_t batchSize, const Batch& batch) const;
+
+    size_t getSize() const;
+
+  private:
+    static uint32_t gramKey(const char* text);
+    static std::string toLower(const std::string& text);
+
+    bool emitIds(const std::vector<uint32_t>& candidates, const std::string& text, const size_t batchSize, const Batch& batch) const;
+
+    std::vector<std::string> names; // lower case
+    std::unordered_map<uint32_t, std::vector<uint32_t>> postings; // trigram: ids in ascending order
+};
+
+class SymbolSearch {
+  public:
+    static const size_t BATCH_SIZE = 512;
+
+    SymbolSearch();
+    ~SymbolSearch();
+
+    SymbolSearch(const SymbolSearch&) = delete;
+    SymbolSearch& operator=(const SymbolSearch&) = delete;
+
+    /**
+     * @brief build replaces the names, the index is built in the background after a running query.
+     * Queries started after build() run on the new index.
+     */
+    void build(std::vector<std::string> names);
+
+    /**
+     * @brief search starts a query in the background, a running query is cancelled.
+     * @return generation of the query, see takeResults().
+     */
+    uint64_t search(const std::string& text);
+
+    /**
+     * @brief takeResults moves the ids found since the last call to results, ascending within a query.
+     * @return false if the query of the generation is finished and all results are taken.
+     */
+    bool takeResults(const uint64_t generation, std::vector<uint32_t>& results);
+
+  private:
+    void workerLoop();
+
+    SymbolIndex index;
+    std::thread worker;
+    std::mutex mutex;
+    std::condition_variable condition;
+    bool isStopRequested;
+    bool isBuildPending;
+    std::vector<std::string> pendingNames;
+    bool isQueryPending;
+    std::string queryText;
+    uint64_t pendingGeneration; // of queryText
+    std::atomic<uint64_t> generation; // of the latest query, a running query stops when it changes
+    uint64_t resultGeneration; // of the ids in results
+    std::vector<uint32_t> results;
+    bool isQueryFinished;
+};
+
+#endif // SYMBOLINDEX_H
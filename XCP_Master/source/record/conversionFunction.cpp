@@ -0,0 +1,521 @@
+/**
+*@file conversionFunction.cpp
+*@author Michael Wolf
+*@date 19.10.2026
+*@brief Conversion of a raw value to the physical value, from the @XCP_ConversionFunction of the source comment.
+* The text is compiled once into coefficients, a table or a small postfix program and evaluated in batches.
+*/
+
+#include "conversionFunction.h"
+
+#include <cctype>
+#include <cmath>
+#include <cstdlib>
+#include <algorithm>
+#include <sstream>
+
+namespace {
+const size_t MAX_STACK_DEPTH = 32;
+const size_t BATCH_SIZE = 256; // values per instruction of a formula
+
+std::string toUpper(std::string str) {
+    std::transform(str.begin(), str.end(), str.begin(), [](char c) {
+        return (char) std::toupper((unsigned char) c);
+    });
+    return str;
+}
+
+bool toNumber(const std::string& str, double& number) {
+    char* end;
+    number = std::strtod(str.c_str(), &end);
+    return !str.empty() && *end == '\0';
+}
+}
+
+ConversionFunction::ConversionFunction()
+    : type(TYPE::IDENTITY),
+      maxStackDepth(0),
+      tokenIndex(0),
+      stackDepth(0) {
+
+}
+
+/**
+ * A text which starts with a keyword followed by numbers only is a keyword conversion, everything else is a formula.
+ */
+bool ConversionFunction::compile(const std::string& text) {
+    this->text = text;
+    type = TYPE::IDENTITY;
+    error.clear();
+    parameters.clear();
+    tableX.clear();
+    tableY.clear();
+    program.clear();
+
+    std::istringstream stream(text);
+    std::string keyword, word;
+    stream >> keyword;
+    std::vector<double> numbers;
+    bool isNumbers = true;
+    while(stream >> word) {
+        double number;
+        isNumbers = isNumbers && toNumber(word, number);
+        numbers.push_back(number);
+    }
+
+    bool isCompiled;
+    static const std::string KEYWORDS[] = {"NO_COMPU_METHOD", "IDENTICAL", "LINEAR", "RAT_FUNC", "TAB_INTP", "TAB_NOINTP"};
+    keyword = toUpper(keyword);
+    if(keyword.empty()) {
+        isCompiled = true;
+    } else if(std::find(std::begin(KEYWORDS), std::end(KEYWORDS), keyword) != std::end(KEYWORDS)) {
+        isCompiled = isNumbers ? compileKeyword(keyword, numbers) : fail(keyword + " needs numeric parameters");
+    } else {
+        isCompiled = compileFormula(text);
+    }
+    if(!isCompiled) {
+        type = TYPE::IDENTITY;
+        parameters.clear();
+        tableX.clear();
+        tableY.clear();
+        program.clear();
+    }
+    return isCompiled;
+}
+
+double ConversionFunction::convert(const double raw) const {
+    switch (type) {
+    case TYPE::IDENTITY:
+        return raw;
+    case TYPE::LINEAR:
+        return parameters[0] * raw + parameters[1];
+    case TYPE::RATIONAL:
+        return ((parameters[0] * raw + parameters[1]) * raw + parameters[2]) / ((parameters[3] * raw + parameters[4]) * raw + parameters[5]);
+    case TYPE::TABLE_INTERPOLATED:
+    case TYPE::TABLE_NEAREST:
+        return convertTable(raw);
+    case TYPE::FORMULA:
+        return executeProgram(raw);
+    }
+    return raw;
+}
+
+void ConversionFunction::convert(const double* raw, double* physical, const size_t count) const {
+    switch (type) {
+    case TYPE::IDENTITY:
+        if(raw != physical) {
+            std::copy(raw, raw + count, physical);
+        }
+        return;
+    case TYPE::LINEAR: {
+        const double factor = parameters[0];
+        const double offset = parameters[1];
+        for(size_t i = 0; i < count; i++) {
+            physical[i] = factor * raw[i] + offset;
+        }
+        return;
+    }
+    case TYPE::RATIONAL: {
+        const double p1 = parameters[0], p2 = parameters[1], p3 = parameters[2];
+        const double p4 = parameters[3], p5 = parameters[4], p6 = parameters[5];
+        for(size_t i = 0; i < count; i++) {
+            const double x = raw[i];
+            physical[i] = ((p1 * x + p2) * x + p3) / ((p4 * x + p5) * x + p6);
+        }
+        return;
+    }
+    case TYPE::TABLE_INTERPOLATED:
+    case TYPE::TABLE_NEAREST:
+        for(size_t i = 0; i < count; i++) {
+            physical[i] = convertTable(raw[i]);
+        }
+        return;
+    case TYPE::FORMULA:
+        executeProgram(raw, physical, count);
+        return;
+    }
+}
+
+ConversionFunction::TYPE ConversionFunction::getType() const {
+    return type;
+}
+
+bool ConversionFunction::getIsIdentity() const {
+    return type == TYPE::IDENTITY;
+}
+
+std::string ConversionFunction::getText() const {
+    return text;
+}
+
+std::string ConversionFunction::getError() const {
+    return error;
+}
+
+const std::vector<double>& ConversionFunction::getParameters() const {
+    return parameters;
+}
+
+/***************************************************************
+*  Keyword conversions
+****************************************************************/
+/**
+ * RAT_FUNC describes the raw value as function of the physical value like the A2L COEFFS. With a = d = 0 the inverse
+ * is again a rational function: p = (c - f x) / (e x - b).
+ */
+bool ConversionFunction::compileKeyword(const std::string& keyword, const std::vector<double>& numbers) {
+    if(keyword == "NO_COMPU_METHOD" || keyword == "IDENTICAL") {
+        return numbers.empty() ? true : fail(keyword + " has no parameters");
+    }
+    if(keyword == "LINEAR") {
+        if(numbers.size() != 2) {
+            return fail("LINEAR needs 2 coefficients");
+        }
+        type = TYPE::LINEAR;
+        parameters = numbers;
+        return true;
+    }
+    if(keyword == "RAT_FUNC") {
+        if(numbers.size() != 6) {
+            return fail("RAT_FUNC needs 6 coefficients");
+        }
+        double a = numbers[0], b = numbers[1], c = numbers[2], d = numbers[3], e = numbers[4], f = numbers[5];
+        if(a != 0.0 || d != 0.0) {
+            return fail("RAT_FUNC with quadratic terms has no unique inverse");
+        }
+        if(e == 0.0 && b == 0.0) {
+            return fail("RAT_FUNC does not depend on the physical value");
+        }
+        type = TYPE::RATIONAL;
+        parameters = {0.0, -f, c, 0.0, e, -b};
+        return true;
+    }
+
+    // tables
+    if(numbers.size() < 2 || numbers.size() % 2 != 0) {
+        return fail(keyword + " needs pairs of raw and physical values");
+    }
+    std::vector<std::pair<double, double>> points;
+    for(size_t i = 0; i < numbers.size(); i += 2) {
+        points.push_back(std::make_pair(numbers[i], numbers[i + 1]));
+    }
+    std::stable_sort(points.begin(), points.end(), [](const std::pair<double, double>& a, const std::pair<double, double>& b) {
+        return a.first < b.first;
+    });
+    for(const auto& point : points) {
+        tableX.push_back(point.first);
+        tableY.push_back(point.second);
+        parameters.push_back(point.first);
+        parameters.push_back(point.second);
+    }
+    type = (keyword == "TAB_INTP") ? TYPE::TABLE_INTERPOLATED : TYPE::TABLE_NEAREST;
+    return true;
+}
+
+/**
+ * Binary search for the interval of the raw value. Outside the table the first or last value is used,
+ * without interpolation the nearer point wins, the lower one on a tie.
+ */
+double ConversionFunction::convertTable(const double raw) const {
+    if(std::isnan(raw)) {
+        return raw;
+    }
+    size_t upper = std::upper_bound(tableX.begin(), tableX.end(), raw) - tableX.begin();
+    if(upper == 0) {
+        return tableY.front();
+    }
+    if(upper == tableX.size()) {
+        return tableY.back();
+    }
+    size_t lower = upper - 1;
+    double x0 = tableX[lower], x1 = tableX[upper];
+    if(type == TYPE::TABLE_NEAREST) {
+        return (raw - x0 <= x1 - raw) ? tableY[lower] : tableY[upper];
+    }
+    return tableY[lower] + (tableY[upper] - tableY[lower]) * (raw - x0) / (x1 - x0);
+}
+
+/***************************************************************
+*  Formula
+****************************************************************/
+bool ConversionFunction::compileFormula(const std::string& text) {
+    maxStackDepth = 0;
+    stackDepth = 0;
+    tokenIndex = 0;
+    bool isCompiled = tokenize(text) && parseSum();
+    if(isCompiled && tokens[tokenIndex].type != TOKEN::END) {
+        isCompiled = fail("unexpected '" + tokens[tokenIndex].text + "'");
+    }
+    tokens.clear();
+    if(isCompiled) {
+        type = TYPE::FORMULA;
+    }
+    return isCompiled;
+}
+
+double ConversionFunction::executeProgram(const double raw) const {
+    double physical;
+    executeProgram(&raw, &physical, 1);
+    return physical;
+}
+
+/**
+ * The program is executed for a batch of values at once: every instruction is a loop over the batch, so the cost
+ * of the dispatch is shared by the batch. The stack holds one batch per level.
+ */
+void ConversionFunction::executeProgram(const double* raw, double* physical, const size_t count) const {
+    double stack[MAX_STACK_DEPTH * BATCH_SIZE];
+    for(size_t first = 0; first < count; first += BATCH_SIZE) {
+        const size_t n = std::min(BATCH_SIZE, count - first);
+        const double* x = raw + first;
+        size_t top = 0;
+        for(const auto& instruction : program) {
+            double* result = stack + (top > 0 ? top - 1 : 0) * BATCH_SIZE; // unary operators: operand and result
+            double* left = stack + (top > 1 ? top - 2 : 0) * BATCH_SIZE; // binary operators: left operand and result
+            const double* right = result;
+            switch (instruction.op) {
+            case OP::CONSTANT:
+                std::fill(stack + top * BATCH_SIZE, stack + top * BATCH_SIZE + n, instruction.constant);
+                top++;
+                continue;
+            case OP::VARIABLE:
+                std::copy(x, x + n, stack + top * BATCH_SIZE);
+                top++;
+                continue;
+            case OP::ADD:
+                for(size_t i = 0; i < n; i++) { left[i] += right[i]; }
+                break;
+            case OP::SUB:
+                for(size_t i = 0; i < n; i++) { left[i] -= right[i]; }
+                break;
+            case OP::MUL:
+                for(size_t i = 0; i < n; i++) { left[i] *= right[i]; }
+                break;
+            case OP::DIV:
+                for(size_t i = 0; i < n; i++) { left[i] /= right[i]; }
+                break;
+            case OP::POW:
+                for(size_t i = 0; i < n; i++) { left[i] = std::pow(left[i], right[i]); }
+                break;
+            case OP::NEG:
+                for(size_t i = 0; i < n; i++) { result[i] = -result[i]; }
+                continue;
+            case OP::SQRT:
+                for(size_t i = 0; i < n; i++) { result[i] = std::sqrt(result[i]); }
+                continue;
+            case OP::EXP:
+                for(size_t i = 0; i < n; i++) { result[i] = std::exp(result[i]); }
+                continue;
+            case OP::LOG:
+                for(size_t i = 0; i < n; i++) { result[i] = std::log(result[i]); }
+                continue;
+            case OP::ABS:
+                for(size_t i = 0; i < n; i++) { result[i] = std::fabs(result[i]); }
+                continue;
+            case OP::SIN:
+                for(size_t i = 0; i < n; i++) { result[i] = std::sin(result[i]); }
+                continue;
+            case OP::COS:
+                for(size_t i = 0; i < n; i++) { result[i] = std::cos(result[i]); }
+                continue;
+            case OP::TAN:
+                for(size_t i = 0; i < n; i++) { result[i] = std::tan(result[i]); }
+                continue;
+            }
+            top--; // binary operators replace two values by one
+        }
+        std::copy(stack, stack + n, physical + first);
+    }
+}
+
+/***************************************************************
+*  Compiler
+****************************************************************/
+bool ConversionFunction::tokenize(const std::string& text) {
+    tokens.clear();
+    size_t i = 0;
+    while(i < text.size()) {
+        char c = text[i];
+        if(std::isspace((unsigned char) c)) {
+            i++;
+            continue;
+        }
+        Token token;
+        token.number = 0.0;
+        if(std::isdigit((unsigned char) c) || (c == '.' && i + 1 < text.size() && std::isdigit((unsigned char) text[i + 1]))) {
+            char* end;
+            token.type = TOKEN::NUMBER;
+            token.number = std::strtod(text.c_str() + i, &end);
+            size_t length = end - (text.c_str() + i);
+            token.text = text.substr(i, length);
+            i += length;
+        } else if(std::isalpha((unsigned char) c) || c == '_') {
+            size_t start = i;
+            while(i < text.size() && (std::isalnum((unsigned char) text[i]) || text[i] == '_')) {
+                i++;
+            }
+            token.type = TOKEN::NAME;
+            token.text = text.substr(start, i - start);
+        } else if(c == '(' || c == ')') {
+            token.type = (c == '(') ? TOKEN::OPEN : TOKEN::CLOSE;
+            token.text = std::string(1, c);
+            i++;
+        } else if(c == '+' || c == '-' || c == '*' || c == '/' || c == '^') {
+            token.type = TOKEN::OPERATOR;
+            token.text = std::string(1, c);
+            i++;
+        } else {
+            return fail("unexpected character '" + std::string(1, c) + "'");
+        }
+        tokens.push_back(token);
+    }
+    Token end;
+    end.type = TOKEN::END;
+    end.text = "end of formula";
+    end.number = 0.0;
+    tokens.push_back(end);
+    return true;
+}
+
+bool ConversionFunction::parseSum() {
+    if(!parseProduct()) {
+        return false;
+    }
+    while(isOperator('+') || isOperator('-')) {
+        OP op = isOperator('+') ? OP::ADD : OP::SUB;
+        tokenIndex++;
+        if(!parseProduct()) {
+            return false;
+        }
+        emitOp(op);
+    }
+    return true;
+}
+
+bool ConversionFunction::parseProduct() {
+    if(!parseUnary()) {
+        return false;
+    }
+    while(isOperator('*') || isOperator('/')) {
+        OP op = isOperator('*') ? OP::MUL : OP::DIV;
+        tokenIndex++;
+        if(!parseUnary()) {
+            return false;
+        }
+        emitOp(op);
+    }
+    return true;
+}
+
+bool ConversionFunction::parseUnary() {
+    if(isOperator('-') || isOperator('+')) {
+        bool isNegative = isOperator('-');
+        tokenIndex++;
+        if(!parseUnary()) {
+            return false;
+        }
+        if(isNegative) {
+            emitOp(OP::NEG);
+        }
+        return true;
+    }
+    return parsePower();
+}
+
+/**
+ * ^ binds stronger than the unary minus and is right associative: -X^2 is -(X^2), 2^3^2 is 2^(3^2).
+ */
+bool ConversionFunction::parsePower() {
+    if(!parsePrimary()) {
+        return false;
+    }
+    if(isOperator('^')) {
+        tokenIndex++;
+        if(!parseUnary()) {
+            return false;
+        }
+        emitOp(OP::POW);
+    }
+    return true;
+}
+
+bool ConversionFunction::parsePrimary() {
+    const Token& token = tokens[tokenIndex];
+    switch (token.type) {
+    case TOKEN::NUMBER:
+        tokenIndex++;
+        emitOp(OP::CONSTANT, token.number);
+        break;
+    case TOKEN::NAME: {
+        static const struct {
+            const char* name;
+            OP op;
+        } functions[] = {{"sqrt", OP::SQRT}, {"exp", OP::EXP}, {"log", OP::LOG}, {"abs", OP::ABS}, {"sin", OP::SIN},
+            {"cos", OP::COS}, {"tan", OP::TAN}
+        };
+        tokenIndex++;
+        std::string name = toUpper(token.text);
+        if(name == "X" || name == "X1") {
+            emitOp(OP::VARIABLE);
+            break;
+        }
+        for(const auto& function : functions) {
+            if(token.text == function.name) {
+                if(tokens[tokenIndex].type != TOKEN::OPEN) {
+                    return fail("missing '(' after " + token.text);
+                }
+                tokenIndex++;
+                if(!parseSum()) {
+                    return false;
+                }
+                if(tokens[tokenIndex].type != TOKEN::CLOSE) {
+                    return fail("missing ')'");
+                }
+                tokenIndex++;
+                emitOp(function.op);
+                return true;
+            }
+        }
+        return fail("unknown name '" + token.text + "'");
+    }
+    case TOKEN::OPEN:
+        tokenIndex++;
+        if(!parseSum()) {
+            return false;
+        }
+        if(tokens[tokenIndex].type != TOKEN::CLOSE) {
+            return fail("missing ')'");
+        }
+        tokenIndex++;
+        return true;
+    default:
+        return fail("unexpected '" + token.text + "'");
+    }
+    if(maxStackDepth > MAX_STACK_DEPTH) {
+        return fail("formula too complex");
+    }
+    return true;
+}
+
+bool ConversionFunction::isOperator(const char op) const {
+    const Token& token = tokens[tokenIndex];
+    return token.type == TOKEN::OPERATOR && token.text[0] == op;
+}
+
+void ConversionFunction::emitOp(const OP op, const double constant) {
+    Instruction instruction = {op, constant};
+    program.push_back(instruction);
+    if(op == OP::CONSTANT || op == OP::VARIABLE) {
+        stackDepth++;
+        maxStackDepth = std::max(maxStackDepth, stackDepth);
+    } else if(op == OP::ADD || op == OP::SUB || op == OP::MUL || op == OP::DIV || op == OP::POW) {
+        stackDepth--; // binary operators replace two values by one
+    }
+}
+
+bool ConversionFunction::fail(const std::string& error) {
+    if(this->error.empty()) {
+        this->error = error;
+    }
+    return false;
+}
@@ -0,0 +1,104 @@
+/**
+*@file conversionFunction.h
+*@author Michael Wolf
+*@date 19.10.2026
+*@brief Conversion of a raw value to the physical value, from the @XCP_ConversionFunction of the source comment.
+* The text is compiled once into coefficients, a table or a small postfix program and evaluated in batches.
+*/
+
+#ifndef CONVERSIONFUNCTION_H
+#define CONVERSIONFUNCTION_H
+
+#include <vector>
+#include <string>
+#include <stdint.h>
+#include <stddef.h>
+
+/**
+ * Syntax of the conversion text, x is the raw value:
+ *   empty, NO_COMPU_METHOD, IDENTICAL    physical = x
+ *   LINEAR a b                           physical = a * x + b (A2L COEFFS_LINEAR)
+ *   RAT_FUNC a b c d e f                 x = (a * p^2 + b * p + c) / (d * p^2 + e * p + f) (A2L COEFFS), a = d = 0
+ *   TAB_INTP x0 y0 x1 y1 ...             table, linear interpolation between the points, clamped at the ends
+ *   TAB_NOINTP x0 y0 x1 y1 ...           table, value of the nearest point
+ *   formula in X (or X1)                 e.g. "X * 0.1 - 40", operators + - * / ^, sqrt exp log abs sin cos tan
+ */
+class ConversionFunction {
+  public:
+    enum class TYPE {IDENTITY, LINEAR, RATIONAL, TABLE_INTERPOLATED, TABLE_NEAREST, FORMULA};
+
+    ConversionFunction();
+
+    /**
+     * @brief compile parses the conversion text. On an error the function stays the identity.
+     * @return false on a syntax error, see getError().
+     */
+    bool compile(const std::string& text);
+
+    double convert(const double raw) const;
+
+    /**
+     * @brief convert converts a column of values, raw and physical may be the same array. Linear and rational
+     * functions are branch-free loops, a formula executes every instruction for a batch of values.
+     */
+    void convert(const double* raw, double* physical, const size_t count) const;
+
+    TYPE getType() const;
+    bool getIsIdentity() const;
+    std::string getText() const;
+    std::string getError() const;
+
+    /**
+     * @return LINEAR: factor, offset. RATIONAL: p1..p6 of physical = (p1 x^2 + p2 x + p3) / (p4 x^2 + p5 x + p6).
+     * Tables: x0, y0, x1, y1, ... sorted by x.
+     */
+    const std::vector<double>& getParameters() const;
+
+  private:
+    enum class OP : uint8_t {CONSTANT, VARIABLE, ADD, SUB, MUL, DIV, POW, NEG, SQRT, EXP, LOG, ABS, SIN, COS, TAN};
+
+    struct Instruction {
+        OP op;
+        double constant;
+    };
+
+    enum class TOKEN {NUMBER, NAME, OPERATOR, OPEN, CLOSE, END};
+
+    struct Token {
+        TOKEN type;
+        std::string text;
+        double number;
+    };
+
+    bool compileKeyword(const std::string& keyword, const std::vector<double>& numbers);
+    bool compileFormula(const std::string& text);
+    double convertTable(const double raw) const;
+    double executeProgram(const double raw) const;
+    void executeProgram(const double* raw, double* physical, const size_t count) const;
+
+    bool tokenize(const std::string& text);
+    bool parseSum();
+    bool parseProduct();
+    bool parseUnary();
+    bool parsePower();
+    bool parsePrimary();
+    bool isOperator(const char op) const;
+    void emitOp(const OP op, const double constant = 0.0);
+    bool fail(const std::string& error);
+
+    TYPE type;
+    std::string text;
+    std::string error;
+    std::vector<double> parameters;
+    std::vector<double> tableX; // sorted
+    std::vector<double> tableY;
+    std::vector<Instruction> program;
+    size_t maxStackDepth;
+
+    // compiler state
+    std::vector<Token> tokens;
+    size_t tokenIndex;
+    size_t stackDepth;
+};
+
+#endif // CONVERSIONFUNCTION_H
@@ -0,0 +1,461 @@
+/**
+*@file csvExporter.cpp
+*@author Michael Wolf
+*@date 19.10.2026
+*@brief Exports a sample store to a CSV file in the background. The rows are formatted in blocks by several threads
+* into reusable char buffers, the blocks are written to the file in order. The export can be cancelled.
+* The rows are either the samples grouped by millisecond or the signals resampled on a common time base (see Resampler).
+* A recording file is exported window by window (see RecordWindowReader), without loading the recording into memory.
+*/
+
+#include "csvExporter.h"
+
+#include <deque>
+#include <algorithm>
+#include <future>
+#include <cstdio>
+#include <cinttypes>
+#include <limits>
+
+namespace {
+const char SEPARATOR = ';';
+const char* const EMPTY_CELL = " ";
+const double EPSILON_ONE_MS = 0.001; // samples within one millisecond share a row
+
+void appendText(std::vector<char>& buffer, const char* text, const int size) {
+    if(size > 0) {
+        buffer.insert(buffer.end(), text, text + size);
+    }
+}
+}
+
+CsvExporter::CsvExporter(const size_t rowsPerBlock, const unsigned threadCount)
+    : rowsPerBlock(rowsPerBlock),
+      threadCount(threadCount > 0 ? threadCount : std::max(1u, std::thread::hardware_concurrency())),
+      rowTimeLimit(std::numeric_limits<double>::infinity()),
+      sourceProgress(0),
+      windowTimeLimit(std::numeric_limits<double>::infinity()),
+      hasLastTime(false),
+      lastTime(0.0),
+      file(nullptr),
+      state((int) State::Idle),
+      isCancelRequested(false),
+      progress(0),
+      rowsWritten(0) {
+
+}
+
+CsvExporter::~CsvExporter() {
+    cancel();
+    wait();
+}
+
+bool CsvExporter::start(const std::shared_ptr<const SampleStore>& sampleStore, const std::string& path, const std::string& preamble,
+                        const Resampler::Settings& resampleSettings) {
+    if(!openFile(path)) {
+        return false;
+    }
+    this->sampleStore = sampleStore;
+    windowReader.reset();
+    startThread(path, preamble, resampleSettings, sampleStore->getSignalTable());
+    return true;
+}
+
+/**
+ * The previous sample of every signal is needed for the interpolation, the next one only for the linear interpolation.
+ */
+bool CsvExporter::startFromRecordFile(const std::string& recordPath, const std::string& path, const std::string& preamble,
+                                      const Resampler::Settings& resampleSettings) {
+    const bool isResampled = (resampleSettings.timeBase != Resampler::TIME_BASE::SAMPLES);
+    const bool isLinear = isResampled && (resampleSettings.interpolation == Resampler::INTERPOLATION::LINEAR);
+    std::unique_ptr<RecordWindowReader> reader(new RecordWindowReader());
+    if(!reader->open(recordPath, isResampled, isLinear) || !openFile(path)) {
+        return false;
+    }
+    windowReader = std::move(reader);
+    sampleStore.reset();
+    startThread(path, preamble, resampleSettings, windowReader->getSignalTable());
+    return true;
+}
+
+void CsvExporter::cancel() {
+    isCancelRequested = true;
+}
+
+CsvExporter::State CsvExporter::wait() {
+    if(exportThread.joinable()) {
+        exportThread.join();
+    }
+    return getState();
+}
+
+CsvExporter::State CsvExporter::getState() const {
+    return (State) state.load();
+}
+
+int CsvExporter::getProgress() const {
+    return progress;
+}
+
+uint64_t CsvExporter::getRowsWritten() const {
+    return rowsWritten;
+}
+
+std::string CsvExporter::getPath() const {
+    return path;
+}
+
+bool CsvExporter::openFile(const std::string& path) {
+    if(getState() == State::Running) {
+        return false;
+    }
+    wait();
+    file = std::fopen(path.c_str(), "wb");
+    return file != nullptr;
+}
+
+void CsvExporter::startThread(const std::string& path, const std::string& preamble, const Resampler::Settings& resampleSettings,
+                              const std::vector<RecordSignal>& signalTable) {
+    this->path = path;
+    this->preamble = preamble;
+    this->resampleSettings = resampleSettings;
+    this->signalTable = signalTable;
+    conversions.assign(signalTable.size(), ConversionFunction());
+    for(size_t signalId = 0; signalId < signalTable.size(); signalId++) {
+        conversions[signalId].compile(signalTable[signalId].conversion);
+    }
+    isCancelRequested = false;
+    progress = 0;
+    rowsWritten = 0;
+    state = (int) State::Running;
+    exportThread = std::thread(&CsvExporter::exportLoop, this);
+}
+
+/***************************************************************
+*  Export thread
+****************************************************************/
+/**
+ * A recording file is exported window by window, all blocks of a window are written before the next window is read.
+ */
+void CsvExporter::exportLoop() {
+    std::string header = preamble + formatSignalNames();
+    bool isWriteOk = std::fwrite(header.data(), 1, header.size(), file) == header.size();
+    sourceProgress = 0;
+    std::vector<Block> blocks(2 * threadCount);
+
+    if(windowReader) {
+        hasLastTime = false;
+        while(isWriteOk && !isCancelRequested && nextWindow()) {
+            isWriteOk = exportBlocks(blocks);
+            consumeWindow();
+        }
+    } else {
+        if(resampleSettings.timeBase == Resampler::TIME_BASE::SAMPLES) {
+            sampleCursors.resize(sampleStore->getSignalCount());
+            for(uint32_t signalId = 0; signalId < sampleCursors.size(); signalId++) {
+                sampleCursors[signalId] = sampleStore->getColumn(signalId).getFirstIndex();
+            }
+            rowTimeLimit = std::numeric_limits<double>::infinity();
+        } else {
+            resampler.reset(new Resampler(*sampleStore, resampleSettings));
+        }
+        isWriteOk = isWriteOk && exportBlocks(blocks);
+    }
+
+    bool isCloseOk = std::fclose(file) == 0;
+    file = nullptr;
+    resampler.reset();
+    sampleStore.reset();
+    window.reset();
+    windowReader.reset();
+
+    if(isCancelRequested) {
+        std::remove(path.c_str());
+        state = (int) State::Cancelled;
+    } else if(!isWriteOk || !isCloseOk) {
+        state = (int) State::Failed;
+    } else {
+        progress = 100;
+        state = (int) State::Finished;
+    }
+}
+
+/**
+ * The export thread prepares the blocks in order, which is cheap: it finds the first sample of every block or generates
+ * the time base. The blocks are formatted by tasks in parallel. At most two blocks per thread are in flight, every block
+ * has its own buffers which are reused.
+ * @return false if the file can not be written.
+ */
+bool CsvExporter::exportBlocks(std::vector<Block>& blocks) {
+    bool isWriteOk = true;
+    const size_t maxBlocksInFlight = blocks.size();
+    struct Task {
+        std::future<void> result;
+        Block* block;
+        int progress; // progress when the block is written
+    };
+    std::deque<Task> tasks;
+    size_t nextBlock = 0;
+    bool isEnd = false;
+
+    while(isWriteOk && !isCancelRequested) {
+        while(!isEnd && tasks.size() < maxBlocksInFlight) {
+            Block* block = &blocks[nextBlock];
+            if(!prepareBlock(*block)) {
+                isEnd = true;
+                break;
+            }
+            Task task;
+            task.block = block;
+            task.progress = sourceProgress;
+            task.result = std::async(std::launch::async, [this, block]() {
+                formatBlock(*block);
+            });
+            tasks.push_back(std::move(task));
+            nextBlock = (nextBlock + 1) % maxBlocksInFlight;
+        }
+        if(tasks.empty()) {
+            break;
+        }
+
+        Task& task = tasks.front();
+        task.result.get();
+        const std::vector<char>& text = task.block->text;
+        isWriteOk = std::fwrite(text.data(), 1, text.size(), file) == text.size();
+        rowsWritten += task.block->rowCount;
+        progress = task.progress;
+        tasks.pop_front();
+    }
+
+    for(auto& task : tasks) { // cancelled or write error
+        task.result.wait();
+    }
+    return isWriteOk;
+}
+
+/**
+ * Rows of samples are complete if no sample within one millisecond can follow in the next window. A resampled time
+ * needs all samples up to it, the previous sample and, for the linear interpolation, the next sample of every signal.
+ * @return false if the recording file is exported.
+ */
+bool CsvExporter::nextWindow() {
+    resampler.reset(); // refers to the window
+    if(!window) {
+        window = std::make_shared<SampleStore>();
+    }
+    sampleStore.reset();
+    if(!windowReader->nextWindow(*window, windowTimeLimit)) {
+        return false;
+    }
+    sampleStore = window;
+    if(resampleSettings.timeBase == Resampler::TIME_BASE::SAMPLES) {
+        sampleCursors.resize(window->getSignalCount());
+        for(uint32_t signalId = 0; signalId < sampleCursors.size(); signalId++) {
+            sampleCursors[signalId] = windowReader->getPendingFirst(signalId);
+        }
+        rowTimeLimit = windowTimeLimit - EPSILON_ONE_MS;
+    } else {
+        Resampler::Window range;
+        range.hasTimeFrom = hasLastTime;
+        range.timeFrom = lastTime;
+        range.timeTo = windowTimeLimit;
+        range.hasRecordingRange = windowReader->getHasSamples();
+        range.recordingFirst = windowReader->getTimeFirst();
+        range.recordingLast = windowReader->getTimeLast();
+        resampler.reset(new Resampler(*window, resampleSettings, range));
+    }
+    return true;
+}
+
+/**
+ * SAMPLES: the samples up to the cursors are written. Resampled: the samples before the time limit are not needed
+ * any more, except the last one which is the previous sample of the next window.
+ */
+void CsvExporter::consumeWindow() {
+    for(uint32_t signalId = 0; signalId < window->getSignalCount(); signalId++) {
+        size_t pendingFirst = windowReader->getPendingFirst(signalId);
+        size_t end;
+        if(resampleSettings.timeBase == Resampler::TIME_BASE::SAMPLES) {
+            end = sampleCursors[signalId];
+        } else {
+            end = window->getColumn(signalId).lowerBound(windowTimeLimit);
+        }
+        windowReader->consume(signalId, end > pendingFirst ? end - pendingFirst : 0);
+    }
+}
+
+/**
+ * Sequential part of a block, runs in the export thread.
+ * @return false if all rows are prepared.
+ */
+bool CsvExporter::prepareBlock(Block& block) {
+    if(resampler) {
+        block.times.clear();
+        block.rowCount = resampler->nextTimes(block.times, rowsPerBlock);
+        sourceProgress = (int) (resampler->getProgress() * 100);
+        if(block.rowCount > 0) {
+            hasLastTime = true;
+            lastTime = block.times.back();
+        }
+    } else {
+        block.cursors = sampleCursors;
+        block.rowCount = skipRows(sampleCursors, rowsPerBlock);
+        uint64_t samplesTotal = sampleStore->getSampleCount();
+        uint64_t samplesDone = 0;
+        for(uint32_t signalId = 0; signalId < sampleCursors.size(); signalId++) {
+            samplesDone += sampleCursors[signalId] - sampleStore->getColumn(signalId).getFirstIndex();
+        }
+        sourceProgress = samplesTotal > 0 ? (int) (samplesDone * 100 / samplesTotal) : 100;
+    }
+    if(windowReader) {
+        sourceProgress = windowReader->getProgress();
+    }
+    return block.rowCount > 0;
+}
+
+void CsvExporter::formatBlock(Block& block) const {
+    block.text.clear(); // keeps the capacity of the previous block
+    if(resampleSettings.timeBase == Resampler::TIME_BASE::SAMPLES) {
+        formatSampleRows(block);
+    } else {
+        formatResampledRows(block);
+    }
+}
+
+/***************************************************************
+*  Rows
+****************************************************************/
+/**
+ * The time of the next row is the earliest sample which is not written yet.
+ * @return false if all samples are written.
+ */
+bool CsvExporter::getRowTime(const std::vector<size_t>& cursors, double& rowTime) const {
+    bool isSampleLeft = false;
+    for(uint32_t signalId = 0; signalId < cursors.size(); signalId++) {
+        const SampleColumn& column = sampleStore->getColumn(signalId);
+        if(cursors[signalId] < column.getSize()) {
+            double time = column.getTime(cursors[signalId]);
+            if(!isSampleLeft || time < rowTime) {
+                rowTime = time;
+            }
+            isSampleLeft = true;
+        }
+    }
+    return isSampleLeft;
+}
+
+size_t CsvExporter::skipRows(std::vector<size_t>& cursors, const size_t rowCount) const {
+    size_t rows = 0;
+    double rowTime = 0.0;
+    while(rows < rowCount && getRowTime(cursors, rowTime) && rowTime < rowTimeLimit) {
+        for(uint32_t signalId = 0; signalId < cursors.size(); signalId++) {
+            const SampleColumn& column = sampleStore->getColumn(signalId);
+            if(cursors[signalId] < column.getSize() && (column.getTime(cursors[signalId]) - rowTime) <= EPSILON_ONE_MS) {
+                cursors[signalId]++;
+            }
+        }
+        rows++;
+    }
+    return rows;
+}
+
+/**
+ * A block uses at most rowCount samples of every signal from its cursor on. These samples are converted to physical
+ * values column by column before the rows are formatted.
+ */
+void CsvExporter::convertSampleColumns(Block& block) const {
+    const size_t rowCount = block.rowCount;
+    block.firstCursors = block.cursors;
+    block.values.resize(rowCount * block.cursors.size());
+    for(uint32_t signalId = 0; signalId < block.cursors.size(); signalId++) {
+        if(conversions[signalId].getIsIdentity()) {
+            continue;
+        }
+        const SampleColumn& column = sampleStore->getColumn(signalId);
+        const size_t first = block.cursors[signalId];
+        const size_t count = std::min(rowCount, column.getSize() - first);
+        double* values = block.values.data() + signalId * rowCount;
+        for(size_t i = 0; i < count; i++) {
+            values[i] = column.getValueAsDouble(first + i);
+        }
+        conversions[signalId].convert(values, values, count);
+    }
+}
+
+void CsvExporter::formatSampleRows(Block& block) const {
+    convertSampleColumns(block);
+    std::vector<size_t>& cursors = block.cursors;
+    std::vector<char>& buffer = block.text;
+    char number[64];
+    double rowTime = 0.0;
+    for(size_t row = 0; row < block.rowCount && getRowTime(cursors, rowTime); row++) {
+        appendText(buffer, number, std::snprintf(number, sizeof(number), "%f", rowTime));
+        for(uint32_t signalId = 0; signalId < cursors.size(); signalId++) {
+            buffer.push_back(SEPARATOR);
+            const SampleColumn& column = sampleStore->getColumn(signalId);
+            size_t& cursor = cursors[signalId];
+            if(cursor < column.getSize() && (column.getTime(cursor) - rowTime) <= EPSILON_ONE_MS) {
+                if(!conversions[signalId].getIsIdentity()) {
+                    double value = block.values[signalId * block.rowCount + (cursor - block.firstCursors[signalId])];
+                    appendText(buffer, number, std::snprintf(number, sizeof(number), "%g", value));
+                } else if(column.getIsFloat()) {
+                    appendText(buffer, number, std::snprintf(number, sizeof(number), "%g", column.getValueAsDouble(cursor)));
+                } else if(column.getIsUnsigned()) {
+                    appendText(buffer, number, std::snprintf(number, sizeof(number), "%" PRIu64, (uint64_t) column.getValue(cursor)));
+                } else {
+                    appendText(buffer, number, std::snprintf(number, sizeof(number), "%" PRId64, column.getValue(cursor)));
+                }
+                cursor++;
+            } else {
+                buffer.push_back(EMPTY_CELL[0]); // no sample at this time
+            }
+        }
+        buffer.push_back('\n');
+    }
+}
+
+/**
+ * Every signal is resampled and converted to its physical value for the whole block first (column by column), then the
+ * rows are formatted. Integer signals without conversion which are held keep their integer format, interpolated and
+ * converted values are formatted as floating point numbers.
+ */
+void CsvExporter::formatResampledRows(Block& block) const {
+    const size_t rowCount = block.rowCount;
+    const uint32_t signalCount = (uint32_t) sampleStore->getSignalCount();
+    block.values.resize(rowCount * signalCount);
+    for(uint32_t signalId = 0; signalId < signalCount; signalId++) {
+        double* values = block.values.data() + signalId * rowCount;
+        resampler->resample(signalId, block.times.data(), rowCount, values, block.scratch);
+        conversions[signalId].convert(values, values, rowCount);
+    }
+
+    const bool isLinear = (resampleSettings.interpolation == Resampler::INTERPOLATION::LINEAR);
+    std::vector<char>& buffer = block.text;
+    char number[64];
+    for(size_t row = 0; row < rowCount; row++) {
+        appendText(buffer, number, std::snprintf(number, sizeof(number), "%f", block.times[row]));
+        for(uint32_t signalId = 0; signalId < signalCount; signalId++) {
+            buffer.push_back(SEPARATOR);
+            const SampleColumn& column = sampleStore->getColumn(signalId);
+            double value = block.values[signalId * rowCount + row];
+            if(column.getSize() == column.getFirstIndex() || block.times[row] < column.getTime(column.getFirstIndex())) {
+                buffer.push_back(EMPTY_CELL[0]); // before the first sample of the signal
+            } else if(column.getIsFloat() || isLinear || !conversions[signalId].getIsIdentity()) {
+                appendText(buffer, number, std::snprintf(number, sizeof(number), "%g", value));
+            } else if(column.getIsUnsigned()) {
+                appendText(buffer, number, std::snprintf(number, sizeof(number), "%" PRIu64, (uint64_t) value));
+            } else {
+                appendText(buffer, number, std::snprintf(number, sizeof(number), "%" PRId64, (int64_t) value));
+            }
+        }
+        buffer.push_back('\n');
+    }
+}
+
+std::string CsvExporter::formatSignalNames() const {
+    std::string names = "t[s]";
+    for(const auto& signal : signalTable) {
+        names += SEPARATOR + signal.name + "[" + signal.unit + "]";
+    }
+    return names + "\n";
+}
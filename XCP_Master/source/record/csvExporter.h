@@ -0,0 +1,130 @@
+/**
+*@file csvExporter.h
+*@author Michael Wolf
+*@date 19.10.2026
+*@brief Exports a sample store to a CSV file in the background. The rows are formatted in blocks by several threads
+* into reusable char buffers, the blocks are written to the file in order. The export can be cancelled.
+* The rows are either the samples grouped by millisecond or the signals resampled on a common time base (see Resampler).
+* A recording file is exported window by window (see RecordWindowReader), without loading the recording into memory.
+*/
+
+#ifndef CSVEXPORTER_H
+#define CSVEXPORTER_H
+
+#include "sampleStore.h"
+#include "resampler.h"
+#include "recordWindowReader.h"
+#include "conversionFunction.h"
+
+#include <vector>
+#include <string>
+#include <memory>
+#include <thread>
+#include <atomic>
+#include <cstdio>
+
+class CsvExporter {
+  public:
+    enum class State {Idle, Running, Finished, Cancelled, Failed};
+
+    /**
+     * @param rowsPerBlock rows formatted by one task.
+     * @param threadCount number of formatting threads, 0: one per core.
+     */
+    CsvExporter(const size_t rowsPerBlock = 4096, const unsigned threadCount = 0);
+    ~CsvExporter();
+
+    CsvExporter(const CsvExporter&) = delete;
+    CsvExporter& operator=(const CsvExporter&) = delete;
+
+    /**
+     * @brief start creates the file and starts the export thread. The sample store must not be modified until the export has finished.
+     * @param preamble text written before the signal names, e.g. the date of the recording.
+     * @param resampleSettings time base and interpolation of the rows.
+     * @return false if an export is running or the file can not be created.
+     */
+    bool start(const std::shared_ptr<const SampleStore>& sampleStore, const std::string& path, const std::string& preamble,
+               const Resampler::Settings& resampleSettings = Resampler::Settings());
+
+    /**
+     * @brief startFromRecordFile exports a recording file (*.oxr) which is complete, the memory does not depend on the
+     * length of the recording. The rows are the same as of a sample store with all samples of the file.
+     * @return false if an export is running or one of the files can not be opened.
+     */
+    bool startFromRecordFile(const std::string& recordPath, const std::string& path, const std::string& preamble,
+                             const Resampler::Settings& resampleSettings = Resampler::Settings());
+
+    /**
+     * @brief cancel stops the export after the current blocks, the incomplete file is removed.
+     */
+    void cancel();
+
+    /**
+     * @brief wait joins the export thread.
+     * @return Finished, Cancelled or Failed.
+     */
+    State wait();
+
+    State getState() const;
+    int getProgress() const; // percent of the samples written
+    uint64_t getRowsWritten() const;
+    std::string getPath() const;
+
+  private:
+    /**
+     * @brief The Block struct is the reusable buffer of one block of rows.
+     */
+    struct Block {
+        size_t rowCount = 0;
+        std::vector<size_t> cursors; // samples: first sample of the block per signal
+        std::vector<size_t> firstCursors; // samples: copy of the cursors before formatting
+        std::vector<double> times; // resampled: time base of the block
+        std::vector<double> values; // physical values, one column of rowCount values per signal with a conversion
+        Resampler::Scratch scratch;
+        std::vector<char> text;
+    };
+
+    bool openFile(const std::string& path);
+    void startThread(const std::string& path, const std::string& preamble, const Resampler::Settings& resampleSettings,
+                     const std::vector<RecordSignal>& signalTable);
+    void exportLoop();
+    bool exportBlocks(std::vector<Block>& blocks);
+    bool nextWindow();
+    void consumeWindow();
+    bool prepareBlock(Block& block);
+    void formatBlock(Block& block) const;
+    bool getRowTime(const std::vector<size_t>& cursors, double& rowTime) const;
+    size_t skipRows(std::vector<size_t>& cursors, const size_t rowCount) const;
+    void convertSampleColumns(Block& block) const;
+    void formatSampleRows(Block& block) const;
+    void formatResampledRows(Block& block) const;
+    std::string formatSignalNames() const;
+
+    const size_t rowsPerBlock;
+    const unsigned threadCount;
+    std::shared_ptr<const SampleStore> sampleStore; // the store to export or the current window of the recording file
+    std::string path;
+    std::string preamble;
+    Resampler::Settings resampleSettings;
+    std::vector<RecordSignal> signalTable;
+    std::vector<ConversionFunction> conversions; // index: signal id
+    std::unique_ptr<Resampler> resampler; // time base of the export thread, not used for SAMPLES
+    std::vector<size_t> sampleCursors; // SAMPLES: next sample per signal
+    double rowTimeLimit; // SAMPLES: rows from this time on belong to the next window
+    int sourceProgress; // percent of the rows prepared
+
+    std::unique_ptr<RecordWindowReader> windowReader; // only for a recording file
+    std::shared_ptr<SampleStore> window;
+    double windowTimeLimit; // all samples before this time are in the window
+    bool hasLastTime; // resampled: last time written, the next window continues after it
+    double lastTime;
+    std::FILE* file;
+
+    std::thread exportThread;
+    std::atomic<int> state;
+    std::atomic<bool> isCancelRequested;
+    std::atomic<int> progress;
+    std::atomic<uint64_t> rowsWritten;
+};
+
+#endif // CSVEXPORTER_H
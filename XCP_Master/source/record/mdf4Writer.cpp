@@ -0,0 +1,482 @@
+/**
+*@file mdf4Writer.cpp
+*@author Michael Wolf
+*@date 19.10.2026
+*@brief Streams the samples of a measurement to an ASAM MDF 4.1 file (*.mf4). One channel group per acquisition group
+* (polling, DAQ event channel, STIM event channel). The data blocks are written incrementally, optionally deflate compressed (DZ).
+* The channel metadata is written when the recording is stopped.
+*/
+
+#include "mdf4Writer.h"
+
+#include <QByteArray>
+
+#include <map>
+#include <cstring>
+
+namespace {
+void appendU8(std::vector<uint8_t>& data, const uint8_t value) {
+    data.push_back(value);
+}
+
+void appendU16(std::vector<uint8_t>& data, const uint16_t value) {
+    data.push_back((uint8_t) value);
+    data.push_back((uint8_t) (value >> 8));
+}
+
+void appendU32(std::vector<uint8_t>& data, const uint32_t value) {
+    for(int i = 0; i < 4; i++) {
+        data.push_back((uint8_t) (value >> (i * 8)));
+    }
+}
+
+void appendU64(std::vector<uint8_t>& data, const uint64_t value) {
+    for(int i = 0; i < 8; i++) {
+        data.push_back((uint8_t) (value >> (i * 8)));
+    }
+}
+
+void appendDouble(std::vector<uint8_t>& data, const double value) {
+    uint64_t raw;
+    std::memcpy(&raw, &value, sizeof(raw));
+    appendU64(data, raw);
+}
+
+void appendChars(std::vector<uint8_t>& data, const char* chars, const size_t size) {
+    data.insert(data.end(), chars, chars + size);
+}
+
+void appendReserved(std::vector<uint8_t>& data, const size_t size) {
+    data.insert(data.end(), size, 0);
+}
+
+std::string getAcquisitionName(const uint16_t group) {
+    if(group == RECORD_FILE::GROUP_POLLING) {
+        return "polling";
+    }
+    std::string channel = std::to_string((group & ~RECORD_FILE::GROUP_STIM) - 1);
+    if(group & RECORD_FILE::GROUP_STIM) {
+        return "stim event channel " + channel;
+    }
+    return "event channel " + channel;
+}
+}
+
+Mdf4Writer::Mdf4Writer(const bool isCompressed, const size_t samplesPerChunk, const size_t maxChunks)
+    : RecordWriter(samplesPerChunk, maxChunks),
+      isCompressed(isCompressed),
+      isWriteFailed(false),
+      filePosition(0),
+      headerPosition(0) {
+
+}
+
+Mdf4Writer::~Mdf4Writer() {
+    stop(); // the trailer has to be written before this object is destroyed
+}
+
+/***************************************************************
+*  Header
+****************************************************************/
+bool Mdf4Writer::writeHeader(const int64_t startTimeMsSinceEpoch) {
+    isWriteFailed = false;
+    filePosition = 0;
+    createChannelGroups();
+
+    writeId(false);
+
+    // HD, the first data group is linked by writeTrailer()
+    std::vector<uint64_t> links(6, 0); // dg_first, fh_first, ch_first, at_first, ev_first, md_comment
+    std::vector<uint8_t> data;
+    appendU64(data, (uint64_t) startTimeMsSinceEpoch * 1000000); // hd_start_time_ns, UTC
+    appendU16(data, 0); // hd_tz_offset_min
+    appendU16(data, 0); // hd_dst_offset_min
+    appendU8(data, 0); // hd_time_flags
+    appendU8(data, 0); // hd_time_class
+    appendU8(data, 0); // hd_flags
+    appendReserved(data, 1);
+    appendDouble(data, 0.0); // hd_start_angle_rad
+    appendDouble(data, 0.0); // hd_start_distance_m
+    headerPosition = writeBlock("##HD", links, data);
+
+    // FH, file history, the comment with the tool identification is mandatory
+    uint64_t fhComment = writeText("##MD", "<FHcomment><TX>recording</TX><tool_id>OpenXCP</tool_id>"
+                                   "<tool_vendor>OpenXCP</tool_vendor><tool_version>1.0</tool_version></FHcomment>");
+    links = {0, fhComment};
+    data.clear();
+    appendU64(data, (uint64_t) startTimeMsSinceEpoch * 1000000); // fh_time_ns
+    appendU16(data, 0); // fh_tz_offset_min
+    appendU16(data, 0); // fh_dst_offset_min
+    appendU8(data, 0); // fh_time_flags
+    appendReserved(data, 3);
+    uint64_t fileHistory = writeBlock("##FH", links, data);
+
+    std::vector<uint8_t> link;
+    appendU64(link, fileHistory);
+    writeAt(headerPosition + MDF4::BLOCK_HEADER_SIZE + 8, link); // hd_fh_first
+
+    return !isWriteFailed;
+}
+
+void Mdf4Writer::createChannelGroups() {
+    channelGroups.clear();
+    channelPositions.assign(signalTable.size(), ChannelPosition());
+
+    std::map<uint16_t, size_t> groupIndices; // polling first, then the event channels, then the stim event channels
+    for(const auto& signal : signalTable) {
+        groupIndices.emplace(signal.group, 0);
+    }
+    for(auto& groupIndex : groupIndices) {
+        groupIndex.second = channelGroups.size();
+        ChannelGroup channelGroup;
+        channelGroup.group = groupIndex.first;
+        channelGroup.dataBytes = sizeof(double); // master channel
+        channelGroup.invalBytes = 0;
+        channelGroup.isRecordPending = false;
+        channelGroup.recordTime = 0.0;
+        channelGroup.cycleCount = 0;
+        channelGroup.dataLength = 0;
+        channelGroups.push_back(channelGroup);
+    }
+
+    for(uint32_t signalId = 0; signalId < signalTable.size(); signalId++) {
+        RecordSignal& signal = signalTable[signalId];
+        if(signal.size == 0 || signal.size > sizeof(int64_t)) {
+            signal.size = sizeof(int64_t); // the raw value of a sample has 64 bit
+        }
+        size_t groupIndex = groupIndices.at(signal.group);
+        ChannelGroup& channelGroup = channelGroups[groupIndex];
+        ChannelPosition& position = channelPositions[signalId];
+        position.groupIndex = groupIndex;
+        position.byteOffset = channelGroup.dataBytes;
+        position.invalBitPos = (uint32_t) channelGroup.signalIds.size();
+        channelGroup.dataBytes += signal.size;
+        channelGroup.signalIds.push_back(signalId);
+    }
+
+    for(auto& channelGroup : channelGroups) {
+        channelGroup.invalBytes = (uint32_t) ((channelGroup.signalIds.size() + 7) / 8);
+        channelGroup.record.assign(channelGroup.dataBytes + channelGroup.invalBytes, 0);
+    }
+}
+
+/***************************************************************
+*  Data
+****************************************************************/
+bool Mdf4Writer::writeChunk(const std::vector<RecordSample>& chunk) {
+    for(const auto& sample : chunk) {
+        if(sample.signalId >= channelPositions.size()) {
+            continue;
+        }
+        const ChannelPosition& position = channelPositions[sample.signalId];
+        ChannelGroup& channelGroup = channelGroups[position.groupIndex];
+        uint8_t& invalByte = channelGroup.record[channelGroup.dataBytes + position.invalBitPos / 8];
+        const uint8_t invalBit = (uint8_t) (1 << (position.invalBitPos % 8));
+
+        if(channelGroup.isRecordPending && (channelGroup.recordTime != sample.time || !(invalByte & invalBit))) {
+            closeRecord(channelGroup); // new timestamp or a second sample of the same signal
+        }
+        if(!channelGroup.isRecordPending) {
+            channelGroup.isRecordPending = true;
+            channelGroup.recordTime = sample.time;
+            std::memset(channelGroup.record.data() + channelGroup.dataBytes, 0xFF, channelGroup.invalBytes);
+        }
+
+        uint8_t* value = channelGroup.record.data() + position.byteOffset;
+        for(uint8_t i = 0; i < signalTable[sample.signalId].size; i++) {
+            value[i] = (uint8_t) ((uint64_t) sample.value >> (i * 8));
+        }
+        invalByte &= (uint8_t) ~invalBit;
+    }
+
+    for(auto& channelGroup : channelGroups) {
+        if(channelGroup.isRecordPending) {
+            closeRecord(channelGroup);
+        }
+        if(!channelGroup.records.empty()) {
+            writeDataBlock(channelGroup);
+        }
+    }
+    return !isWriteFailed;
+}
+
+void Mdf4Writer::closeRecord(ChannelGroup& channelGroup) {
+    std::memcpy(channelGroup.record.data(), &channelGroup.recordTime, sizeof(double));
+    channelGroup.records.insert(channelGroup.records.end(), channelGroup.record.begin(), channelGroup.record.end());
+    channelGroup.cycleCount++;
+    channelGroup.isRecordPending = false;
+}
+
+/**
+ * Writes the records of the chunk as DT block. If compression is enabled and reduces the size, a DZ block is written instead.
+ */
+void Mdf4Writer::writeDataBlock(ChannelGroup& channelGroup) {
+    const std::vector<uint8_t>& records = channelGroup.records;
+    uint64_t position = 0;
+    if(isCompressed) {
+        QByteArray compressed = qCompress(records.data(), (int) records.size());
+        static const int SIZE_PREFIX = 4; // qCompress prepends the uncompressed size, the rest is a zlib stream
+        uint64_t compressedSize = (uint64_t) (compressed.size() - SIZE_PREFIX);
+        if(compressed.size() > SIZE_PREFIX && compressedSize < records.size()) {
+            std::vector<uint8_t> data;
+            appendChars(data, "DT", 2); // dz_org_block_type
+            appendU8(data, MDF4::DZ_ZIP_DEFLATE);
+            appendReserved(data, 1);
+            appendU32(data, 0); // dz_zip_parameter
+            appendU64(data, records.size()); // dz_org_data_length
+            appendU64(data, compressedSize); // dz_data_length
+            appendChars(data, compressed.constData() + SIZE_PREFIX, compressedSize);
+            position = writeBlock("##DZ", std::vector<uint64_t>(), data);
+        }
+    }
+    if(position == 0) {
+        position = writeBlock("##DT", std::vector<uint64_t>(), records);
+    }
+    channelGroup.dataBlocks.push_back(position);
+    channelGroup.dataBlockOffsets.push_back(channelGroup.dataLength);
+    channelGroup.dataLength += records.size();
+    channelGroup.records.clear();
+}
+
+/***************************************************************
+*  Trailer
+****************************************************************/
+/**
+ * Writes the data groups with their channel group and channels. The blocks are written from the end of the linked lists,
+ * so every block knows its successor. At last the first data group is linked in the HD block and the file is marked finished.
+ */
+bool Mdf4Writer::writeTrailer() {
+    uint64_t nextDataGroup = 0;
+    for(auto channelGroup = channelGroups.rbegin(); channelGroup != channelGroups.rend(); channelGroup++) {
+        // DL, list of the data blocks
+        uint64_t dataList = 0;
+        if(!channelGroup->dataBlocks.empty()) {
+            std::vector<uint64_t> links;
+            links.push_back(0); // dl_dl_next
+            links.insert(links.end(), channelGroup->dataBlocks.begin(), channelGroup->dataBlocks.end());
+            std::vector<uint8_t> data;
+            appendU8(data, 0); // dl_flags, the blocks have different length
+            appendReserved(data, 3);
+            appendU32(data, (uint32_t) channelGroup->dataBlocks.size());
+            for(uint64_t offset : channelGroup->dataBlockOffsets) {
+                appendU64(data, offset);
+            }
+            dataList = writeBlock("##DL", links, data);
+        }
+
+        // CN, value channels
+        uint64_t nextChannel = 0;
+        for(auto signalId = channelGroup->signalIds.rbegin(); signalId != channelGroup->signalIds.rend(); signalId++) {
+            const RecordSignal& signal = signalTable[*signalId];
+            const ChannelPosition& position = channelPositions[*signalId];
+            uint64_t name = writeText("##TX", signal.name);
+            uint64_t unit = signal.unit.empty() ? 0 : writeText("##TX", signal.unit);
+            uint64_t comment = signal.comment.empty() ? 0 : writeText("##TX", signal.comment);
+            uint64_t conversion = writeConversion(conversions[*signalId]);
+            std::vector<uint64_t> links = {nextChannel, 0, name, 0, conversion, 0, unit, comment};
+            bool isLimitValid = signal.lowerLimit < signal.upperLimit;
+            uint8_t dataType = MDF4::CN_DATA_SIGNED_LE;
+            if(signal.isFloat) {
+                dataType = MDF4::CN_DATA_FLOAT_LE;
+            } else if(signal.isUnsigned) {
+                dataType = MDF4::CN_DATA_UNSIGNED_LE;
+            }
+            std::vector<uint8_t> data;
+            appendU8(data, MDF4::CN_TYPE_VALUE);
+            appendU8(data, MDF4::CN_SYNC_NONE);
+            appendU8(data, dataType);
+            appendU8(data, 0); // cn_bit_offset
+            appendU32(data, position.byteOffset);
+            appendU32(data, (uint32_t) signal.size * 8); // cn_bit_count
+            appendU32(data, MDF4::CN_FLAG_INVAL_BIT_VALID | (isLimitValid ? MDF4::CN_FLAG_LIMIT_VALID : 0));
+            appendU32(data, position.invalBitPos);
+            appendU8(data, 0); // cn_precision
+            appendReserved(data, 1);
+            appendU16(data, 0); // cn_attachment_count
+            appendDouble(data, 0.0); // cn_val_range_min
+            appendDouble(data, 0.0); // cn_val_range_max
+            appendDouble(data, isLimitValid ? signal.lowerLimit : 0.0); // cn_limit_min
+            appendDouble(data, isLimitValid ? signal.upperLimit : 0.0); // cn_limit_max
+            appendDouble(data, 0.0); // cn_limit_ext_min
+            appendDouble(data, 0.0); // cn_limit_ext_max
+            nextChannel = writeBlock("##CN", links, data);
+        }
+
+        // CN, master channel
+        uint64_t name = writeText("##TX", "t");
+        uint64_t unit = writeText("##TX", "s");
+        std::vector<uint64_t> links = {nextChannel, 0, name, 0, 0, 0, unit, 0};
+        std::vector<uint8_t> data;
+        appendU8(data, MDF4::CN_TYPE_MASTER);
+        appendU8(data, MDF4::CN_SYNC_TIME);
+        appendU8(data, MDF4::CN_DATA_FLOAT_LE);
+        appendU8(data, 0); // cn_bit_offset
+        appendU32(data, 0); // cn_byte_offset
+        appendU32(data, sizeof(double) * 8); // cn_bit_count
+        appendU32(data, 0); // cn_flags
+        appendU32(data, 0); // cn_inval_bit_pos
+        appendU8(data, 0); // cn_precision
+        appendReserved(data, 1);
+        appendU16(data, 0); // cn_attachment_count
+        appendReserved(data, 6 * sizeof(double)); // value range and limits
+        uint64_t masterChannel = writeBlock("##CN", links, data);
+
+        // CG
+        uint64_t acquisitionName = writeText("##TX", getAcquisitionName(channelGroup->group));
+        links = {0, masterChannel, acquisitionName, 0, 0, 0}; // cg_cg_next, cg_cn_first, cg_tx_acq_name, cg_si_acq_source, cg_sr_first, cg_md_comment
+        data.clear();
+        appendU64(data, 0); // cg_record_id
+        appendU64(data, channelGroup->cycleCount);
+        appendU16(data, 0); // cg_flags
+        appendU16(data, 0); // cg_path_separator
+        appendReserved(data, 4);
+        appendU32(data, channelGroup->dataBytes);
+        appendU32(data, channelGroup->invalBytes);
+        uint64_t group = writeBlock("##CG", links, data);
+
+        // DG, sorted: one channel group, no record id
+        links = {nextDataGroup, group, dataList, 0}; // dg_dg_next, dg_cg_first, dg_data, dg_md_comment
+        data.clear();
+        appendU8(data, 0); // dg_rec_id_size
+        appendReserved(data, 7);
+        nextDataGroup = writeBlock("##DG", links, data);
+    }
+
+    std::vector<uint8_t> link;
+    appendU64(link, nextDataGroup);
+    writeAt(headerPosition + MDF4::BLOCK_HEADER_SIZE, link); // hd_dg_first
+
+    if(isWriteFailed) {
+        return false; // the file stays marked unfinished
+    }
+    if(std::fflush(file) != 0 || std::fseek(file, 0, SEEK_SET) != 0) {
+        return false;
+    }
+    writeId(true);
+    return !isWriteFailed;
+}
+
+/***************************************************************
+*  Blocks
+****************************************************************/
+/**
+ * Writes the ID block at the start of the file. An unfinished file has to be finalized by the reader (cycle counters).
+ */
+void Mdf4Writer::writeId(const bool isFinished) {
+    std::vector<uint8_t> data;
+    appendChars(data, isFinished ? MDF4::ID_FILE : MDF4::ID_FILE_UNFINISHED, 8);
+    appendChars(data, MDF4::ID_VERSION, 8);
+    appendChars(data, MDF4::ID_PROGRAM, 8);
+    appendReserved(data, 4);
+    appendU16(data, MDF4::VERSION);
+    appendReserved(data, 30);
+    appendU16(data, isFinished ? 0 : MDF4::UNFIN_FLAG_CYCLE_COUNT); // id_unfin_flags
+    appendU16(data, 0); // id_custom_unfin_flags
+    writeBytes(data.data(), data.size());
+    if(!isFinished) {
+        filePosition = MDF4::ID_BLOCK_SIZE;
+    }
+}
+
+/**
+ * Writes a block at the end of the file, blocks start at 8 byte boundaries.
+ * @return file position of the block.
+ */
+uint64_t Mdf4Writer::writeBlock(const char* id, const std::vector<uint64_t>& links, const std::vector<uint8_t>& data) {
+    uint64_t position = filePosition;
+    uint64_t length = MDF4::BLOCK_HEADER_SIZE + links.size() * sizeof(uint64_t) + data.size();
+    std::vector<uint8_t> header;
+    appendChars(header, id, 4);
+    appendReserved(header, 4);
+    appendU64(header, length);
+    appendU64(header, links.size());
+    for(uint64_t link : links) {
+        appendU64(header, link);
+    }
+    writeBytes(header.data(), header.size());
+    writeBytes(data.data(), data.size());
+
+    static const uint8_t padding[8] = {0};
+    size_t paddingSize = (size_t) ((8 - length % 8) % 8);
+    writeBytes(padding, paddingSize);
+    filePosition += length + paddingSize;
+    return position;
+}
+
+/**
+ * Overwrites data of a written block, e.g. a link, and returns to the end of the file.
+ */
+void Mdf4Writer::writeAt(const uint64_t position, const std::vector<uint8_t>& data) {
+    if(std::fseek(file, (long) position, SEEK_SET) != 0) {
+        isWriteFailed = true;
+        return;
+    }
+    writeBytes(data.data(), data.size());
+    if(std::fseek(file, (long) filePosition, SEEK_SET) != 0) {
+        isWriteFailed = true;
+    }
+}
+
+/**
+ * A failed write is latched, the writer reports it and does not finalize the file.
+ */
+void Mdf4Writer::writeBytes(const void* data, const size_t size) {
+    if(size > 0 && std::fwrite(data, 1, size, file) != size) {
+        isWriteFailed = true;
+    }
+}
+
+/**
+ * Writes a TX or MD block, the text is zero terminated UTF-8.
+ */
+uint64_t Mdf4Writer::writeText(const char* id, const std::string& text) {
+    std::vector<uint8_t> data(text.begin(), text.end());
+    data.push_back(0);
+    return writeBlock(id, std::vector<uint64_t>(), data);
+}
+
+/**
+ * CC block of a channel, the parameters of the conversion are stored as the MDF4 values. The identity needs no block.
+ * MDF4 linear: physical = P2 * x + P1.
+ */
+uint64_t Mdf4Writer::writeConversion(const ConversionFunction& conversion) {
+    std::vector<double> values;
+    std::vector<uint64_t> links = {0, 0, 0, 0}; // cc_tx_name, cc_md_unit, cc_md_comment, cc_cc_inverse
+    uint8_t type;
+    switch (conversion.getType()) {
+    case ConversionFunction::TYPE::LINEAR:
+        type = MDF4::CC_TYPE_LINEAR;
+        values = {conversion.getParameters()[1], conversion.getParameters()[0]};
+        break;
+    case ConversionFunction::TYPE::RATIONAL:
+        type = MDF4::CC_TYPE_RATIONAL;
+        values = conversion.getParameters();
+        break;
+    case ConversionFunction::TYPE::TABLE_INTERPOLATED:
+        type = MDF4::CC_TYPE_TABLE_INTERPOLATED;
+        values = conversion.getParameters();
+        break;
+    case ConversionFunction::TYPE::TABLE_NEAREST:
+        type = MDF4::CC_TYPE_TABLE;
+        values = conversion.getParameters();
+        break;
+    case ConversionFunction::TYPE::FORMULA:
+        type = MDF4::CC_TYPE_ALGEBRAIC;
+        links.push_back(writeText("##TX", conversion.getText())); // cc_ref, the formula
+        break;
+    default:
+        return 0;
+    }
+    std::vector<uint8_t> data;
+    appendU8(data, type);
+    appendU8(data, 0); // cc_precision
+    appendU16(data, 0); // cc_flags
+    appendU16(data, (uint16_t) (links.size() - 4)); // cc_ref_count
+    appendU16(data, (uint16_t) values.size());
+    appendDouble(data, 0.0); // cc_phy_range_min
+    appendDouble(data, 0.0); // cc_phy_range_max
+    for(double value : values) {
+        appendDouble(data, value);
+    }
+    return writeBlock("##CC", links, data);
+}
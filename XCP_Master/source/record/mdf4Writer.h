@@ -0,0 +1,98 @@
+/**
+*@file mdf4Writer.h
+*@author Michael Wolf
+*@date 19.10.2026
+*@brief Streams the samples of a measurement to an ASAM MDF 4.1 file (*.mf4). One channel group per acquisition group
+* (polling, DAQ event channel, STIM event channel). The data blocks are written incrementally, optionally deflate compressed (DZ).
+* The channel metadata is written when the recording is stopped.
+*/
+
+#ifndef MDF4WRITER_H
+#define MDF4WRITER_H
+
+#include "recordWriter.h"
+
+namespace MDF4 {
+const char ID_FILE[] =                      "MDF     ";
+const char ID_FILE_UNFINISHED[] =           "UnFinMF ";
+const char ID_VERSION[] =                   "4.10    ";
+const char ID_PROGRAM[] =                   "OpenXCP ";
+const uint16_t VERSION =                    410;
+const uint32_t ID_BLOCK_SIZE =              64;
+const uint32_t BLOCK_HEADER_SIZE =          24;
+const uint16_t UNFIN_FLAG_CYCLE_COUNT =     0x0001;
+
+const uint8_t CN_TYPE_VALUE =               0;
+const uint8_t CN_TYPE_MASTER =              2;
+const uint8_t CN_SYNC_NONE =                0;
+const uint8_t CN_SYNC_TIME =                1;
+const uint8_t CN_DATA_UNSIGNED_LE =         0;
+const uint8_t CN_DATA_SIGNED_LE =           2;
+const uint8_t CN_DATA_FLOAT_LE =            4;
+const uint32_t CN_FLAG_INVAL_BIT_VALID =    0x02;
+const uint32_t CN_FLAG_LIMIT_VALID =        0x10;
+
+const uint8_t CC_TYPE_LINEAR =              1;
+const uint8_t CC_TYPE_RATIONAL =            2;
+const uint8_t CC_TYPE_ALGEBRAIC =           3;
+const uint8_t CC_TYPE_TABLE_INTERPOLATED =  4;
+const uint8_t CC_TYPE_TABLE =               5;
+
+const uint8_t DZ_ZIP_DEFLATE =              0;
+}
+
+class Mdf4Writer : public RecordWriter {
+  public:
+    Mdf4Writer(const bool isCompressed = false, const size_t samplesPerChunk = 8192, const size_t maxChunks = 32);
+    ~Mdf4Writer();
+
+  protected:
+    bool writeHeader(const int64_t startTimeMsSinceEpoch) override;
+    bool writeChunk(const std::vector<RecordSample>& chunk) override;
+    bool writeTrailer() override;
+
+  private:
+    /**
+     * Record layout of a channel group: time (double), values (little endian, signal size), invalidation bytes.
+     * A record holds the samples of one timestamp, signals without a new sample keep their last value and are marked invalid.
+     */
+    struct ChannelGroup {
+        uint16_t group;
+        std::vector<uint32_t> signalIds;
+        uint32_t dataBytes;
+        uint32_t invalBytes;
+        std::vector<uint8_t> record;
+        bool isRecordPending;
+        double recordTime;
+        std::vector<uint8_t> records; // closed records of the current chunk
+        uint64_t cycleCount;
+        std::vector<uint64_t> dataBlocks; // file position of the DT/DZ blocks
+        std::vector<uint64_t> dataBlockOffsets; // offset in the uncompressed data section
+        uint64_t dataLength;
+    };
+
+    struct ChannelPosition {
+        size_t groupIndex;
+        uint32_t byteOffset;
+        uint32_t invalBitPos;
+    };
+
+    void createChannelGroups();
+    void closeRecord(ChannelGroup& channelGroup);
+    void writeDataBlock(ChannelGroup& channelGroup);
+    uint64_t writeBlock(const char* id, const std::vector<uint64_t>& links, const std::vector<uint8_t>& data);
+    uint64_t writeText(const char* id, const std::string& text);
+    uint64_t writeConversion(const ConversionFunction& conversion);
+    void writeId(const bool isFinished);
+    void writeAt(const uint64_t position, const std::vector<uint8_t>& data);
+    void writeBytes(const void* data, const size_t size);
+
+    const bool isCompressed;
+    bool isWriteFailed; // a write or seek failed, the file is not finalized
+    uint64_t filePosition;
+    uint64_t headerPosition;
+    std::vector<ChannelGroup> channelGroups;
+    std::vector<ChannelPosition> channelPositions; // index: signal id
+};
+
+#endif // MDF4WRITER_H
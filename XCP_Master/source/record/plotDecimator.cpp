@@ -0,0 +1,120 @@
+/**
+*@file plotDecimator.cpp
+*@author Michael Wolf
+*@date 19.10.2026
+*@brief Reduces the samples of a time range to the points a plot with a given pixel width can show. The cost depends on
+* the pixel width, not on the number of samples in the range.
+*/
+
+#include "plotDecimator.h"
+
+#include <cmath>
+#include <algorithm>
+
+void PlotDecimator::decimate(const MODE mode, const SampleColumn& column, const SummaryPyramid& pyramid, const double timeBegin, const double timeEnd,
+                             const size_t pixelCount, std::vector<PlotPoint>& points) {
+    points.clear();
+    if(mode == MODE::MIN_MAX) {
+        minMax(column, pyramid, timeBegin, timeEnd, pixelCount, points);
+        return;
+    }
+    size_t first = column.lowerBound(timeBegin);
+    size_t last = column.lowerBound(timeEnd);
+    std::vector<PlotPoint> input;
+    if(last - first <= pixelCount * LTTB_RAW_POINTS_PER_PIXEL) {
+        input.reserve(last - first + 2);
+        for(size_t index = (first > column.getFirstIndex() ? first - 1 : first); index < std::min(last + 1, column.getSize()); index++) {
+            addSample(column, pyramid, index, input);
+        }
+    } else {
+        minMax(column, pyramid, timeBegin, timeEnd, pixelCount, input);
+    }
+    lttb(input, pixelCount, points);
+}
+
+/**
+ * Within a pixel column the min and the max are ordered so that the line continues with the value which is closer to the
+ * previous point, this avoids zigzag lines on smooth signals.
+ */
+void PlotDecimator::minMax(const SampleColumn& column, const SummaryPyramid& pyramid, const double timeBegin, const double timeEnd,
+                           const size_t pixelCount, std::vector<PlotPoint>& points) {
+    size_t first = column.lowerBound(timeBegin);
+    size_t last = column.lowerBound(timeEnd);
+    if(first > column.getFirstIndex()) {
+        addSample(column, pyramid, first - 1, points);
+    }
+    if(pixelCount == 0 || timeEnd <= timeBegin || last - first <= pixelCount * RAW_POINTS_PER_PIXEL) {
+        for(size_t index = first; index < last; index++) {
+            addSample(column, pyramid, index, points);
+        }
+    } else {
+        double pixelTime = (timeEnd - timeBegin) / pixelCount;
+        size_t pixelFirst = first;
+        for(size_t pixel = 0; pixel < pixelCount; pixel++) {
+            size_t pixelLast = (pixel + 1 == pixelCount) ? last : column.lowerBound(timeBegin + (pixel + 1) * pixelTime);
+            double min, max;
+            if(pyramid.getRange(column, pixelFirst, pixelLast, min, max)) {
+                double time = timeBegin + (pixel + 0.5) * pixelTime;
+                bool isMaxFirst = !points.empty() && std::fabs(points.back().value - max) < std::fabs(points.back().value - min);
+                PlotPoint low = {time, min};
+                PlotPoint high = {time, max};
+                points.push_back(isMaxFirst ? high : low);
+                if(max != min) {
+                    points.push_back(isMaxFirst ? low : high);
+                }
+            }
+            pixelFirst = pixelLast;
+        }
+    }
+    if(last < column.getSize()) {
+        addSample(column, pyramid, last, points);
+    }
+}
+
+void PlotDecimator::lttb(const std::vector<PlotPoint>& input, const size_t threshold, std::vector<PlotPoint>& output) {
+    output.clear();
+    if(threshold < 3 || input.size() <= threshold) {
+        output = input;
+        return;
+    }
+    output.reserve(threshold);
+    output.push_back(input.front());
+    double bucketSize = (double) (input.size() - 2) / (threshold - 2);
+    size_t selected = 0;
+    for(size_t bucket = 0; bucket < threshold - 2; bucket++) {
+        size_t bucketFirst = (size_t) (bucket * bucketSize) + 1;
+        size_t bucketLast = (size_t) ((bucket + 1) * bucketSize) + 1;
+
+        // average of the next bucket, the last point for the last bucket
+        size_t nextFirst = bucketLast;
+        size_t nextLast = std::min((size_t) ((bucket + 2) * bucketSize) + 1, input.size());
+        double averageTime = 0.0, averageValue = 0.0;
+        for(size_t index = nextFirst; index < nextLast; index++) {
+            averageTime += input[index].time;
+            averageValue += input[index].value;
+        }
+        size_t nextCount = nextLast - nextFirst;
+        averageTime /= nextCount;
+        averageValue /= nextCount;
+
+        const PlotPoint& previous = input[selected];
+        double maxArea = -1.0;
+        size_t maxIndex = bucketFirst;
+        for(size_t index = bucketFirst; index < bucketLast; index++) {
+            double area = std::fabs((previous.time - averageTime) * (input[index].value - previous.value)
+                                    - (previous.time - input[index].time) * (averageValue - previous.value));
+            if(area > maxArea) {
+                maxArea = area;
+                maxIndex = index;
+            }
+        }
+        output.push_back(input[maxIndex]);
+        selected = maxIndex;
+    }
+    output.push_back(input.back());
+}
+
+void PlotDecimator::addSample(const SampleColumn& column, const SummaryPyramid& pyramid, const size_t index, std::vector<PlotPoint>& points) {
+    PlotPoint point = {column.getTime(index), pyramid.getValue(column, index)};
+    points.push_back(point);
+}
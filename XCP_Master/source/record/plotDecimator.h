@@ -0,0 +1,54 @@
+/**
+*@file plotDecimator.h
+*@author Michael Wolf
+*@date 19.10.2026
+*@brief Reduces the samples of a time range to the points a plot with a given pixel width can show. The cost depends on
+* the pixel width, not on the number of samples in the range.
+*/
+
+#ifndef PLOTDECIMATOR_H
+#define PLOTDECIMATOR_H
+
+#include "sampleStore.h"
+#include "summaryPyramid.h"
+
+#include <vector>
+#include <stddef.h>
+
+struct PlotPoint {
+    double time;
+    double value;
+};
+
+class PlotDecimator {
+  public:
+    enum class MODE {MIN_MAX, LTTB};
+
+    static const size_t RAW_POINTS_PER_PIXEL = 2;   // up to this density the samples are drawn as they are
+    static const size_t LTTB_RAW_POINTS_PER_PIXEL = 8; // up to this density LTTB runs on the samples, above on the min/max envelope
+
+    /**
+     * @brief decimate points of the samples in [timeBegin, timeEnd], plus the sample before and after the range so the line
+     * leaves the plot. The values are physical values, converted by the pyramid before they are decimated.
+     */
+    static void decimate(const MODE mode, const SampleColumn& column, const SummaryPyramid& pyramid, const double timeBegin, const double timeEnd,
+                         const size_t pixelCount, std::vector<PlotPoint>& points);
+
+    /**
+     * @brief minMax the samples if they fit, otherwise the min and the max of every pixel column from the pyramid:
+     * at most 2 * pixelCount + 2 points, O(pixelCount * log(samples)).
+     */
+    static void minMax(const SampleColumn& column, const SummaryPyramid& pyramid, const double timeBegin, const double timeEnd,
+                       const size_t pixelCount, std::vector<PlotPoint>& points);
+
+    /**
+     * @brief lttb Largest-Triangle-Three-Buckets: keeps the first and the last point and of every bucket the point which
+     * spans the largest triangle with its neighbours. Preserves the visual shape with threshold points, O(input).
+     */
+    static void lttb(const std::vector<PlotPoint>& input, const size_t threshold, std::vector<PlotPoint>& output);
+
+  private:
+    static void addSample(const SampleColumn& column, const SummaryPyramid& pyramid, const size_t index, std::vector<PlotPoint>& points);
+};
+
+#endif // PLOTDECIMATOR_H
@@ -6,6 +6,7 @@
 */
 
 #include "recordElement.h"
+#include "signalRegistry.h"
 
 
 RecordElement::RecordElement(const std::shared_ptr<ParseResultBase> parseResult, const bool isSelected, const bool isFloat, const RecordElement::TriggerMode triggerMode, const int pollingRateInMs, const XcpEvent& event)
@@ -15,12 +16,15 @@ RecordElement::RecordElement(const std::shared_ptr<ParseResultBase> parseResult,
       triggerMode(triggerMode),
       pollingRateInMs(pollingRateInMs),
       event(event),
-      valueHistoryInt(QList<int>()),
+      valueHistoryInt(DEFAULT_HISTORY_DEPTH),
       latestValueInt(0),
       valueToSetInt(0),
-      valueHistoryFloat(QList<float>()),
+      valueHistoryFloat(DEFAULT_HISTORY_DEPTH),
       latestValueFloat(0),
-      valueToSetFloat(0) {
+      valueToSetFloat(0),
+      isCalibrationPending(false),
+      stimGenerator(std::make_shared<StimGenerator>()),
+      signalId(SignalRegistry::INVALID_ID) {
 
 }
 
@@ -72,14 +76,10 @@ void RecordElement::setPollingRateInMs(int value) {
     pollingRateInMs = value;
 }
 
-QList<int> RecordElement::getValueHistoryInt() const {
+const RingBuffer<int64_t>& RecordElement::getValueHistoryInt() const {
     return valueHistoryInt;
 }
 
-void RecordElement::setValueHistoryInt(const QList<int> &value) {
-    valueHistoryInt = value;
-}
-
 int64_t RecordElement::getLatestValueInt() const {
     return latestValueInt;
 }
@@ -94,24 +94,20 @@ void RecordElement::setValueToSetInt(int64_t value) {
 
 void RecordElement::setLatestValueIntAddHistory(int64_t value) {
     latestValueInt = value;
-    valueHistoryInt.append(latestValueInt);
+    valueHistoryInt.push(latestValueInt);
 }
 
-QList<float> RecordElement::getValueHistoryFloat() const {
+const RingBuffer<float>& RecordElement::getValueHistoryFloat() const {
     return valueHistoryFloat;
 }
 
-void RecordElement::setValueHistoryFloat(const QList<float> &value) {
-    valueHistoryFloat = value;
-}
-
 float RecordElement::getLatestValueFloat() const {
     return latestValueFloat;
 }
 
 void RecordElement::setLatestValueFloatAddHistory(float value) {
     latestValueFloat = value;
-    valueHistoryFloat.append(latestValueFloat);
+    valueHistoryFloat.push(latestValueFloat);
 }
 
 float RecordElement::getValueToSetFloat() const {
@@ -123,3 +119,27 @@ void RecordElement::setValueToSetFloat(float value) {
 }
 
 
+
+bool RecordElement::getIsCalibrationPending() const {
+    return isCalibrationPending;
+}
+
+void RecordElement::setIsCalibrationPending(bool value) {
+    isCalibrationPending = value;
+}
+
+std::shared_ptr<StimGenerator> RecordElement::getStimGenerator() const {
+    return stimGenerator;
+}
+
+void RecordElement::setStimGenerator(const std::shared_ptr<StimGenerator> &value) {
+    stimGenerator = value;
+}
+
+uint32_t RecordElement::getSignalId() const {
+    return signalId;
+}
+
+void RecordElement::setSignalId(const uint32_t &value) {
+    signalId = value;
+}
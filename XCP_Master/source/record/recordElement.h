@@ -10,12 +10,16 @@
 
 #include "parser/parseResultBase.h"
 #include "xcpConfig/xcpEvent.h"
+#include "stimGenerator.h"
+#include "ringBuffer.h"
 
 #include <memory>
 
 class RecordElement {
   public:
-    enum class TriggerMode {Polling, Event};
+    enum class TriggerMode {Polling, Event, Stimulation};
+
+    static const size_t DEFAULT_HISTORY_DEPTH = 1023;
 
     RecordElement(const std::shared_ptr<ParseResultBase> parseResult,
                   const bool isSelected = false,
@@ -42,8 +46,7 @@ class RecordElement {
     int getPollingRateInMs() const;
     void setPollingRateInMs(int value);
 
-    QList<int> getValueHistoryInt() const;
-    void setValueHistoryInt(const QList<int> &value);
+    const RingBuffer<int64_t>& getValueHistoryInt() const;
 
     int64_t getLatestValueInt() const;
     void setLatestValueIntAddHistory(int64_t value);
@@ -51,8 +54,7 @@ class RecordElement {
     int64_t getValueToSetInt() const;
     void setValueToSetInt(int64_t value);
 
-    QList<float> getValueHistoryFloat() const;
-    void setValueHistoryFloat(const QList<float> &value);
+    const RingBuffer<float>& getValueHistoryFloat() const;
 
     float getLatestValueFloat() const;
     void setLatestValueFloatAddHistory(float value);
@@ -61,6 +63,15 @@ class RecordElement {
     float getValueToSetFloat() const;
     void setValueToSetFloat(float value);
 
+    bool getIsCalibrationPending() const;
+    void setIsCalibrationPending(bool value);
+
+    std::shared_ptr<StimGenerator> getStimGenerator() const;
+    void setStimGenerator(const std::shared_ptr<StimGenerator> &value);
+
+    uint32_t getSignalId() const;
+    void setSignalId(const uint32_t &value);
+
   private:
     bool isSelected;
     bool isFloat;
@@ -69,12 +80,15 @@ class RecordElement {
     int pollingRateInMs;
     XcpEvent event;
 
-    QList<int> valueHistoryInt;
+    RingBuffer<int64_t> valueHistoryInt; // written by the acquisition, read by the live views
     int64_t latestValueInt;
     int64_t valueToSetInt;
-    QList<float> valueHistoryFloat;
+    RingBuffer<float> valueHistoryFloat;
     float latestValueFloat;
     float valueToSetFloat;
+    bool isCalibrationPending; // valueToSet is collected for the next calibration dataset
+    std::shared_ptr<StimGenerator> stimGenerator; // signal source if the trigger mode is Stimulation
+    uint32_t signalId; // assigned by the SignalRegistry
 };
 
 #endif // RECORDELEMENT_H
@@ -0,0 +1,111 @@
+/**
+*@file recordFileFormat.h
+*@author Michael Wolf
+*@date 19.10.2026
+*@brief Definition of the native OpenXCP recording file format (*.oxr). All numbers are stored little endian.
+*
+* File layout:
+*   header:  MAGIC, VERSION, start time (ms since epoch), signal count, signal table
+*            (the conversion of a signal since version 4)
+*   chunks:  CHUNK_MAGIC, sample count, time of first and last sample, samples
+*   sample:  time in s (double), signal id (uint32), raw value (int64)
+*   index:   INDEX_MAGIC, chunk count, per chunk: offset, sample count, time range, signal count,
+*            per signal in the chunk: signal id, sample count, time range (since version 2)
+*   statistics: STATISTICS_MAGIC, signal count, per signal: sample count, min, max, mean, standard deviation,
+*            rate, time of first and last sample (since version 3)
+*   footer:  offset of the index (uint64), FOOTER_MAGIC (since version 2, missing if the recording was interrupted)
+*/
+
+#ifndef RECORDFILEFORMAT_H
+#define RECORDFILEFORMAT_H
+
+#include <string>
+#include <vector>
+#include <cstring>
+#include <stdint.h>
+
+namespace RECORD_FILE {
+const char MAGIC[] =                        "OXRECORD";
+const uint32_t MAGIC_SIZE =                 8;
+const uint32_t VERSION =                    4;
+const uint32_t CHUNK_MAGIC =                0x4B4E4843;  /* "CHNK" */
+const uint32_t CHUNK_HEADER_SIZE =          24;
+const uint32_t SAMPLE_SIZE =                20;
+const uint32_t INDEX_MAGIC =                0x58444E49;  /* "INDX" */
+const uint32_t INDEX_CHUNK_SIZE =           32;          /* without the signal entries */
+const uint32_t INDEX_SIGNAL_SIZE =          24;
+const uint32_t STATISTICS_MAGIC =           0x54415453;  /* "STAT" */
+const uint32_t STATISTICS_SIGNAL_SIZE =     64;
+const char FOOTER_MAGIC[] =                 "OXRINDEX";
+const uint32_t FOOTER_SIZE =                16;
+
+const uint8_t SIGNAL_FLAG_FLOAT =           0x01;
+const uint8_t SIGNAL_FLAG_UNSIGNED =        0x02;
+
+const uint16_t GROUP_POLLING =              0x0000;
+const uint16_t GROUP_STIM =                 0x8000;  /* set for stimulated signals */
+}
+
+/**
+ * @brief The RecordSignal struct describes one recorded signal in the signal table. The signal id is the index in the table.
+ */
+struct RecordSignal {
+    std::string name;
+    std::string unit;
+    std::string comment;
+    double lowerLimit = 0.0;
+    double upperLimit = 0.0;
+    uint64_t address = 0;
+    uint8_t size = 4;
+    bool isFloat = false;
+    bool isUnsigned = false;
+    uint16_t group = RECORD_FILE::GROUP_POLLING; // acquisition group: polling or event channel + 1
+    std::string conversion; // raw to physical value, see ConversionFunction, empty: identity
+};
+
+/**
+ * @brief rawToDouble converts a raw value of the signal to a number, float signals are stored as their bits.
+ */
+inline double rawToDouble(const RecordSignal& signal, const int64_t raw) {
+    if(signal.isFloat && signal.size == sizeof(float)) {
+        float typed;
+        uint32_t bits = (uint32_t) raw;
+        std::memcpy(&typed, &bits, sizeof(typed));
+        return typed;
+    }
+    if(signal.isFloat && signal.size == sizeof(double)) {
+        double typed;
+        std::memcpy(&typed, &raw, sizeof(typed));
+        return typed;
+    }
+    return signal.isUnsigned ? (double) (uint64_t) raw : (double) raw;
+}
+
+/**
+ * @brief The RecordChunkSignal struct is the index entry of one signal in one chunk.
+ */
+struct RecordChunkSignal {
+    uint32_t signalId;
+    uint32_t sampleCount;
+    double timeFirst;
+    double timeLast;
+};
+
+/**
+ * @brief The RecordChunkInfo struct is the index entry of one chunk: position in the file, time range and the signals it contains.
+ */
+struct RecordChunkInfo {
+    uint64_t offset = 0; // of the CHUNK_MAGIC
+    uint32_t sampleCount = 0;
+    double timeFirst = 0.0;
+    double timeLast = 0.0;
+    std::vector<RecordChunkSignal> signalRanges;
+};
+
+struct RecordSample {
+    double time;
+    uint32_t signalId;
+    int64_t value;
+};
+
+#endif // RECORDFILEFORMAT_H
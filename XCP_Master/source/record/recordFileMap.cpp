@@ -0,0 +1,381 @@
+/**
+*@file recordFileMap.cpp
+*@author Michael Wolf
+*@date 19.10.2026
+*@brief Memory maps a recording file (*.oxr) and reads time windows of selected signals. Only the index at the end of
+* the file is parsed at open, a query decodes only the chunks which overlap the window and contain a requested signal.
+*/
+
+#include "recordFileMap.h"
+
+#include <cstring>
+#include <algorithm>
+
+namespace {
+uint64_t decodeU64(const uchar* in) {
+    uint64_t value = 0;
+    for(int i = 0; i < 8; i++) {
+        value |= (uint64_t) in[i] << (i * 8);
+    }
+    return value;
+}
+
+uint32_t decodeU32(const uchar* in) {
+    uint32_t value = 0;
+    for(int i = 0; i < 4; i++) {
+        value |= (uint32_t) in[i] << (i * 8);
+    }
+    return value;
+}
+}
+
+RecordFileMap::RecordFileMap()
+    : data(nullptr),
+      size(0),
+      dataOffset(0),
+      hasIndex(false),
+      startTimeMsSinceEpoch(0) {
+
+}
+
+RecordFileMap::~RecordFileMap() {
+    close();
+}
+
+bool RecordFileMap::open(const std::string& path) {
+    close();
+    file.setFileName(QString::fromStdString(path));
+    if(!file.open(QIODevice::ReadOnly)) {
+        return false;
+    }
+    size = (uint64_t) file.size();
+    data = file.map(0, file.size());
+    if(data == nullptr || !readHeader()) {
+        close();
+        return false;
+    }
+    hasIndex = readIndex();
+    if(!hasIndex) {
+        rebuildIndex();
+    }
+    return true;
+}
+
+void RecordFileMap::close() {
+    if(data != nullptr) {
+        file.unmap(const_cast<uchar*>(data));
+        data = nullptr;
+    }
+    if(file.isOpen()) {
+        file.close();
+    }
+    size = 0;
+    dataOffset = 0;
+    hasIndex = false;
+    signalTable.clear();
+    startTimeMsSinceEpoch = 0;
+    chunkIndex.clear();
+    statistics.clear();
+}
+
+bool RecordFileMap::getIsOpen() const {
+    return data != nullptr;
+}
+
+bool RecordFileMap::getHasIndex() const {
+    return hasIndex;
+}
+
+const std::vector<RecordSignal>& RecordFileMap::getSignalTable() const {
+    return signalTable;
+}
+
+int64_t RecordFileMap::getStartTimeMsSinceEpoch() const {
+    return startTimeMsSinceEpoch;
+}
+
+const std::vector<RecordChunkInfo>& RecordFileMap::getChunkIndex() const {
+    return chunkIndex;
+}
+
+double RecordFileMap::getTimeFirst() const {
+    double time = 0.0;
+    for(size_t i = 0; i < chunkIndex.size(); i++) {
+        time = (i == 0) ? chunkIndex[i].timeFirst : std::min(time, chunkIndex[i].timeFirst);
+    }
+    return time;
+}
+
+double RecordFileMap::getTimeLast() const {
+    double time = 0.0;
+    for(size_t i = 0; i < chunkIndex.size(); i++) {
+        time = (i == 0) ? chunkIndex[i].timeLast : std::max(time, chunkIndex[i].timeLast);
+    }
+    return time;
+}
+
+const std::vector<SignalStatistics::Summary>& RecordFileMap::getStatistics() const {
+    return statistics;
+}
+
+/***************************************************************
+*  Queries
+****************************************************************/
+/**
+ * Only the index is searched, one entry per chunk. Without index the signal ranges are unknown, every chunk in the
+ * window is returned.
+ */
+std::vector<size_t> RecordFileMap::findChunks(const double timeFrom, const double timeTo, const std::vector<uint32_t>& signalIds) const {
+    std::vector<size_t> chunks;
+    std::vector<bool> signalMask = createSignalMask(signalIds);
+    for(size_t i = 0; i < chunkIndex.size(); i++) {
+        const RecordChunkInfo& info = chunkIndex[i];
+        if(info.timeLast < timeFrom || info.timeFirst > timeTo) {
+            continue;
+        }
+        if(signalIds.empty() || !hasIndex) {
+            chunks.push_back(i);
+            continue;
+        }
+        for(const auto& range : info.signalRanges) {
+            if(range.signalId < signalMask.size() && signalMask[range.signalId]
+                    && range.timeLast >= timeFrom && range.timeFirst <= timeTo) {
+                chunks.push_back(i);
+                break;
+            }
+        }
+    }
+    return chunks;
+}
+
+size_t RecordFileMap::readWindow(const double timeFrom, const double timeTo, const std::vector<uint32_t>& signalIds, std::vector<RecordSample>& samples) const {
+    size_t sizeBefore = samples.size();
+    std::vector<bool> signalMask = createSignalMask(signalIds);
+    for(size_t chunk : findChunks(timeFrom, timeTo, signalIds)) {
+        const RecordChunkInfo& info = chunkIndex[chunk];
+        uint64_t offset = info.offset + RECORD_FILE::CHUNK_HEADER_SIZE;
+        for(uint32_t i = 0; i < info.sampleCount; i++, offset += RECORD_FILE::SAMPLE_SIZE) {
+            RecordSample sample = decodeSample(offset);
+            if(sample.time < timeFrom || sample.time > timeTo) {
+                continue;
+            }
+            if(!signalIds.empty() && (sample.signalId >= signalMask.size() || !signalMask[sample.signalId])) {
+                continue;
+            }
+            samples.push_back(sample);
+        }
+    }
+    return samples.size() - sizeBefore;
+}
+
+void RecordFileMap::readChunk(const size_t chunkIndex, std::vector<RecordSample>& samples) const {
+    if(chunkIndex >= this->chunkIndex.size()) {
+        return;
+    }
+    const RecordChunkInfo& info = this->chunkIndex[chunkIndex];
+    uint64_t offset = info.offset + RECORD_FILE::CHUNK_HEADER_SIZE;
+    samples.reserve(samples.size() + info.sampleCount);
+    for(uint32_t i = 0; i < info.sampleCount; i++, offset += RECORD_FILE::SAMPLE_SIZE) {
+        samples.push_back(decodeSample(offset));
+    }
+}
+
+std::vector<bool> RecordFileMap::createSignalMask(const std::vector<uint32_t>& signalIds) const {
+    std::vector<bool> signalMask(signalTable.size(), false);
+    for(uint32_t signalId : signalIds) {
+        if(signalId < signalMask.size()) {
+            signalMask[signalId] = true;
+        }
+    }
+    return signalMask;
+}
+
+RecordSample RecordFileMap::decodeSample(const uint64_t offset) const {
+    const uchar* in = data + offset;
+    RecordSample sample;
+    uint64_t time = decodeU64(in);
+    std::memcpy(&sample.time, &time, sizeof(time));
+    sample.signalId = decodeU32(in + 8);
+    sample.value = (int64_t) decodeU64(in + 12);
+    return sample;
+}
+
+/***************************************************************
+*  Header and index
+****************************************************************/
+bool RecordFileMap::readHeader() {
+    uint64_t position = 0;
+    uint32_t version, signalCount;
+    uint64_t startTime;
+    if(size < RECORD_FILE::MAGIC_SIZE || std::memcmp(data, RECORD_FILE::MAGIC, RECORD_FILE::MAGIC_SIZE) != 0) {
+        return false;
+    }
+    position += RECORD_FILE::MAGIC_SIZE;
+    if(!readU32(position, version) || version > RECORD_FILE::VERSION
+            || !readU64(position, startTime) || !readU32(position, signalCount)) {
+        return false;
+    }
+    startTimeMsSinceEpoch = (int64_t) startTime;
+
+    for(uint32_t i = 0; i < signalCount; i++) {
+        RecordSignal signal;
+        uint8_t flags;
+        bool isValid = readString(position, signal.name) && readString(position, signal.unit) && readString(position, signal.comment)
+                       && readDouble(position, signal.lowerLimit) && readDouble(position, signal.upperLimit)
+                       && readU64(position, signal.address) && readU8(position, signal.size) && readU8(position, flags)
+                       && readU16(position, signal.group) && (version < 4 || readString(position, signal.conversion));
+        if(!isValid) {
+            return false;
+        }
+        signal.isFloat = (flags & RECORD_FILE::SIGNAL_FLAG_FLOAT) != 0;
+        signal.isUnsigned = (flags & RECORD_FILE::SIGNAL_FLAG_UNSIGNED) != 0;
+        signalTable.push_back(signal);
+    }
+    dataOffset = position;
+    return true;
+}
+
+/**
+ * The footer at the end of the file points to the index. Every chunk of the index is checked against the file size,
+ * a damaged index is discarded.
+ */
+bool RecordFileMap::readIndex() {
+    if(size < dataOffset + RECORD_FILE::FOOTER_SIZE
+            || std::memcmp(data + size - RECORD_FILE::MAGIC_SIZE, RECORD_FILE::FOOTER_MAGIC, RECORD_FILE::MAGIC_SIZE) != 0) {
+        return false;
+    }
+    uint64_t indexEnd = size - RECORD_FILE::FOOTER_SIZE;
+    uint64_t position = indexEnd;
+    uint64_t indexOffset;
+    uint32_t magic, chunkCount;
+    if(!readU64(position, indexOffset) || indexOffset < dataOffset || indexOffset > indexEnd) {
+        return false;
+    }
+    position = indexOffset;
+    if(!readU32(position, magic) || magic != RECORD_FILE::INDEX_MAGIC || !readU32(position, chunkCount)) {
+        return false;
+    }
+
+    chunkIndex.reserve(chunkCount);
+    for(uint32_t i = 0; i < chunkCount; i++) {
+        RecordChunkInfo info;
+        uint32_t signalCount;
+        if(!readU64(position, info.offset) || !readU32(position, info.sampleCount)
+                || !readDouble(position, info.timeFirst) || !readDouble(position, info.timeLast)
+                || !readU32(position, signalCount) || position + (uint64_t) signalCount * RECORD_FILE::INDEX_SIGNAL_SIZE > indexEnd
+                || info.offset + RECORD_FILE::CHUNK_HEADER_SIZE + (uint64_t) info.sampleCount * RECORD_FILE::SAMPLE_SIZE > indexOffset) {
+            chunkIndex.clear();
+            return false;
+        }
+        info.signalRanges.resize(signalCount);
+        for(auto& range : info.signalRanges) {
+            readU32(position, range.signalId);
+            readU32(position, range.sampleCount);
+            readDouble(position, range.timeFirst);
+            readDouble(position, range.timeLast);
+        }
+        chunkIndex.push_back(std::move(info));
+    }
+    readStatistics(position, indexEnd);
+    return true;
+}
+
+void RecordFileMap::readStatistics(uint64_t position, const uint64_t end) {
+    uint32_t magic, signalCount;
+    if(!readU32(position, magic) || magic != RECORD_FILE::STATISTICS_MAGIC || !readU32(position, signalCount)
+            || signalCount != signalTable.size() || position + (uint64_t) signalCount * RECORD_FILE::STATISTICS_SIGNAL_SIZE > end) {
+        return;
+    }
+    statistics.resize(signalCount);
+    for(auto& summary : statistics) {
+        readU64(position, summary.count);
+        readDouble(position, summary.min);
+        readDouble(position, summary.max);
+        readDouble(position, summary.mean);
+        readDouble(position, summary.stdDev);
+        readDouble(position, summary.rate);
+        readDouble(position, summary.timeFirst);
+        readDouble(position, summary.timeLast);
+    }
+}
+
+/**
+ * Walks the chunk headers only, the sample count gives the position of the next chunk. Stops at the first incomplete chunk.
+ */
+void RecordFileMap::rebuildIndex() {
+    chunkIndex.clear();
+    uint64_t position = dataOffset;
+    while(true) {
+        RecordChunkInfo info;
+        info.offset = position;
+        uint32_t magic;
+        if(!readU32(position, magic) || magic != RECORD_FILE::CHUNK_MAGIC || !readU32(position, info.sampleCount)
+                || !readDouble(position, info.timeFirst) || !readDouble(position, info.timeLast)) {
+            break;
+        }
+        uint64_t chunkEnd = position + (uint64_t) info.sampleCount * RECORD_FILE::SAMPLE_SIZE;
+        if(chunkEnd > size) {
+            break;
+        }
+        chunkIndex.push_back(info);
+        position = chunkEnd;
+    }
+}
+
+/***************************************************************
+*  Decoding
+****************************************************************/
+bool RecordFileMap::readU8(uint64_t& position, uint8_t& value) const {
+    if(position + 1 > size) {
+        return false;
+    }
+    value = data[position];
+    position += 1;
+    return true;
+}
+
+bool RecordFileMap::readU16(uint64_t& position, uint16_t& value) const {
+    if(position + 2 > size) {
+        return false;
+    }
+    value = (uint16_t) (data[position] | (data[position + 1] << 8));
+    position += 2;
+    return true;
+}
+
+bool RecordFileMap::readU32(uint64_t& position, uint32_t& value) const {
+    if(position + 4 > size) {
+        return false;
+    }
+    value = decodeU32(data + position);
+    position += 4;
+    return true;
+}
+
+bool RecordFileMap::readU64(uint64_t& position, uint64_t& value) const {
+    if(position + 8 > size) {
+        return false;
+    }
+    value = decodeU64(data + position);
+    position += 8;
+    return true;
+}
+
+bool RecordFileMap::readDouble(uint64_t& position, double& value) const {
+    uint64_t raw;
+    if(!readU64(position, raw)) {
+        return false;
+    }
+    std::memcpy(&value, &raw, sizeof(value));
+    return true;
+}
+
+bool RecordFileMap::readString(uint64_t& position, std::string& str) const {
+    uint16_t length;
+    if(!readU16(position, length) || position + length > size) {
+        return false;
+    }
+    str.assign(reinterpret_cast<const char*>(data + position), length);
+    position += length;
+    return true;
+}
@@ -0,0 +1,94 @@
+/**
+*@file recordFileMap.h
+*@author Michael Wolf
+*@date 19.10.2026
+*@brief Memory maps a recording file (*.oxr) and reads time windows of selected signals. Only the index at the end of
+* the file is parsed at open, a query decodes only the chunks which overlap the window and contain a requested signal.
+*/
+
+#ifndef RECORDFILEMAP_H
+#define RECORDFILEMAP_H
+
+#include "recordFileFormat.h"
+#include "signalStatistics.h"
+
+#include <vector>
+#include <string>
+
+#include <QFile>
+
+class RecordFileMap {
+  public:
+    RecordFileMap();
+    ~RecordFileMap();
+
+    RecordFileMap(const RecordFileMap&) = delete;
+    RecordFileMap& operator=(const RecordFileMap&) = delete;
+
+    /**
+     * @brief open maps the file and reads the header and the chunk index. If the file has no index (version 1 or an
+     * interrupted recording) the index is rebuilt from the chunk headers, the samples are not read.
+     * @return false if the file can not be mapped or is not a recording file.
+     */
+    bool open(const std::string& path);
+    void close();
+
+    bool getIsOpen() const;
+    bool getHasIndex() const; // false: the index was rebuilt, the signal ranges per chunk are not known
+    const std::vector<RecordSignal>& getSignalTable() const;
+    int64_t getStartTimeMsSinceEpoch() const;
+    const std::vector<RecordChunkInfo>& getChunkIndex() const;
+    double getTimeFirst() const;
+    double getTimeLast() const;
+
+    /**
+     * @return session statistics per signal id from the footer, empty if the file has none (before version 3 or interrupted).
+     */
+    const std::vector<SignalStatistics::Summary>& getStatistics() const;
+
+    /**
+     * @brief findChunks returns the chunks which overlap [timeFrom, timeTo] and contain samples of the signals.
+     * @param signalIds requested signals, empty: all signals.
+     * @return indices in the chunk index, ascending.
+     */
+    std::vector<size_t> findChunks(const double timeFrom, const double timeTo, const std::vector<uint32_t>& signalIds) const;
+
+    /**
+     * @brief readWindow appends the samples of the signals within [timeFrom, timeTo] in file order.
+     * @param signalIds requested signals, empty: all signals.
+     * @return number of appended samples.
+     */
+    size_t readWindow(const double timeFrom, const double timeTo, const std::vector<uint32_t>& signalIds, std::vector<RecordSample>& samples) const;
+
+    /**
+     * @brief readChunk appends all samples of one chunk of the index.
+     */
+    void readChunk(const size_t chunkIndex, std::vector<RecordSample>& samples) const;
+
+  private:
+    bool readHeader();
+    bool readIndex();
+    void readStatistics(uint64_t position, const uint64_t end);
+    void rebuildIndex();
+    std::vector<bool> createSignalMask(const std::vector<uint32_t>& signalIds) const;
+    RecordSample decodeSample(const uint64_t offset) const;
+
+    bool readU8(uint64_t& position, uint8_t& value) const;
+    bool readU16(uint64_t& position, uint16_t& value) const;
+    bool readU32(uint64_t& position, uint32_t& value) const;
+    bool readU64(uint64_t& position, uint64_t& value) const;
+    bool readDouble(uint64_t& position, double& value) const;
+    bool readString(uint64_t& position, std::string& str) const;
+
+    QFile file;
+    const uchar* data;
+    uint64_t size;
+    uint64_t dataOffset; // first chunk
+    bool hasIndex;
+    std::vector<RecordSignal> signalTable;
+    int64_t startTimeMsSinceEpoch;
+    std::vector<RecordChunkInfo> chunkIndex;
+    std::vector<SignalStatistics::Summary> statistics;
+};
+
+#endif // RECORDFILEMAP_H
@@ -0,0 +1,191 @@
+/**
+*@file recordFileReader.cpp
+*@author Michael Wolf
+*@date 19.10.2026
+*@brief Reads a recording file (*.oxr) chunk by chunk, so the memory is bounded by the chunk size.
+*/
+
+#include "recordFileReader.h"
+
+#include <cstring>
+
+RecordFileReader::RecordFileReader()
+    : fileSize(0),
+      startTimeMsSinceEpoch(0) {
+
+}
+
+bool RecordFileReader::open(const std::string &path) {
+    close();
+    file.open(path, std::ios::binary);
+    if(!file.is_open()) {
+        return false;
+    }
+    file.seekg(0, std::ios::end);
+    fileSize = (uint64_t) file.tellg();
+    file.seekg(0, std::ios::beg);
+
+    char magic[RECORD_FILE::MAGIC_SIZE];
+    file.read(magic, RECORD_FILE::MAGIC_SIZE);
+    uint32_t version, signalCount;
+    uint64_t startTime;
+    if(!file || std::memcmp(magic, RECORD_FILE::MAGIC, RECORD_FILE::MAGIC_SIZE) != 0
+            || !readU32(version) || version > RECORD_FILE::VERSION
+            || !readU64(startTime) || !readU32(signalCount)) {
+        close();
+        return false;
+    }
+    startTimeMsSinceEpoch = (int64_t) startTime;
+
+    for(uint32_t i = 0; i < signalCount; i++) {
+        RecordSignal signal;
+        uint8_t flags;
+        bool isValid = readString(signal.name) && readString(signal.unit) && readString(signal.comment)
+                       && readDouble(signal.lowerLimit) && readDouble(signal.upperLimit)
+                       && readU64(signal.address) && readU8(signal.size) && readU8(flags) && readU16(signal.group)
+                       && (version < 4 || readString(signal.conversion));
+        if(!isValid) {
+            close();
+            return false;
+        }
+        signal.isFloat = (flags & RECORD_FILE::SIGNAL_FLAG_FLOAT) != 0;
+        signal.isUnsigned = (flags & RECORD_FILE::SIGNAL_FLAG_UNSIGNED) != 0;
+        signalTable.push_back(signal);
+    }
+    return true;
+}
+
+void RecordFileReader::close() {
+    if(file.is_open()) {
+        file.close();
+    }
+    file.clear();
+    fileSize = 0;
+    signalTable.clear();
+    startTimeMsSinceEpoch = 0;
+}
+
+bool RecordFileReader::readNextChunk(std::vector<RecordSample> &samples) {
+    samples.clear();
+    RecordChunkInfo info;
+    if(!readChunkHeader(info)) {
+        return false;
+    }
+
+    std::vector<uint8_t> buffer((size_t) info.sampleCount * RECORD_FILE::SAMPLE_SIZE);
+    file.read(reinterpret_cast<char*>(buffer.data()), buffer.size());
+    if(!file) {
+        return false;
+    }
+    samples.resize(info.sampleCount);
+    const uint8_t* in = buffer.data();
+    for(auto& sample : samples) {
+        uint64_t time = 0, value = 0;
+        uint32_t signalId = 0;
+        for(int i = 0; i < 8; i++) {
+            time |= (uint64_t) in[i] << (i * 8);
+        }
+        for(int i = 0; i < 4; i++) {
+            signalId |= (uint32_t) in[8 + i] << (i * 8);
+        }
+        for(int i = 0; i < 8; i++) {
+            value |= (uint64_t) in[12 + i] << (i * 8);
+        }
+        std::memcpy(&sample.time, &time, sizeof(time));
+        sample.signalId = signalId;
+        sample.value = (int64_t) value;
+        in += RECORD_FILE::SAMPLE_SIZE;
+    }
+    return true;
+}
+
+bool RecordFileReader::skipNextChunk(RecordChunkInfo &info) {
+    if(!readChunkHeader(info)) {
+        return false;
+    }
+    file.seekg((std::streamoff) info.sampleCount * RECORD_FILE::SAMPLE_SIZE, std::ios::cur);
+    return (bool) file;
+}
+
+uint64_t RecordFileReader::getPosition() {
+    return (uint64_t) file.tellg();
+}
+
+bool RecordFileReader::seek(const uint64_t position) {
+    file.clear();
+    file.seekg((std::streamoff) position, std::ios::beg);
+    return (bool) file;
+}
+
+/**
+ * The sample count comes from the file, a damaged or foreign chunk header must not allocate more than the file holds.
+ */
+bool RecordFileReader::readChunkHeader(RecordChunkInfo &info) {
+    uint32_t magic;
+    info.offset = (uint64_t) file.tellg();
+    if(!readU32(magic) || magic != RECORD_FILE::CHUNK_MAGIC
+            || !readU32(info.sampleCount) || !readDouble(info.timeFirst) || !readDouble(info.timeLast)) {
+        return false;
+    }
+    uint64_t position = (uint64_t) file.tellg();
+    return position <= fileSize && (uint64_t) info.sampleCount * RECORD_FILE::SAMPLE_SIZE <= fileSize - position;
+}
+
+const std::vector<RecordSignal>& RecordFileReader::getSignalTable() const {
+    return signalTable;
+}
+
+int64_t RecordFileReader::getStartTimeMsSinceEpoch() const {
+    return startTimeMsSinceEpoch;
+}
+
+bool RecordFileReader::readU8(uint8_t &value) {
+    file.read(reinterpret_cast<char*>(&value), 1);
+    return (bool) file;
+}
+
+bool RecordFileReader::readU16(uint16_t &value) {
+    uint8_t bytes[2];
+    file.read(reinterpret_cast<char*>(bytes), 2);
+    value = (uint16_t) (bytes[0] | (bytes[1] << 8));
+    return (bool) file;
+}
+
+bool RecordFileReader::readU32(uint32_t &value) {
+    uint8_t bytes[4];
+    file.read(reinterpret_cast<char*>(bytes), 4);
+    value = 0;
+    for(int i = 0; i < 4; i++) {
+        value |= (uint32_t) bytes[i] << (i * 8);
+    }
+    return (bool) file;
+}
+
+bool RecordFileReader::readU64(uint64_t &value) {
+    uint8_t bytes[8];
+    file.read(reinterpret_cast<char*>(bytes), 8);
+    value = 0;
+    for(int i = 0; i < 8; i++) {
+        value |= (uint64_t) bytes[i] << (i * 8);
+    }
+    return (bool) file;
+}
+
+bool RecordFileReader::readDouble(double &value) {
+    uint64_t raw;
+    bool isValid = readU64(raw);
+    std::memcpy(&value, &raw, sizeof(value));
+    return isValid;
+}
+
+bool RecordFileReader::readString(std::string &str) {
+    uint16_t size;
+    if(!readU16(size)) {
+        return false;
+    }
+    str.resize(size);
+    if(size > 0) {
+        file.read(&str[0], size);
+    }
+    return (bool) file;
+}
@@ -0,0 +1,66 @@
+/**
+*@file recordFileReader.h
+*@author Michael Wolf
+*@date 19.10.2026
+*@brief Reads a recording file (*.oxr) chunk by chunk, so the memory is bounded by the chunk size.
+*/
+
+#ifndef RECORDFILEREADER_H
+#define RECORDFILEREADER_H
+
+#include "recordFileFormat.h"
+
+#include <vector>
+#include <string>
+#include <fstream>
+
+class RecordFileReader {
+  public:
+    RecordFileReader();
+
+    /**
+     * @brief open reads the header and the signal table.
+     * @return false if the file can not be opened or is not a recording file.
+     */
+    bool open(const std::string& path);
+    void close();
+
+    /**
+     * @brief readNextChunk reads the samples of the next chunk.
+     * @return false at the end of the file or if the chunk is incomplete (e.g. the recording was interrupted).
+     * A sample count which exceeds the rest of the file is rejected before anything is allocated.
+     */
+    bool readNextChunk(std::vector<RecordSample>& samples);
+
+    /**
+     * @brief skipNextChunk reads only the header of the next chunk (offset, sample count, time range) and moves to the chunk after it.
+     * @return false at the end of the file or if the chunk is incomplete.
+     */
+    bool skipNextChunk(RecordChunkInfo& info);
+
+    /**
+     * @brief getPosition offset of the next chunk, seek() returns to it. Several readers of one file can read at different positions.
+     */
+    uint64_t getPosition();
+    bool seek(const uint64_t position);
+
+    const std::vector<RecordSignal>& getSignalTable() const;
+    int64_t getStartTimeMsSinceEpoch() const;
+
+  private:
+    bool readU8(uint8_t& value);
+    bool readU16(uint16_t& value);
+    bool readU32(uint32_t& value);
+    bool readU64(uint64_t& value);
+    bool readDouble(double& value);
+    bool readString(std::string& str);
+
+    bool readChunkHeader(RecordChunkInfo& info);
+
+    std::ifstream file;
+    uint64_t fileSize;
+    std::vector<RecordSignal> signalTable;
+    int64_t startTimeMsSinceEpoch;
+};
+
+#endif // RECORDFILEREADER_H
@@ -0,0 +1,224 @@
+/**
+*@file recordWindowReader.cpp
+*@author Michael Wolf
+*@date 19.10.2026
+*@brief Reads a recording file (*.oxr) window by window into a sample store, so a recording of any length is exported
+* with the memory of a few chunks. The samples of a window which are not written yet stay pending for the next window.
+* For the interpolation a window can hold the last written sample and the next later sample of every signal.
+*/
+
+#include "recordWindowReader.h"
+
+#include <algorithm>
+#include <limits>
+
+RecordWindowReader::RecordWindowReader(const size_t chunksPerWindow)
+    : chunksPerWindow(std::max<size_t>(chunksPerWindow, 1)),
+      isPreviousNeeded(false),
+      isNextNeeded(false),
+      isEnd(true),
+      hasSamples(false),
+      timeFirst(0.0),
+      timeLast(0.0),
+      timeRead(0.0),
+      chunkCount(0),
+      chunksRead(0) {
+
+}
+
+/**
+ * The chunk headers are read once to find the time range and the number of chunks, the samples are skipped.
+ */
+bool RecordWindowReader::open(const std::string& path, const bool isPreviousNeeded, const bool isNextNeeded) {
+    close();
+    if(!reader.open(path) || (isNextNeeded && !nextReader.open(path))) {
+        close();
+        return false;
+    }
+    this->isPreviousNeeded = isPreviousNeeded;
+    this->isNextNeeded = isNextNeeded;
+
+    uint64_t dataPosition = reader.getPosition();
+    RecordChunkInfo info;
+    while(reader.skipNextChunk(info)) {
+        chunkCount++;
+        if(info.sampleCount == 0) {
+            continue;
+        }
+        timeFirst = hasSamples ? std::min(timeFirst, info.timeFirst) : info.timeFirst;
+        timeLast = hasSamples ? std::max(timeLast, info.timeLast) : info.timeLast;
+        hasSamples = true;
+    }
+    reader.seek(dataPosition);
+
+    size_t signalCount = reader.getSignalTable().size();
+    pending.assign(signalCount, std::deque<RecordSample>());
+    previous.assign(signalCount, RecordSample());
+    hasPrevious.assign(signalCount, false);
+    nextSamples.assign(signalCount, NextSample());
+    pendingFirst.assign(signalCount, 0);
+    timeRead = std::numeric_limits<double>::lowest();
+    isEnd = false;
+    return true;
+}
+
+void RecordWindowReader::close() {
+    reader.close();
+    nextReader.close();
+    isEnd = true;
+    hasSamples = false;
+    timeFirst = 0.0;
+    timeLast = 0.0;
+    chunkCount = 0;
+    chunksRead = 0;
+    pending.clear();
+    previous.clear();
+    hasPrevious.clear();
+    nextSamples.clear();
+    pendingFirst.clear();
+}
+
+const std::vector<RecordSignal>& RecordWindowReader::getSignalTable() const {
+    return reader.getSignalTable();
+}
+
+bool RecordWindowReader::getHasSamples() const {
+    return hasSamples;
+}
+
+double RecordWindowReader::getTimeFirst() const {
+    return timeFirst;
+}
+
+double RecordWindowReader::getTimeLast() const {
+    return timeLast;
+}
+
+int RecordWindowReader::getProgress() const {
+    return chunkCount > 0 ? (int) (chunksRead * 100 / chunkCount) : 100;
+}
+
+/***************************************************************
+*  Windows
+****************************************************************/
+bool RecordWindowReader::nextWindow(SampleStore& window, double& timeLimit) {
+    if(!readChunks()) {
+        return false;
+    }
+    timeLimit = isEnd ? std::numeric_limits<double>::infinity() : timeRead;
+    if(isNextNeeded && !isEnd) {
+        findNextSamples(timeLimit);
+    }
+
+    window.init(reader.getSignalTable());
+    for(uint32_t signalId = 0; signalId < pending.size(); signalId++) {
+        pendingFirst[signalId] = 0;
+        if(isPreviousNeeded && hasPrevious[signalId]) {
+            window.append(signalId, previous[signalId].time, previous[signalId].value);
+            pendingFirst[signalId] = 1;
+        }
+        const std::deque<RecordSample>& samples = pending[signalId];
+        for(const auto& sample : samples) {
+            window.append(signalId, sample.time, sample.value);
+        }
+        bool isLaterPending = !samples.empty() && samples.back().time >= timeLimit;
+        if(isNextNeeded && !isEnd && !isLaterPending && nextSamples[signalId].isFound) {
+            window.append(signalId, nextSamples[signalId].sample.time, nextSamples[signalId].sample.value);
+        }
+    }
+    return true;
+}
+
+size_t RecordWindowReader::getPendingFirst(const uint32_t signalId) const {
+    return signalId < pendingFirst.size() ? pendingFirst[signalId] : 0;
+}
+
+void RecordWindowReader::consume(const uint32_t signalId, const size_t count) {
+    if(signalId >= pending.size()) {
+        return;
+    }
+    std::deque<RecordSample>& samples = pending[signalId];
+    size_t consumed = std::min(count, samples.size());
+    if(consumed == 0) {
+        return;
+    }
+    previous[signalId] = samples[consumed - 1];
+    hasPrevious[signalId] = true;
+    samples.erase(samples.begin(), samples.begin() + consumed);
+}
+
+/**
+ * @return false if the end of the file is reached and no sample is pending.
+ */
+bool RecordWindowReader::readChunks() {
+    for(size_t i = 0; i < chunksPerWindow && !isEnd; i++) {
+        if(!reader.readNextChunk(chunk)) {
+            isEnd = true; // end of the file or an incomplete chunk of an interrupted recording
+            break;
+        }
+        chunksRead++;
+        for(const auto& sample : chunk) {
+            if(sample.signalId < pending.size()) {
+                pending[sample.signalId].push_back(sample);
+                timeRead = std::max(timeRead, sample.time);
+            }
+        }
+    }
+    for(const auto& samples : pending) {
+        if(!samples.empty()) {
+            return true;
+        }
+    }
+    return !isEnd;
+}
+
+/**
+ * The next sample of a signal stays valid until reader reaches its chunk, so every part of the file is searched at most
+ * once per signal. A search starts at the position of reader and fills all signals without a valid next sample, it stops
+ * when the signals without a later pending sample are found.
+ */
+void RecordWindowReader::findNextSamples(const double timeLimit) {
+    uint64_t position = reader.getPosition();
+    std::vector<bool> isSearched(pending.size(), false);
+    size_t neededCount = 0;
+    for(uint32_t signalId = 0; signalId < pending.size(); signalId++) {
+        NextSample& next = nextSamples[signalId];
+        if(next.isNone || (next.isFound && next.chunkPosition >= position)) {
+            continue;
+        }
+        next.isFound = false;
+        isSearched[signalId] = true;
+        if(pending[signalId].empty() || pending[signalId].back().time < timeLimit) {
+            neededCount++;
+        }
+    }
+    if(neededCount == 0 || !nextReader.seek(position)) {
+        return;
+    }
+
+    bool isFileEnd = false;
+    while(neededCount > 0) {
+        uint64_t chunkPosition = nextReader.getPosition();
+        if(!nextReader.readNextChunk(chunk)) {
+            isFileEnd = true;
+            break;
+        }
+        for(const auto& sample : chunk) {
+            if(sample.signalId >= pending.size() || !isSearched[sample.signalId] || nextSamples[sample.signalId].isFound) {
+                continue;
+            }
+            NextSample& next = nextSamples[sample.signalId];
+            next.isFound = true;
+            next.chunkPosition = chunkPosition;
+            next.sample = sample;
+            if(pending[sample.signalId].empty() || pending[sample.signalId].back().time < timeLimit) {
+                neededCount--;
+            }
+        }
+    }
+    for(uint32_t signalId = 0; signalId < pending.size() && isFileEnd; signalId++) {
+        if(isSearched[signalId] && !nextSamples[signalId].isFound) {
+            nextSamples[signalId].isNone = true;
+        }
+    }
+}
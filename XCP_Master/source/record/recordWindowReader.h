@@ -0,0 +1,97 @@
+/**
+*@file recordWindowReader.h
+*@author Michael Wolf
+*@date 19.10.2026
+*@brief Reads a recording file (*.oxr) window by window into a sample store, so a recording of any length is exported
+* with the memory of a few chunks. The samples of a window which are not written yet stay pending for the next window.
+* For the interpolation a window can hold the last written sample and the next later sample of every signal.
+*/
+
+#ifndef RECORDWINDOWREADER_H
+#define RECORDWINDOWREADER_H
+
+#include "recordFileReader.h"
+#include "sampleStore.h"
+
+#include <vector>
+#include <deque>
+#include <string>
+#include <stdint.h>
+#include <stddef.h>
+
+class RecordWindowReader {
+  public:
+    /**
+     * @param chunksPerWindow chunks read per window.
+     */
+    RecordWindowReader(const size_t chunksPerWindow = 16);
+
+    /**
+     * @brief open reads the signal table and the chunk headers, which give the time range of the recording.
+     * @param isPreviousNeeded a window starts with the last consumed sample of every signal.
+     * @param isNextNeeded a window ends with the first sample after the read chunks of every signal.
+     * @return false if the file can not be opened or is not a recording file.
+     */
+    bool open(const std::string& path, const bool isPreviousNeeded, const bool isNextNeeded);
+    void close();
+
+    const std::vector<RecordSignal>& getSignalTable() const;
+    bool getHasSamples() const;
+    double getTimeFirst() const;
+    double getTimeLast() const;
+    int getProgress() const; // percent of the chunks read
+
+    /**
+     * @brief nextWindow reads the next chunks into the window: per signal the previous sample (optional), the pending
+     * samples and the next sample (optional). The recorder writes the samples in time order.
+     * @param timeLimit all samples before this time are in the window, infinity at the end of the file.
+     * @return false if the file is read and all samples are consumed.
+     */
+    bool nextWindow(SampleStore& window, double& timeLimit);
+
+    /**
+     * @return index of the first pending sample of the signal in the current window.
+     */
+    size_t getPendingFirst(const uint32_t signalId) const;
+
+    /**
+     * @brief consume removes the first count pending samples of the signal, they were written. The last one is the
+     * previous sample of the next window.
+     */
+    void consume(const uint32_t signalId, const size_t count);
+
+  private:
+    /**
+     * @brief The NextSample struct is the first sample of a signal in the file after the read chunks.
+     */
+    struct NextSample {
+        bool isFound = false;
+        bool isNone = false; // the signal has no later sample
+        uint64_t chunkPosition = 0;
+        RecordSample sample;
+    };
+
+    bool readChunks();
+    void findNextSamples(const double timeLimit);
+
+    const size_t chunksPerWindow;
+    RecordFileReader reader;
+    RecordFileReader nextReader; // searches the next samples ahead of reader
+    bool isPreviousNeeded;
+    bool isNextNeeded;
+    bool isEnd;
+    bool hasSamples;
+    double timeFirst;
+    double timeLast;
+    double timeRead; // latest sample read
+    size_t chunkCount;
+    size_t chunksRead;
+    std::vector<RecordSample> chunk;
+    std::vector<std::deque<RecordSample>> pending; // index: signal id
+    std::vector<RecordSample> previous;
+    std::vector<bool> hasPrevious;
+    std::vector<NextSample> nextSamples;
+    std::vector<size_t> pendingFirst;
+};
+
+#endif // RECORDWINDOWREADER_H
@@ -0,0 +1,365 @@
+/**
+*@file recordWriter.cpp
+*@author Michael Wolf
+*@date 19.10.2026
+*@brief Streams the samples of a measurement to a recording file (*.oxr). The samples are collected in fixed size chunks,
+* full chunks are written by a background thread. The memory is bounded by the chunk pool. The time range of every chunk
+* and of every signal in it is collected and written as index at the end of the file (see RecordFileMap).
+*/
+
+#include "recordWriter.h"
+
+#include <cstring>
+#include <algorithm>
+
+namespace {
+void writeU8(std::FILE* file, const uint8_t value) {
+    std::fwrite(&value, sizeof(value), 1, file);
+}
+
+void writeU16(std::FILE* file, const uint16_t value) {
+    uint8_t bytes[2] = {(uint8_t) value, (uint8_t) (value >> 8)};
+    std::fwrite(bytes, sizeof(bytes), 1, file);
+}
+
+void writeU32(std::FILE* file, const uint32_t value) {
+    uint8_t bytes[4];
+    for(int i = 0; i < 4; i++) {
+        bytes[i] = (uint8_t) (value >> (i * 8));
+    }
+    std::fwrite(bytes, sizeof(bytes), 1, file);
+}
+
+void writeU64(std::FILE* file, const uint64_t value) {
+    uint8_t bytes[8];
+    for(int i = 0; i < 8; i++) {
+        bytes[i] = (uint8_t) (value >> (i * 8));
+    }
+    std::fwrite(bytes, sizeof(bytes), 1, file);
+}
+
+void writeDouble(std::FILE* file, const double value) {
+    uint64_t raw;
+    std::memcpy(&raw, &value, sizeof(raw));
+    writeU64(file, raw);
+}
+
+void writeString(std::FILE* file, const std::string& str) {
+    writeU16(file, (uint16_t) str.size());
+    std::fwrite(str.data(), 1, (uint16_t) str.size(), file);
+}
+}
+
+RecordWriter::RecordWriter(const size_t samplesPerChunk, const size_t maxChunks)
+    : file(nullptr),
+      samplesPerChunk(samplesPerChunk),
+      maxChunks(maxChunks),
+      currentChunk(nullptr),
+      filePosition(0),
+      isStopRequested(false),
+      isRunning(false),
+      isWriteError(false),
+      samplesWritten(0),
+      samplesDropped(0) {
+
+}
+
+RecordWriter::~RecordWriter() {
+    stop();
+}
+
+bool RecordWriter::start(const std::string &path, const std::vector<RecordSignal> &signalTable, const int64_t startTimeMsSinceEpoch) {
+    stop();
+    this->path = path;
+    this->signalTable = signalTable;
+    chunkIndex.clear();
+    statistics.init(signalTable.size());
+    conversions.assign(signalTable.size(), ConversionFunction());
+    for(size_t signalId = 0; signalId < signalTable.size(); signalId++) {
+        conversions[signalId].compile(signalTable[signalId].conversion);
+    }
+    file = std::fopen(path.c_str(), "wb");
+    if(file == nullptr) {
+        return false;
+    }
+    if(!writeHeader(startTimeMsSinceEpoch) || std::fflush(file) != 0) {
+        std::fclose(file);
+        file = nullptr;
+        return false;
+    }
+
+    isWriteError = false;
+    samplesWritten = 0;
+    samplesDropped = 0;
+    isStopRequested = false;
+    isRunning = true;
+    writerThread = std::thread(&RecordWriter::writerLoop, this);
+    return true;
+}
+
+void RecordWriter::append(const double time, const uint32_t signalId, const int64_t value) {
+    if(!isRunning) {
+        return;
+    }
+    if(currentChunk == nullptr && !acquireChunk()) {
+        samplesDropped++; // the disk does not keep up, all chunks are waiting
+        return;
+    }
+    currentChunk->push_back({time, signalId, value}); // capacity is reserved, no allocation
+
+    if(currentChunk->size() >= samplesPerChunk) {
+        {
+            std::lock_guard<std::mutex> lock(mutexChunks);
+            fullChunks.push_back(currentChunk);
+        }
+        currentChunk = nullptr;
+        chunkAvailable.notify_one();
+    }
+}
+
+void RecordWriter::appendBlocking(const std::vector<RecordSample>& samples) {
+    for(const auto& sample : samples) {
+        if(currentChunk == nullptr && isRunning) {
+            std::unique_lock<std::mutex> lock(mutexChunks);
+            chunkFree.wait(lock, [this]() {
+                return !freeChunks.empty() || chunkPool.size() < maxChunks;
+            });
+        }
+        append(sample.time, sample.signalId, sample.value);
+    }
+}
+
+bool RecordWriter::stop() {
+    if(!isRunning) {
+        return true;
+    }
+    {
+        std::lock_guard<std::mutex> lock(mutexChunks);
+        if(currentChunk != nullptr) {
+            if(currentChunk->empty()) {
+                freeChunks.push_back(currentChunk);
+            } else {
+                fullChunks.push_back(currentChunk);
+            }
+            currentChunk = nullptr;
+        }
+        isStopRequested = true;
+    }
+    chunkAvailable.notify_one();
+    writerThread.join();
+
+    bool isWritten = !isWriteError && writeTrailer() && std::fflush(file) == 0;
+    isWritten = (std::fclose(file) == 0) && isWritten;
+    file = nullptr;
+    isWriteError = !isWritten;
+    isRunning = false;
+    return isWritten;
+}
+
+bool RecordWriter::getIsRunning() const {
+    return isRunning;
+}
+
+bool RecordWriter::getIsWriteError() const {
+    return isWriteError;
+}
+
+std::string RecordWriter::getPath() const {
+    return path;
+}
+
+uint64_t RecordWriter::getSamplesWritten() const {
+    return samplesWritten;
+}
+
+uint64_t RecordWriter::getSamplesDropped() const {
+    return samplesDropped;
+}
+
+const SignalStatistics& RecordWriter::getStatistics() const {
+    return statistics;
+}
+
+bool RecordWriter::acquireChunk() {
+    std::lock_guard<std::mutex> lock(mutexChunks);
+    if(!freeChunks.empty()) {
+        currentChunk = freeChunks.back();
+        freeChunks.pop_back();
+        return true;
+    }
+    if(chunkPool.size() < maxChunks) {
+        chunkPool.emplace_back(new std::vector<RecordSample>());
+        currentChunk = chunkPool.back().get();
+        currentChunk->reserve(samplesPerChunk);
+        return true;
+    }
+    return false;
+}
+
+void RecordWriter::writerLoop() {
+    while(true) {
+        std::vector<RecordSample>* chunk;
+        {
+            std::unique_lock<std::mutex> lock(mutexChunks);
+            chunkAvailable.wait(lock, [this]() {
+                return !fullChunks.empty() || isStopRequested;
+            });
+            if(fullChunks.empty()) {
+                break; // stop requested and everything is written
+            }
+            chunk = fullChunks.front();
+            fullChunks.pop_front();
+        }
+
+        for(const auto& sample : *chunk) {
+            if(sample.signalId < signalTable.size()) {
+                double value = conversions[sample.signalId].convert(rawToDouble(signalTable[sample.signalId], sample.value));
+                statistics.add(sample.signalId, sample.time, value);
+            }
+        }
+        if(!isWriteError && (!writeChunk(*chunk) || std::fflush(file) != 0)) { // a crash loses at most the chunks in memory
+            isWriteError = true;
+        }
+        if(isWriteError) {
+            samplesDropped += chunk->size(); // the file ends at the failed write
+        } else {
+            samplesWritten += chunk->size();
+        }
+        chunk->clear();
+
+        std::lock_guard<std::mutex> lock(mutexChunks);
+        freeChunks.push_back(chunk);
+        chunkFree.notify_one();
+    }
+}
+
+bool RecordWriter::writeHeader(const int64_t startTimeMsSinceEpoch) {
+    std::fwrite(RECORD_FILE::MAGIC, 1, RECORD_FILE::MAGIC_SIZE, file);
+    writeU32(file, RECORD_FILE::VERSION);
+    writeU64(file, (uint64_t) startTimeMsSinceEpoch);
+    writeU32(file, (uint32_t) signalTable.size());
+    for(const auto& signal : signalTable) {
+        writeString(file, signal.name);
+        writeString(file, signal.unit);
+        writeString(file, signal.comment);
+        writeDouble(file, signal.lowerLimit);
+        writeDouble(file, signal.upperLimit);
+        writeU64(file, signal.address);
+        writeU8(file, signal.size);
+        uint8_t flags = 0;
+        flags |= signal.isFloat ? RECORD_FILE::SIGNAL_FLAG_FLOAT : 0;
+        flags |= signal.isUnsigned ? RECORD_FILE::SIGNAL_FLAG_UNSIGNED : 0;
+        writeU8(file, flags);
+        writeU16(file, signal.group);
+        writeString(file, signal.conversion);
+    }
+    filePosition = (uint64_t) std::ftell(file);
+    return std::ferror(file) == 0;
+}
+
+bool RecordWriter::writeChunk(const std::vector<RecordSample> &chunk) {
+    if(chunk.empty()) {
+        return true;
+    }
+    writeU32(file, RECORD_FILE::CHUNK_MAGIC);
+    writeU32(file, (uint32_t) chunk.size());
+    writeDouble(file, chunk.front().time);
+    writeDouble(file, chunk.back().time);
+
+    std::vector<uint8_t> buffer(chunk.size() * RECORD_FILE::SAMPLE_SIZE);
+    uint8_t* out = buffer.data();
+    for(const auto& sample : chunk) {
+        uint64_t time;
+        std::memcpy(&time, &sample.time, sizeof(time));
+        for(int i = 0; i < 8; i++) {
+            *out++ = (uint8_t) (time >> (i * 8));
+        }
+        for(int i = 0; i < 4; i++) {
+            *out++ = (uint8_t) (sample.signalId >> (i * 8));
+        }
+        for(int i = 0; i < 8; i++) {
+            *out++ = (uint8_t) ((uint64_t) sample.value >> (i * 8));
+        }
+    }
+    if(std::fwrite(buffer.data(), 1, buffer.size(), file) != buffer.size() || std::ferror(file)) {
+        return false; // the chunk is not indexed, a reader stops at the incomplete chunk
+    }
+    addToChunkIndex(chunk);
+    filePosition += RECORD_FILE::CHUNK_HEADER_SIZE + buffer.size();
+    return true;
+}
+
+/**
+ * The chunk holds the samples of all signals in arrival order, the index stores the time range per signal so a reader
+ * can skip the chunks without samples of the requested signals.
+ */
+void RecordWriter::addToChunkIndex(const std::vector<RecordSample>& chunk) {
+    RecordChunkInfo info;
+    info.offset = filePosition;
+    info.sampleCount = (uint32_t) chunk.size();
+    info.timeFirst = chunk.front().time;
+    info.timeLast = chunk.front().time;
+
+    chunkSignals.assign(signalTable.size(), RecordChunkSignal());
+    for(const auto& sample : chunk) {
+        info.timeFirst = std::min(info.timeFirst, sample.time);
+        info.timeLast = std::max(info.timeLast, sample.time);
+        if(sample.signalId >= chunkSignals.size()) {
+            continue;
+        }
+        RecordChunkSignal& range = chunkSignals[sample.signalId];
+        if(range.sampleCount == 0) {
+            range.signalId = sample.signalId;
+            range.timeFirst = sample.time;
+            range.timeLast = sample.time;
+        }
+        range.timeFirst = std::min(range.timeFirst, sample.time);
+        range.timeLast = std::max(range.timeLast, sample.time);
+        range.sampleCount++;
+    }
+    for(const auto& range : chunkSignals) {
+        if(range.sampleCount > 0) {
+            info.signalRanges.push_back(range);
+        }
+    }
+    chunkIndex.push_back(std::move(info));
+}
+
+bool RecordWriter::writeTrailer() {
+    uint64_t indexOffset = filePosition;
+    writeU32(file, RECORD_FILE::INDEX_MAGIC);
+    writeU32(file, (uint32_t) chunkIndex.size());
+    for(const auto& info : chunkIndex) {
+        writeU64(file, info.offset);
+        writeU32(file, info.sampleCount);
+        writeDouble(file, info.timeFirst);
+        writeDouble(file, info.timeLast);
+        writeU32(file, (uint32_t) info.signalRanges.size());
+        for(const auto& range : info.signalRanges) {
+            writeU32(file, range.signalId);
+            writeU32(file, range.sampleCount);
+            writeDouble(file, range.timeFirst);
+            writeDouble(file, range.timeLast);
+        }
+    }
+
+    writeU32(file, RECORD_FILE::STATISTICS_MAGIC);
+    writeU32(file, (uint32_t) signalTable.size());
+    for(uint32_t signalId = 0; signalId < signalTable.size(); signalId++) {
+        SignalStatistics::Summary summary;
+        statistics.read(signalId, SignalStatistics::SCOPE::SESSION, summary);
+        writeU64(file, summary.count);
+        writeDouble(file, summary.min);
+        writeDouble(file, summary.max);
+        writeDouble(file, summary.mean);
+        writeDouble(file, summary.stdDev);
+        writeDouble(file, summary.rate);
+        writeDouble(file, summary.timeFirst);
+        writeDouble(file, summary.timeLast);
+    }
+
+    writeU64(file, indexOffset);
+    std::fwrite(RECORD_FILE::FOOTER_MAGIC, 1, RECORD_FILE::MAGIC_SIZE, file);
+    chunkIndex.clear();
+    return std::ferror(file) == 0;
+}
@@ -0,0 +1,116 @@
+/**
+*@file recordWriter.h
+*@author Michael Wolf
+*@date 19.10.2026
+*@brief Streams the samples of a measurement to a recording file (*.oxr). The samples are collected in fixed size chunks,
+* full chunks are written by a background thread. The memory is bounded by the chunk pool. The time range of every chunk
+* and of every signal in it is collected and written as index at the end of the file (see RecordFileMap).
+*/
+
+#ifndef RECORDWRITER_H
+#define RECORDWRITER_H
+
+#include "recordFileFormat.h"
+#include "signalStatistics.h"
+#include "conversionFunction.h"
+
+#include <vector>
+#include <deque>
+#include <string>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <atomic>
+#include <memory>
+#include <cstdio>
+
+class RecordWriter {
+  public:
+    RecordWriter(const size_t samplesPerChunk = 8192, const size_t maxChunks = 32);
+    ~RecordWriter();
+
+    RecordWriter(const RecordWriter&) = delete;
+    RecordWriter& operator=(const RecordWriter&) = delete;
+
+    /**
+     * @brief start creates the file, writes the header and starts the writer thread.
+     * @return false if the file can not be created.
+     */
+    bool start(const std::string& path, const std::vector<RecordSignal>& signalTable, const int64_t startTimeMsSinceEpoch);
+
+    /**
+     * @brief append adds one sample. Called by the acquisition thread, O(1), no allocation after the chunk pool is filled.
+     * If all chunks are waiting for the disk, the sample is dropped and counted.
+     */
+    void append(const double time, const uint32_t signalId, const int64_t value);
+
+    /**
+     * @brief appendBlocking adds a block of samples, e.g. the pre-trigger window. Instead of dropping samples it waits
+     * until the writer thread has written a chunk. Called by the acquisition thread.
+     */
+    void appendBlocking(const std::vector<RecordSample>& samples);
+
+    /**
+     * @brief stop hands over the last chunk and waits until the writer thread has written the queued chunks.
+     * The time is bounded by the chunk pool size.
+     * @return false if a write failed (e.g. disk full), the file is incomplete then.
+     */
+    bool stop();
+
+    bool getIsRunning() const;
+    bool getIsWriteError() const; // set by the writer thread, the following chunks are dropped
+    std::string getPath() const;
+    uint64_t getSamplesWritten() const;
+    uint64_t getSamplesDropped() const;
+
+    /**
+     * @brief getStatistics session statistics of the physical values of the written samples per signal id of the file,
+     * updated by the writer thread.
+     */
+    const SignalStatistics& getStatistics() const;
+
+  protected:
+    /**
+     * The file format is defined by the following functions, the default is the native format (*.oxr).
+     * writeHeader() is called by start(), writeChunk() by the writer thread and writeTrailer() by stop() after the last chunk.
+     * They return false if a write failed.
+     */
+    virtual bool writeHeader(const int64_t startTimeMsSinceEpoch);
+    virtual bool writeChunk(const std::vector<RecordSample>& chunk);
+    virtual bool writeTrailer();
+
+    std::FILE* file;
+    std::vector<RecordSignal> signalTable;
+    std::vector<ConversionFunction> conversions; // index: signal id
+    SignalStatistics statistics;
+
+  private:
+    void writerLoop();
+    bool acquireChunk();
+    void addToChunkIndex(const std::vector<RecordSample>& chunk);
+
+    const size_t samplesPerChunk;
+    const size_t maxChunks;
+    std::string path;
+
+    std::vector<RecordSample>* currentChunk; // filled by append()
+    std::vector<std::vector<RecordSample>*> freeChunks;
+    std::deque<std::vector<RecordSample>*> fullChunks;
+    std::vector<std::unique_ptr<std::vector<RecordSample>>> chunkPool;
+
+    uint64_t filePosition; // native format: offset of the next chunk
+    std::vector<RecordChunkInfo> chunkIndex;
+    std::vector<RecordChunkSignal> chunkSignals; // index: signal id, reused for every chunk
+
+    std::thread writerThread;
+    std::mutex mutexChunks;
+    std::condition_variable chunkAvailable;
+    std::condition_variable chunkFree;
+    bool isStopRequested;
+    std::atomic<bool> isRunning;
+    std::atomic<bool> isWriteError;
+    std::atomic<uint64_t> samplesWritten;
+    std::atomic<uint64_t> samplesDropped;
+};
+
+#endif // RECORDWRITER_H
@@ -0,0 +1,231 @@
+/**
+*@file resampler.cpp
+*@author Michael Wolf
+*@date 19.10.2026
+*@brief Aligns the signals of a sample store on a common time base for the export: a fixed raster or the union of all
+* timestamps. The union is a k-way merge over the sorted columns, the values are interpolated per block of times.
+* The time base can be restricted to a window of the recording, when the store holds only this part of it.
+*/
+
+#include "resampler.h"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+namespace {
+bool isLaterEntry(const double timeA, const uint32_t signalIdA, const double timeB, const uint32_t signalIdB) {
+    return timeA > timeB || (timeA == timeB && signalIdA > signalIdB);
+}
+}
+
+Resampler::Resampler(const SampleStore& sampleStore, const Settings& settings)
+    : Resampler(sampleStore, settings, Window()) {
+
+}
+
+Resampler::Resampler(const SampleStore& sampleStore, const Settings& settings, const Window& window)
+    : sampleStore(sampleStore),
+      settings(settings),
+      window(window),
+      hasLastTime(window.hasTimeFrom),
+      lastTime(window.timeFrom),
+      samplesMerged(0),
+      samplesTotal(0),
+      rasterStart(0.0),
+      rasterIndex(0),
+      rasterCount(0) {
+
+    if(settings.timeBase == TIME_BASE::RASTER) {
+        initRaster();
+    } else {
+        initUnion();
+    }
+}
+
+size_t Resampler::nextTimes(std::vector<double>& times, const size_t maxCount) {
+    if(settings.timeBase == TIME_BASE::RASTER) {
+        return nextRasterTimes(times, maxCount);
+    }
+    return nextUnionTimes(times, maxCount);
+}
+
+double Resampler::getProgress() const {
+    if(settings.timeBase == TIME_BASE::RASTER) {
+        return rasterCount > 0 ? (double) rasterIndex / rasterCount : 1.0;
+    }
+    return samplesTotal > 0 ? (double) samplesMerged / samplesTotal : 1.0;
+}
+
+/***************************************************************
+*  Time base
+****************************************************************/
+void Resampler::initUnion() {
+    cursors.resize(sampleStore.getSignalCount());
+    samplesTotal = sampleStore.getSampleCount();
+    mergeHeap.reserve(cursors.size());
+    for(uint32_t signalId = 0; signalId < cursors.size(); signalId++) {
+        cursors[signalId] = sampleStore.getColumn(signalId).getFirstIndex();
+        pushMergeEntry(signalId);
+    }
+}
+
+void Resampler::pushMergeEntry(const uint32_t signalId) {
+    const SampleColumn& column = sampleStore.getColumn(signalId);
+    if(cursors[signalId] >= column.getSize()) {
+        return;
+    }
+    MergeEntry entry;
+    entry.time = column.getTime(cursors[signalId]);
+    entry.signalId = signalId;
+    mergeHeap.push_back(entry);
+    std::push_heap(mergeHeap.begin(), mergeHeap.end(), [](const MergeEntry& a, const MergeEntry& b) {
+        return isLaterEntry(a.time, a.signalId, b.time, b.signalId);
+    });
+}
+
+/**
+ * Pops the earliest sample of all columns, O(log k) per sample. Equal timestamps of several signals result in one time.
+ * Samples up to the end of the previous window only set the start of the interpolation, they are not repeated.
+ */
+size_t Resampler::nextUnionTimes(std::vector<double>& times, const size_t maxCount) {
+    size_t count = 0;
+    while(!mergeHeap.empty()) {
+        const MergeEntry entry = mergeHeap.front();
+        if(entry.time >= window.timeTo) {
+            break; // the next window starts here
+        }
+        if((!hasLastTime || entry.time > lastTime) && count == maxCount) {
+            break; // the next time belongs to the next block
+        }
+        std::pop_heap(mergeHeap.begin(), mergeHeap.end(), [](const MergeEntry& a, const MergeEntry& b) {
+            return isLaterEntry(a.time, a.signalId, b.time, b.signalId);
+        });
+        mergeHeap.pop_back();
+        cursors[entry.signalId]++;
+        samplesMerged++;
+        pushMergeEntry(entry.signalId);
+
+        if(!hasLastTime || entry.time > lastTime) {
+            times.push_back(entry.time);
+            lastTime = entry.time;
+            hasLastTime = true;
+            count++;
+        }
+    }
+    return count;
+}
+
+/**
+ * The raster starts at the first multiple of the interval at or before the first sample and ends at the last sample.
+ * In a window it continues after the last time of the previous window.
+ */
+void Resampler::initRaster() {
+    double firstTime = std::numeric_limits<double>::max();
+    double lastSampleTime = std::numeric_limits<double>::lowest();
+    if(window.hasRecordingRange) {
+        firstTime = window.recordingFirst;
+        lastSampleTime = window.recordingLast;
+    }
+    for(uint32_t signalId = 0; signalId < sampleStore.getSignalCount() && !window.hasRecordingRange; signalId++) {
+        const SampleColumn& column = sampleStore.getColumn(signalId);
+        if(column.getSize() > column.getFirstIndex()) {
+            firstTime = std::min(firstTime, column.getTime(column.getFirstIndex()));
+            lastSampleTime = std::max(lastSampleTime, column.getTime(column.getSize() - 1));
+        }
+    }
+    if(firstTime > lastSampleTime || settings.rasterInterval <= 0.0) {
+        return; // no samples
+    }
+    rasterStart = std::floor(firstTime / settings.rasterInterval) * settings.rasterInterval;
+    rasterCount = (uint64_t) std::floor((lastSampleTime - rasterStart) / settings.rasterInterval) + 1;
+    if(window.hasTimeFrom && window.timeFrom >= rasterStart) {
+        rasterIndex = std::min<uint64_t>(rasterCount, (uint64_t) std::floor((window.timeFrom - rasterStart) / settings.rasterInterval));
+        while(rasterIndex > 0 && getRasterTime(rasterIndex - 1) > window.timeFrom) {
+            rasterIndex--;
+        }
+        while(rasterIndex < rasterCount && getRasterTime(rasterIndex) <= window.timeFrom) {
+            rasterIndex++;
+        }
+    }
+}
+
+size_t Resampler::nextRasterTimes(std::vector<double>& times, const size_t maxCount) {
+    size_t count = 0;
+    while(count < maxCount && rasterIndex < rasterCount) {
+        double time = getRasterTime(rasterIndex);
+        if(time >= window.timeTo) {
+            break; // the next window starts here
+        }
+        times.push_back(time);
+        rasterIndex++;
+        count++;
+    }
+    return count;
+}
+
+double Resampler::getRasterTime(const uint64_t index) const {
+    return rasterStart + (double) index * settings.rasterInterval; // no accumulated rounding error
+}
+
+/***************************************************************
+*  Interpolation
+****************************************************************/
+/**
+ * A single forward sweep over the column gathers the samples around every time, the interpolation itself runs in a
+ * separate branch free loop over contiguous arrays which the compiler vectorises.
+ */
+void Resampler::resample(const uint32_t signalId, const double* times, const size_t count, double* values, Scratch& scratch) const {
+    if(count == 0) {
+        return;
+    }
+    const SampleColumn& column = sampleStore.getColumn(signalId);
+    const size_t size = column.getSize();
+    const bool isLinear = (settings.interpolation == INTERPOLATION::LINEAR);
+    static const double NO_VALUE = std::numeric_limits<double>::quiet_NaN();
+
+    scratch.time0.resize(count);
+    scratch.value0.resize(count);
+    scratch.time1.resize(count);
+    scratch.value1.resize(count);
+
+    size_t next = column.lowerBound(times[0]); // first sample after the time
+    for(size_t i = 0; i < count; i++) {
+        while(next < size && column.getTime(next) <= times[i]) {
+            next++;
+        }
+        if(next == column.getFirstIndex()) {
+            scratch.time0[i] = scratch.time1[i] = times[i];
+            scratch.value0[i] = scratch.value1[i] = NO_VALUE;
+            continue;
+        }
+        scratch.time0[i] = column.getTime(next - 1);
+        scratch.value0[i] = column.getValueAsDouble(next - 1);
+        if(isLinear && next < size) {
+            scratch.time1[i] = column.getTime(next);
+            scratch.value1[i] = column.getValueAsDouble(next);
+        } else {
+            scratch.time1[i] = scratch.time0[i];
+            scratch.value1[i] = scratch.value0[i];
+        }
+    }
+
+    if(isLinear) {
+        linearKernel(times, scratch.time0.data(), scratch.value0.data(), scratch.time1.data(), scratch.value1.data(), values, count);
+    } else {
+        holdKernel(scratch.value0.data(), values, count);
+    }
+}
+
+void Resampler::holdKernel(const double* value0, double* values, const size_t count) {
+    std::copy(value0, value0 + count, values);
+}
+
+void Resampler::linearKernel(const double* times, const double* time0, const double* value0, const double* time1, const double* value1,
+                             double* values, const size_t count) {
+    for(size_t i = 0; i < count; i++) {
+        double interval = time1[i] - time0[i];
+        double weight = interval > 0.0 ? (times[i] - time0[i]) / interval : 0.0;
+        values[i] = value0[i] + weight * (value1[i] - value0[i]);
+    }
+}
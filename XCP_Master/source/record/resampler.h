@@ -0,0 +1,105 @@
+/**
+*@file resampler.h
+*@author Michael Wolf
+*@date 19.10.2026
+*@brief Aligns the signals of a sample store on a common time base for the export: a fixed raster or the union of all
+* timestamps. The union is a k-way merge over the sorted columns, the values are interpolated per block of times.
+* The time base can be restricted to a window of the recording, when the store holds only this part of it.
+*/
+
+#ifndef RESAMPLER_H
+#define RESAMPLER_H
+
+#include "sampleStore.h"
+
+#include <vector>
+#include <limits>
+#include <stdint.h>
+#include <stddef.h>
+
+class Resampler {
+  public:
+    enum class TIME_BASE {SAMPLES, UNION, RASTER}; // SAMPLES: rows of samples within one millisecond, no resampling
+    enum class INTERPOLATION {ZERO_ORDER_HOLD, LINEAR};
+
+    struct Settings {
+        TIME_BASE timeBase = TIME_BASE::SAMPLES;
+        INTERPOLATION interpolation = INTERPOLATION::ZERO_ORDER_HOLD;
+        double rasterInterval = 0.01; // s
+    };
+
+    /**
+     * @brief The Window struct restricts the time base to a part of the recording (see RecordWindowReader). Times up to
+     * timeFrom were generated for the previous window, times from timeTo on belong to the next window. The raster is
+     * aligned to the time range of the whole recording instead of the samples in the store.
+     */
+    struct Window {
+        bool hasTimeFrom = false;
+        double timeFrom = 0.0;
+        double timeTo = std::numeric_limits<double>::infinity();
+        bool hasRecordingRange = false;
+        double recordingFirst = 0.0;
+        double recordingLast = 0.0;
+    };
+
+    /**
+     * @brief The Scratch struct holds the neighbouring samples of every time of a block, reused between blocks.
+     */
+    struct Scratch {
+        std::vector<double> time0, value0, time1, value1;
+    };
+
+    Resampler(const SampleStore& sampleStore, const Settings& settings);
+    Resampler(const SampleStore& sampleStore, const Settings& settings, const Window& window);
+
+    /**
+     * @brief nextTimes appends the next times of the time base, ascending and without duplicates. Not thread safe.
+     * @return number of appended times, 0 at the end of the recording.
+     */
+    size_t nextTimes(std::vector<double>& times, const size_t maxCount);
+
+    /**
+     * @return part of the time base generated so far, 0.0 .. 1.0.
+     */
+    double getProgress() const;
+
+    /**
+     * @brief resample interpolates one signal at ascending times. The value before the first sample of the signal is NaN,
+     * after the last sample it is held. Thread safe, blocks of times are resampled in parallel.
+     */
+    void resample(const uint32_t signalId, const double* times, const size_t count, double* values, Scratch& scratch) const;
+
+  private:
+    struct MergeEntry {
+        double time;
+        uint32_t signalId;
+    };
+
+    void initUnion();
+    void initRaster();
+    size_t nextUnionTimes(std::vector<double>& times, const size_t maxCount);
+    size_t nextRasterTimes(std::vector<double>& times, const size_t maxCount);
+    double getRasterTime(const uint64_t index) const;
+    void pushMergeEntry(const uint32_t signalId);
+
+    static void holdKernel(const double* value0, double* values, const size_t count);
+    static void linearKernel(const double* times, const double* time0, const double* value0, const double* time1, const double* value1,
+                             double* values, const size_t count);
+
+    const SampleStore& sampleStore;
+    Settings settings;
+    Window window;
+
+    std::vector<MergeEntry> mergeHeap; // min heap, the next sample of every column
+    std::vector<size_t> cursors; // next sample per signal
+    bool hasLastTime;
+    double lastTime;
+    uint64_t samplesMerged;
+    uint64_t samplesTotal;
+
+    double rasterStart;
+    uint64_t rasterIndex;
+    uint64_t rasterCount;
+};
+
+#endif // RESAMPLER_H
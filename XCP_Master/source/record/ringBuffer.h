@@ -0,0 +1,132 @@
+/**
+*@file ringBuffer.h
+*@author Michael Wolf
+*@date 19.10.2026
+*@brief Fixed capacity ring buffer for the value history of a signal. One writer, any number of readers, no locks:
+* the readers never block the acquisition, instead they detect if the writer has overwritten the values they have read.
+*/
+
+#ifndef RINGBUFFER_H
+#define RINGBUFFER_H
+
+#include <vector>
+#include <atomic>
+#include <memory>
+#include <algorithm>
+#include <stdint.h>
+#include <stddef.h>
+
+template<typename T>
+class RingBuffer {
+  public:
+    /**
+     * @param depth number of values which can be read, the capacity is the next power of two above it.
+     */
+    explicit RingBuffer(const size_t depth = 1023) {
+        setDepth(depth);
+    }
+
+    RingBuffer(const RingBuffer&) = delete;
+    RingBuffer& operator=(const RingBuffer&) = delete;
+
+    /**
+     * @brief setDepth reallocates the buffer and discards the history. Not thread safe, for configuration only.
+     */
+    void setDepth(const size_t depth) {
+        size_t capacity = 1;
+        while(capacity < depth + 1) { // one slot is reserved for the value which is just written
+            capacity <<= 1;
+        }
+        slots.reset(new Slot[capacity]);
+        for(size_t i = 0; i < capacity; i++) {
+            slots[i].sequence.store(0, std::memory_order_relaxed);
+            slots[i].value = T();
+        }
+        mask = capacity - 1;
+        head.store(0, std::memory_order_relaxed);
+        first.store(0, std::memory_order_relaxed);
+    }
+
+    size_t getDepth() const {
+        return mask;
+    }
+
+    /**
+     * @brief push is called by the single writer, O(1) and without allocation. The oldest value is overwritten.
+     * The sequence of the slot is odd while the value is written, 2 * (index + 1) afterwards.
+     */
+    void push(const T& value) {
+        uint64_t index = head.load(std::memory_order_relaxed);
+        Slot& slot = slots[index & mask];
+        slot.sequence.store(2 * index + 1, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_release);
+        slot.value = value;
+        slot.sequence.store(2 * index + 2, std::memory_order_release);
+        head.store(index + 1, std::memory_order_release);
+    }
+
+    /**
+     * @brief clear discards the history, called by the writer.
+     */
+    void clear() {
+        first.store(head.load(std::memory_order_relaxed), std::memory_order_release);
+    }
+
+    /**
+     * @return number of values pushed since the last clear, readers can detect new values by comparing it.
+     */
+    uint64_t getCount() const {
+        return head.load(std::memory_order_acquire) - first.load(std::memory_order_acquire);
+    }
+
+    size_t getSize() const {
+        return (size_t) std::min<uint64_t>(getCount(), mask);
+    }
+
+    /**
+     * @brief snapshot copies the latest values, oldest first. A value is only used if the sequence of its slot is the
+     * same before and after the copy. If the writer overtakes the reader, the copy is repeated.
+     * @return number of copied values, 0 if no consistent copy could be made.
+     */
+    size_t snapshot(T* out, const size_t count) const {
+        static const int MAX_ATTEMPTS = 4;
+        for(int attempt = 0; attempt < MAX_ATTEMPTS; attempt++) {
+            uint64_t begin = first.load(std::memory_order_acquire);
+            uint64_t end = head.load(std::memory_order_acquire);
+            size_t copied = (size_t) std::min<uint64_t>(count, std::min<uint64_t>(end - begin, mask));
+            uint64_t start = end - copied;
+            bool isConsistent = true;
+            for(size_t i = 0; i < copied && isConsistent; i++) {
+                uint64_t index = start + i;
+                const Slot& slot = slots[index & mask];
+                uint64_t sequence = slot.sequence.load(std::memory_order_acquire);
+                out[i] = slot.value;
+                std::atomic_thread_fence(std::memory_order_acquire);
+                isConsistent = (sequence == 2 * index + 2) && (slot.sequence.load(std::memory_order_relaxed) == sequence);
+            }
+            if(isConsistent) {
+                return copied;
+            }
+        }
+        return 0;
+    }
+
+    std::vector<T> snapshot(const size_t count) const {
+        std::vector<T> values(std::min(count, mask));
+        values.resize(snapshot(values.data(), values.size()));
+        return values;
+    }
+
+  private:
+    struct Slot {
+        std::atomic<uint64_t> sequence; // odd while the writer updates the slot
+        T value;
+    };
+
+    std::unique_ptr<Slot[]> slots;
+    size_t mask;
+    std::atomic<uint64_t> head; // index of the next value, increases monotonically
+    std::atomic<uint64_t> first; // index of the first value after the last clear
+};
+
+#endif // RINGBUFFER_H
@@ -0,0 +1,32 @@
+/**
+*@file sampleSpan.h
+*@author Michael Wolf
+*@date 19.10.2026
+*@brief Read only view on contiguous samples, used by the sample store and the value history.
+*/
+
+#ifndef SAMPLESPAN_H
+#define SAMPLESPAN_H
+
+#include <stddef.h>
+
+template<typename T>
+struct SampleSpan {
+    const T* data = nullptr;
+    size_t size = 0;
+
+    const T* begin() const {
+        return data;
+    }
+    const T* end() const {
+        return data + size;
+    }
+    const T& operator[](const size_t index) const {
+        return data[index];
+    }
+    bool empty() const {
+        return size == 0;
+    }
+};
+
+#endif // SAMPLESPAN_H
@@ -0,0 +1,274 @@
+/**
+*@file sampleStore.cpp
+*@author Michael Wolf
+*@date 19.10.2026
+*@brief Columnar in-memory store of the recorded samples. Every signal has a time column and a value column,
+* stored in fixed size chunks. The value column uses the width of the signal, a sample needs 9 to 12 bytes for signals up to 32 bit
+* and 16 bytes for 64 bit signals (the time stays a double). A column can be bounded to a number of chunks, then the chunks
+* are a ring: the slot of the oldest chunk is reused for the newest samples, nothing is moved.
+*/
+
+#include "sampleStore.h"
+
+#include <algorithm>
+#include <cstring>
+
+/***************************************************************
+*  SampleColumn
+****************************************************************/
+const size_t SampleColumn::DEFAULT_SAMPLES_PER_CHUNK;
+
+SampleColumn::SampleColumn(const uint8_t valueSize, const bool isUnsigned, const bool isFloat, const size_t samplesPerChunk, const size_t maxChunks)
+    : isUnsigned(isUnsigned),
+      isFloat(isFloat),
+      samplesPerChunk(samplesPerChunk),
+      maxChunks(maxChunks),
+      size(0),
+      firstChunk(0) {
+
+    if(valueSize <= 1) {
+        this->valueSize = 1;
+    } else if(valueSize <= 2) {
+        this->valueSize = 2;
+    } else if(valueSize <= 4) {
+        this->valueSize = 4;
+    } else {
+        this->valueSize = 8;
+    }
+}
+
+void SampleColumn::append(const double time, const int64_t value) {
+    size_t chunkIndex = size / samplesPerChunk - firstChunk;
+    size_t indexInChunk = size % samplesPerChunk;
+    if(chunkIndex == chunks.size()) {
+        if(maxChunks > 0 && chunks.size() >= maxChunks) {
+            firstChunk++; // the newest chunk takes the slot of the oldest
+            chunkIndex--;
+        } else {
+            Chunk chunk;
+            chunk.time.reset(new double[samplesPerChunk]);
+            chunk.values.reset(new uint8_t[samplesPerChunk * valueSize]);
+            chunks.push_back(std::move(chunk));
+        }
+    }
+    Chunk& chunk = chunks[(firstChunk + chunkIndex) % chunks.size()];
+    chunk.time[indexInChunk] = time;
+
+    uint8_t* raw = chunk.values.get() + indexInChunk * valueSize;
+    switch (valueSize) {
+    case 1: {
+        uint8_t typed = (uint8_t) value;
+        std::memcpy(raw, &typed, sizeof(typed));
+        break;
+    }
+    case 2: {
+        uint16_t typed = (uint16_t) value;
+        std::memcpy(raw, &typed, sizeof(typed));
+        break;
+    }
+    case 4: {
+        uint32_t typed = (uint32_t) value;
+        std::memcpy(raw, &typed, sizeof(typed));
+        break;
+    }
+    default:
+        std::memcpy(raw, &value, sizeof(value));
+        break;
+    }
+    size++;
+}
+
+void SampleColumn::clear() {
+    chunks.clear();
+    size = 0;
+    firstChunk = 0;
+}
+
+size_t SampleColumn::getSize() const {
+    return size;
+}
+
+size_t SampleColumn::getFirstIndex() const {
+    return firstChunk * samplesPerChunk;
+}
+
+size_t SampleColumn::getChunkCount() const {
+    return chunks.size();
+}
+
+SampleSpan<double> SampleColumn::getTimeSpan(const size_t chunkIndex) const {
+    SampleSpan<double> span;
+    if(chunkIndex < chunks.size()) {
+        span.data = getChunk(chunkIndex).time.get();
+        span.size = std::min(samplesPerChunk, size - (firstChunk + chunkIndex) * samplesPerChunk);
+    }
+    return span;
+}
+
+SampleSpan<uint8_t> SampleColumn::getRawValueSpan(const size_t chunkIndex) const {
+    SampleSpan<uint8_t> span;
+    if(chunkIndex < chunks.size()) {
+        span.data = getChunk(chunkIndex).values.get();
+        span.size = std::min(samplesPerChunk, size - (firstChunk + chunkIndex) * samplesPerChunk) * valueSize;
+    }
+    return span;
+}
+
+double SampleColumn::getTime(const size_t index) const {
+    return getChunk(index / samplesPerChunk - firstChunk).time[index % samplesPerChunk];
+}
+
+int64_t SampleColumn::getValue(const size_t index) const {
+    return decodeValue(getChunk(index / samplesPerChunk - firstChunk).values.get() + (index % samplesPerChunk) * valueSize);
+}
+
+double SampleColumn::getValueAsDouble(const size_t index) const {
+    int64_t value = getValue(index);
+    if(isFloat) {
+        if(valueSize == sizeof(float)) {
+            float typed;
+            uint32_t raw = (uint32_t) value;
+            std::memcpy(&typed, &raw, sizeof(typed));
+            return typed;
+        }
+        if(valueSize == sizeof(double)) {
+            double typed;
+            std::memcpy(&typed, &value, sizeof(typed));
+            return typed;
+        }
+    }
+    if(isUnsigned) {
+        return (double) (uint64_t) value;
+    }
+    return (double) value;
+}
+
+const SampleColumn::Chunk& SampleColumn::getChunk(const size_t chunkIndex) const {
+    return chunks[(firstChunk + chunkIndex) % chunks.size()];
+}
+
+int64_t SampleColumn::decodeValue(const uint8_t* raw) const {
+    switch (valueSize) {
+    case 1: {
+        uint8_t typed;
+        std::memcpy(&typed, raw, sizeof(typed));
+        return isUnsigned ? (int64_t) typed : (int64_t) (int8_t) typed;
+    }
+    case 2: {
+        uint16_t typed;
+        std::memcpy(&typed, raw, sizeof(typed));
+        return isUnsigned ? (int64_t) typed : (int64_t) (int16_t) typed;
+    }
+    case 4: {
+        uint32_t typed;
+        std::memcpy(&typed, raw, sizeof(typed));
+        return isUnsigned ? (int64_t) typed : (int64_t) (int32_t) typed;
+    }
+    default: {
+        int64_t typed;
+        std::memcpy(&typed, raw, sizeof(typed));
+        return typed;
+    }
+    }
+}
+
+/**
+ * The samples are appended in time order, so the chunks are sorted: first the chunk, then the sample in the chunk.
+ */
+size_t SampleColumn::lowerBound(const double time) const {
+    size_t first = 0, count = chunks.size();
+    while(count > 0) {
+        size_t step = count / 2;
+        size_t middle = first + step;
+        SampleSpan<double> span = getTimeSpan(middle);
+        if(span[span.size - 1] < time) {
+            first = middle + 1;
+            count -= step + 1;
+        } else {
+            count = step;
+        }
+    }
+    size_t chunkIndex = first;
+    if(chunkIndex == chunks.size()) {
+        return size;
+    }
+    SampleSpan<double> span = getTimeSpan(chunkIndex);
+    return (firstChunk + chunkIndex) * samplesPerChunk + (std::lower_bound(span.begin(), span.end(), time) - span.begin());
+}
+
+size_t SampleColumn::getMemoryUsage() const {
+    return chunks.size() * samplesPerChunk * (sizeof(double) + valueSize);
+}
+
+uint8_t SampleColumn::getValueSize() const {
+    return valueSize;
+}
+
+bool SampleColumn::getIsUnsigned() const {
+    return isUnsigned;
+}
+
+bool SampleColumn::getIsFloat() const {
+    return isFloat;
+}
+
+/***************************************************************
+*  SampleStore
+****************************************************************/
+SampleStore::SampleStore() {
+
+}
+
+void SampleStore::init(const std::vector<RecordSignal>& signalTable, const size_t memoryLimit) {
+    static const size_t MIN_CHUNKS = 2; // the newest samples are always a full chunk
+    this->signalTable = signalTable;
+    columns.clear();
+    columns.reserve(signalTable.size());
+    for(const auto& signal : signalTable) {
+        size_t maxChunks = 0;
+        if(memoryLimit > 0) {
+            size_t chunkSize = SampleColumn::DEFAULT_SAMPLES_PER_CHUNK * (sizeof(double) + std::max<size_t>(signal.size, 1));
+            maxChunks = std::max(MIN_CHUNKS, memoryLimit / signalTable.size() / chunkSize);
+        }
+        columns.emplace_back(signal.size, signal.isUnsigned, signal.isFloat, SampleColumn::DEFAULT_SAMPLES_PER_CHUNK, maxChunks);
+    }
+}
+
+void SampleStore::clear() {
+    signalTable.clear();
+    columns.clear();
+}
+
+void SampleStore::append(const uint32_t signalId, const double time, const int64_t value) {
+    if(signalId < columns.size()) {
+        columns[signalId].append(time, value);
+    }
+}
+
+size_t SampleStore::getSignalCount() const {
+    return columns.size();
+}
+
+const SampleColumn& SampleStore::getColumn(const uint32_t signalId) const {
+    return columns.at(signalId);
+}
+
+const std::vector<RecordSignal>& SampleStore::getSignalTable() const {
+    return signalTable;
+}
+
+size_t SampleStore::getSampleCount() const {
+    size_t count = 0;
+    for(const auto& column : columns) {
+        count += column.getSize() - column.getFirstIndex();
+    }
+    return count;
+}
+
+size_t SampleStore::getMemoryUsage() const {
+    size_t memory = 0;
+    for(const auto& column : columns) {
+        memory += column.getMemoryUsage();
+    }
+    return memory;
+}
@@ -0,0 +1,112 @@
+/**
+*@file sampleStore.h
+*@author Michael Wolf
+*@date 19.10.2026
+*@brief Columnar in-memory store of the recorded samples. Every signal has a time column and a value column,
+* stored in fixed size chunks. The value column uses the width of the signal, a sample needs 9 to 12 bytes for signals up to 32 bit
+* and 16 bytes for 64 bit signals (the time stays a double). A column can be bounded to a number of chunks, then the chunks
+* are a ring: the slot of the oldest chunk is reused for the newest samples, nothing is moved.
+*/
+
+#ifndef SAMPLESTORE_H
+#define SAMPLESTORE_H
+
+#include "recordFileFormat.h"
+#include "sampleSpan.h"
+
+#include <vector>
+#include <memory>
+#include <stdint.h>
+#include <stddef.h>
+
+class SampleColumn {
+  public:
+    static const size_t DEFAULT_SAMPLES_PER_CHUNK = 4096;
+
+    /**
+     * @param maxChunks chunks kept in memory, 0: unbounded.
+     */
+    SampleColumn(const uint8_t valueSize = 4, const bool isUnsigned = false, const bool isFloat = false,
+                 const size_t samplesPerChunk = DEFAULT_SAMPLES_PER_CHUNK, const size_t maxChunks = 0);
+
+    /**
+     * @brief append adds one sample, O(1). Memory is allocated once per chunk, not per sample. If the column is bounded
+     * and full, the oldest chunk is dropped and its memory is reused.
+     * @param value raw value, it is truncated to the value size.
+     */
+    void append(const double time, const int64_t value);
+    void clear();
+
+    /**
+     * @return index after the last sample. The index of a sample stays the same when older samples are dropped.
+     */
+    size_t getSize() const;
+
+    /**
+     * @return index of the oldest sample in memory, 0 if nothing was dropped. The samples [getFirstIndex(), getSize()) can be read.
+     */
+    size_t getFirstIndex() const;
+    size_t getChunkCount() const; // chunks in memory
+    SampleSpan<double> getTimeSpan(const size_t chunkIndex) const; // chunkIndex 0: oldest chunk in memory
+    SampleSpan<uint8_t> getRawValueSpan(const size_t chunkIndex) const; // getValueSize() bytes per sample
+
+    double getTime(const size_t index) const;
+    int64_t getValue(const size_t index) const; // raw value, sign or zero extended
+    double getValueAsDouble(const size_t index) const; // float signals are converted from their raw bits
+
+    /**
+     * @brief lowerBound finds the first sample in memory at or after time.
+     * @return index of the sample or getSize().
+     */
+    size_t lowerBound(const double time) const;
+
+    size_t getMemoryUsage() const;
+    uint8_t getValueSize() const;
+    bool getIsUnsigned() const;
+    bool getIsFloat() const;
+
+  private:
+    struct Chunk {
+        std::unique_ptr<double[]> time;
+        std::unique_ptr<uint8_t[]> values;
+    };
+
+    const Chunk& getChunk(const size_t chunkIndex) const;
+    int64_t decodeValue(const uint8_t* raw) const;
+
+    uint8_t valueSize;
+    bool isUnsigned;
+    bool isFloat;
+    size_t samplesPerChunk;
+    size_t maxChunks;
+    size_t size;
+    size_t firstChunk; // number of dropped chunks
+    std::vector<Chunk> chunks; // ring, chunk firstChunk + i is in slot (firstChunk + i) % chunks.size()
+};
+
+class SampleStore {
+  public:
+    SampleStore();
+
+    /**
+     * @brief init creates one column per signal, the signal id is the index in the signal table.
+     * @param memoryLimit bytes shared evenly by the columns, the oldest samples of a column are dropped when it reaches
+     * its share (at least two chunks are kept). 0: unbounded.
+     */
+    void init(const std::vector<RecordSignal>& signalTable, const size_t memoryLimit = 0);
+    void clear();
+
+    void append(const uint32_t signalId, const double time, const int64_t value);
+
+    size_t getSignalCount() const;
+    const SampleColumn& getColumn(const uint32_t signalId) const;
+    const std::vector<RecordSignal>& getSignalTable() const;
+    size_t getSampleCount() const; // samples in memory
+    size_t getMemoryUsage() const;
+
+  private:
+    std::vector<RecordSignal> signalTable;
+    std::vector<SampleColumn> columns;
+};
+
+#endif // SAMPLESTORE_H
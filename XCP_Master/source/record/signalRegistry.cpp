@@ -0,0 +1,100 @@
+/**
+*@file signalRegistry.cpp
+*@author Michael Wolf
+*@date 19.10.2026
+*@brief Assigns a dense signal id to every RecordElement of a session. The id is used to identify a value from the
+* polling list or a DAQ list up to the consumers and indexes the precomputed type information of the signal.
+*/
+
+#include "signalRegistry.h"
+
+#include <algorithm>
+#include <cstring>
+
+SignalRegistry::SignalRegistry() {
+
+}
+
+void SignalRegistry::build(const QList<std::shared_ptr<RecordElement>>& recordElements) {
+    signalInfos.clear();
+    signalInfos.reserve(recordElements.size());
+    for(const auto& recordElement : recordElements) {
+        std::shared_ptr<ParseResultBase> parseResult = recordElement->getParseResult();
+        SignalInfo signal;
+        signal.recordElement = recordElement;
+        signal.address = parseResult->getAddress();
+        signal.size = (uint8_t) parseResult->getSize();
+        signal.isUnsigned = (parseResult->getDataType().find("unsigned") != std::string::npos);
+        signal.isFloat = recordElement->getIsFloat();
+        signal.isMeasurement = (parseResult->getSrcMeasurement() != nullptr);
+        if(signal.isMeasurement) {
+            signal.conversion.compile(parseResult->getSrcMeasurement()->getConversionFunction());
+        }
+        signalInfos.push_back(signal);
+    }
+    std::stable_sort(signalInfos.begin(), signalInfos.end(), [](const SignalInfo& a, const SignalInfo& b) {
+        return a.address < b.address;
+    });
+    for(uint32_t signalId = 0; signalId < signalInfos.size(); signalId++) {
+        signalInfos[signalId].recordElement->setSignalId(signalId);
+    }
+}
+
+void SignalRegistry::clear() {
+    for(auto& signal : signalInfos) {
+        signal.recordElement->setSignalId(INVALID_ID);
+    }
+    signalInfos.clear();
+}
+
+uint32_t SignalRegistry::getSize() const {
+    return (uint32_t) signalInfos.size();
+}
+
+bool SignalRegistry::isValid(const uint32_t signalId) const {
+    return signalId < signalInfos.size();
+}
+
+const SignalInfo& SignalRegistry::getSignal(const uint32_t signalId) const {
+    return signalInfos[signalId];
+}
+
+uint32_t SignalRegistry::findByAddress(const uint64_t address) const {
+    auto it = std::lower_bound(signalInfos.begin(), signalInfos.end(), address, [](const SignalInfo& signal, uint64_t address) {
+        return signal.address < address;
+    });
+    if(it == signalInfos.end() || it->address != address) {
+        return INVALID_ID;
+    }
+    return (uint32_t) (it - signalInfos.begin());
+}
+
+int64_t SignalRegistry::toValue(const uint32_t signalId, const uint32_t raw) const {
+    const SignalInfo& signal = signalInfos[signalId];
+    if(signal.isUnsigned) {
+        return (int64_t) raw;
+    }
+    switch (signal.size) {
+    case 1:
+        return (int64_t) (int8_t) raw;
+    case 2:
+        return (int64_t) (int16_t) raw;
+    default:
+        return (int64_t) (int32_t) raw;
+    }
+}
+
+double SignalRegistry::toDouble(const uint32_t signalId, const int64_t value) const {
+    const SignalInfo& signal = signalInfos[signalId];
+    if(signal.isFloat && signal.size == sizeof(float)) {
+        float typed;
+        uint32_t bits = (uint32_t) value;
+        std::memcpy(&typed, &bits, sizeof(typed));
+        return typed;
+    }
+    return (double) value;
+}
+
+double SignalRegistry::toPhysical(const uint32_t signalId, const int64_t value) const {
+    return signalInfos[signalId].conversion.convert(toDouble(signalId, value));
+}
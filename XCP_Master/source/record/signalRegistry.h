@@ -0,0 +1,73 @@
+/**
+*@file signalRegistry.h
+*@author Michael Wolf
+*@date 19.10.2026
+*@brief Assigns a dense signal id to every RecordElement of a session. The id is used to identify a value from the
+* polling list or a DAQ list up to the consumers and indexes the precomputed type information of the signal.
+*/
+
+#ifndef SIGNALREGISTRY_H
+#define SIGNALREGISTRY_H
+
+#include "recordElement.h"
+#include "conversionFunction.h"
+
+#include <memory>
+#include <vector>
+#include <stdint.h>
+
+#include <QList>
+
+struct SignalInfo {
+    std::shared_ptr<RecordElement> recordElement;
+    uint64_t address;
+    uint8_t size;
+    bool isUnsigned;
+    bool isFloat;
+    bool isMeasurement; // false: characteristic
+    ConversionFunction conversion; // raw to physical value, identity if the conversion is missing or invalid
+};
+
+class SignalRegistry {
+  public:
+    static const uint32_t INVALID_ID = 0xFFFFFFFF;
+
+    SignalRegistry();
+
+    /**
+     * @brief build assigns the ids 0..n-1 to the record elements, sorted by address, and stores the id in the record element.
+     * Called at connect, the record elements do not change while the slave is connected.
+     */
+    void build(const QList<std::shared_ptr<RecordElement>>& recordElements);
+    void clear();
+
+    uint32_t getSize() const;
+    bool isValid(const uint32_t signalId) const;
+    const SignalInfo& getSignal(const uint32_t signalId) const;
+
+    /**
+     * @brief findByAddress binary search, for configuration only. The data path uses the signal id.
+     * @return signal id or INVALID_ID.
+     */
+    uint32_t findByAddress(const uint64_t address) const;
+
+    /**
+     * @brief toValue sign or zero extends a raw value received from the slave (at most 32 bit) according to the signal type.
+     */
+    int64_t toValue(const uint32_t signalId, const uint32_t raw) const;
+
+    /**
+     * @brief toDouble converts a value returned by toValue() to a number, float signals are received as their bits.
+     */
+    double toDouble(const uint32_t signalId, const int64_t value) const;
+
+    /**
+     * @brief toPhysical converts a value returned by toValue() to the physical value with the conversion of the signal.
+     */
+    double toPhysical(const uint32_t signalId, const int64_t value) const;
+
+  private:
+    std::vector<SignalInfo> signalInfos; // index: signal id
+};
+
+#endif // SIGNALREGISTRY_H
@@ -0,0 +1,161 @@
+/**
+*@file signalStatistics.cpp
+*@author Michael Wolf
+*@date 19.10.2026
+*@brief Streaming statistics per signal id: count, min, max, mean, standard deviation and rate, updated in O(1) per
+* sample with Welford's algorithm. Session-wide and per fixed time window. One writer, readers do not lock.
+*/
+
+#include "signalStatistics.h"
+
+#include <cmath>
+#include <algorithm>
+
+SignalStatistics::SignalStatistics(const double windowSeconds)
+    : windowSeconds(windowSeconds),
+      signalCount(0) {
+
+}
+
+void SignalStatistics::init(const size_t signalCount) {
+    this->signalCount = signalCount;
+    slots.reset(new Slot[signalCount]);
+    for(size_t i = 0; i < signalCount; i++) {
+        Slot& slot = slots[i];
+        slot.sequence.store(0, std::memory_order_relaxed);
+        clear(slot.session);
+        clear(slot.window);
+        clear(slot.lastWindow);
+        slot.windowStart = 0.0;
+    }
+}
+
+size_t SignalStatistics::getSignalCount() const {
+    return signalCount;
+}
+
+double SignalStatistics::getWindowSeconds() const {
+    return windowSeconds;
+}
+
+/**
+ * Sequence lock: the sequence is odd while the slot is updated, a reader which sees an odd or changed sequence retries.
+ * The window is aligned to multiples of the window length, a window without samples results in an empty last window.
+ */
+void SignalStatistics::add(const uint32_t signalId, const double time, const double value) {
+    if(signalId >= signalCount) {
+        return;
+    }
+    Slot& slot = slots[signalId];
+    uint32_t sequence = slot.sequence.load(std::memory_order_relaxed);
+    slot.sequence.store(sequence + 1, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+
+    double windowStart = std::floor(time / windowSeconds) * windowSeconds;
+    if(windowStart > slot.windowStart) {
+        startWindow(slot, windowStart);
+    }
+    addTo(slot.window, time, value);
+    addTo(slot.session, time, value);
+
+    slot.sequence.store(sequence + 2, std::memory_order_release);
+}
+
+/**
+ * A signal whose windows are empty already is skipped, the slot is only written if the last window changes.
+ */
+void SignalStatistics::advance(const double time, std::vector<uint32_t>& changedSignalIds) {
+    double windowStart = std::floor(time / windowSeconds) * windowSeconds;
+    for(uint32_t signalId = 0; signalId < signalCount; signalId++) {
+        Slot& slot = slots[signalId];
+        if(windowStart <= slot.windowStart || (slot.window.count == 0 && slot.lastWindow.count == 0)) {
+            continue;
+        }
+        uint32_t sequence = slot.sequence.load(std::memory_order_relaxed);
+        slot.sequence.store(sequence + 1, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_release);
+        startWindow(slot, windowStart);
+        slot.sequence.store(sequence + 2, std::memory_order_release);
+        changedSignalIds.push_back(signalId);
+    }
+}
+
+bool SignalStatistics::read(const uint32_t signalId, const SCOPE scope, Summary& summary) const {
+    if(signalId >= signalCount) {
+        return false;
+    }
+    static const int MAX_ATTEMPTS = 8;
+    const Slot& slot = slots[signalId];
+    for(int attempt = 0; attempt < MAX_ATTEMPTS; attempt++) {
+        uint32_t sequenceBefore = slot.sequence.load(std::memory_order_acquire);
+        if(sequenceBefore & 1) {
+            continue;
+        }
+        Accumulator accumulator = (scope == SCOPE::SESSION) ? slot.session : slot.lastWindow;
+        std::atomic_thread_fence(std::memory_order_acquire);
+        if(slot.sequence.load(std::memory_order_relaxed) == sequenceBefore) {
+            summary = toSummary(accumulator, scope == SCOPE::WINDOW);
+            return true;
+        }
+    }
+    return false;
+}
+
+/**
+ * The filled window becomes the last window if it ended right before the new one, otherwise the last window had no samples.
+ */
+void SignalStatistics::startWindow(Slot& slot, const double windowStart) const {
+    bool isAdjacent = (windowStart - slot.windowStart) < 1.5 * windowSeconds;
+    slot.lastWindow = slot.window;
+    if(!isAdjacent) {
+        clear(slot.lastWindow);
+    }
+    clear(slot.window);
+    slot.windowStart = windowStart;
+}
+
+void SignalStatistics::clear(Accumulator& accumulator) {
+    accumulator.count = 0;
+    accumulator.mean = 0.0;
+    accumulator.m2 = 0.0;
+    accumulator.min = 0.0;
+    accumulator.max = 0.0;
+    accumulator.timeFirst = 0.0;
+    accumulator.timeLast = 0.0;
+}
+
+/**
+ * Welford: the mean and the squared deviations are updated incrementally, stable for large counts and offsets.
+ */
+void SignalStatistics::addTo(Accumulator& accumulator, const double time, const double value) {
+    accumulator.count++;
+    if(accumulator.count == 1) {
+        accumulator.min = value;
+        accumulator.max = value;
+        accumulator.timeFirst = time;
+    } else {
+        accumulator.min = std::min(accumulator.min, value);
+        accumulator.max = std::max(accumulator.max, value);
+    }
+    accumulator.timeLast = time;
+    double delta = value - accumulator.mean;
+    accumulator.mean += delta / accumulator.count;
+    accumulator.m2 += delta * (value - accumulator.mean);
+}
+
+SignalStatistics::Summary SignalStatistics::toSummary(const Accumulator& accumulator, const bool isWindow) const {
+    Summary summary;
+    summary.count = accumulator.count;
+    summary.min = accumulator.min;
+    summary.max = accumulator.max;
+    summary.mean = accumulator.mean;
+    summary.stdDev = accumulator.count > 1 ? std::sqrt(accumulator.m2 / (accumulator.count - 1)) : 0.0;
+    summary.timeFirst = accumulator.timeFirst;
+    summary.timeLast = accumulator.timeLast;
+    if(isWindow) {
+        summary.rate = accumulator.count / windowSeconds;
+    } else if(accumulator.timeLast > accumulator.timeFirst) {
+        summary.rate = (accumulator.count - 1) / (accumulator.timeLast - accumulator.timeFirst);
+    }
+    return summary;
+}
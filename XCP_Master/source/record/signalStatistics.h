@@ -0,0 +1,95 @@
+/**
+*@file signalStatistics.h
+*@author Michael Wolf
+*@date 19.10.2026
+*@brief Streaming statistics per signal id: count, min, max, mean, standard deviation and rate, updated in O(1) per
+* sample with Welford's algorithm. Session-wide and per fixed time window. One writer, readers do not lock.
+*/
+
+#ifndef SIGNALSTATISTICS_H
+#define SIGNALSTATISTICS_H
+
+#include <memory>
+#include <atomic>
+#include <vector>
+#include <stdint.h>
+#include <stddef.h>
+
+class SignalStatistics {
+  public:
+    enum class SCOPE {SESSION, WINDOW}; // WINDOW: the last completed window
+
+    struct Summary {
+        uint64_t count = 0;
+        double min = 0.0;
+        double max = 0.0;
+        double mean = 0.0;
+        double stdDev = 0.0; // sample standard deviation
+        double rate = 0.0; // samples per second
+        double timeFirst = 0.0;
+        double timeLast = 0.0;
+    };
+
+    /**
+     * @param windowSeconds length of the fixed (tumbling) window.
+     */
+    explicit SignalStatistics(const double windowSeconds = 1.0);
+
+    SignalStatistics(const SignalStatistics&) = delete;
+    SignalStatistics& operator=(const SignalStatistics&) = delete;
+
+    /**
+     * @brief init creates the accumulators for the signal ids 0..signalCount-1. Not thread safe, for configuration only.
+     */
+    void init(const size_t signalCount);
+    size_t getSignalCount() const;
+    double getWindowSeconds() const;
+
+    /**
+     * @brief add is called by the single writer for every sample, O(1).
+     */
+    void add(const uint32_t signalId, const double time, const double value);
+
+    /**
+     * @brief advance is called by the single writer periodically, e.g. per frame. It completes the windows which ended
+     * before time, so the last window of a signal without new samples becomes empty and its rate drops to zero.
+     * @param changedSignalIds the signals whose last window changed are appended.
+     */
+    void advance(const double time, std::vector<uint32_t>& changedSignalIds);
+
+    /**
+     * @brief read copies the statistics of one signal, lock-free. The copy is repeated if the writer updated the signal meanwhile.
+     * @return false if the signal id is invalid or no consistent copy could be made.
+     */
+    bool read(const uint32_t signalId, const SCOPE scope, Summary& summary) const;
+
+  private:
+    struct Accumulator {
+        uint64_t count;
+        double mean;
+        double m2; // sum of the squared deviations from the mean
+        double min;
+        double max;
+        double timeFirst;
+        double timeLast;
+    };
+
+    struct Slot {
+        std::atomic<uint32_t> sequence; // odd while the writer updates the slot
+        Accumulator session;
+        Accumulator window; // window which is filled
+        Accumulator lastWindow; // last completed window
+        double windowStart;
+    };
+
+    void startWindow(Slot& slot, const double windowStart) const;
+    static void clear(Accumulator& accumulator);
+    static void addTo(Accumulator& accumulator, const double time, const double value);
+    Summary toSummary(const Accumulator& accumulator, const bool isWindow) const;
+
+    double windowSeconds;
+    size_t signalCount;
+    std::unique_ptr<Slot[]> slots;
+};
+
+#endif // SIGNALSTATISTICS_H
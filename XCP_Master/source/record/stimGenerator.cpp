@@ -0,0 +1,116 @@
+/**
+*@file stimGenerator.cpp
+*@author Michael Wolf
+*@date 19.10.2026
+*@brief Signal source for the stimulation (STIM) of a signal. Generates a waveform or replays a recorded signal.
+*/
+
+#include "stimGenerator.h"
+
+#include <cmath>
+#include <algorithm>
+
+StimGenerator::StimGenerator(const Waveform waveform, const double amplitude, const double offset, const double periodInS)
+    : waveform(waveform),
+      amplitude(amplitude),
+      offset(offset),
+      periodInS(periodInS) {
+
+}
+
+double StimGenerator::valueAt(const double timeInS) const {
+    static const double PI = 3.14159265358979323846;
+    double phase = 0.0;
+    if(periodInS > 0.0) {
+        phase = std::fmod(timeInS, periodInS) / periodInS;
+    }
+
+    switch (waveform) {
+    case Waveform::Constant:
+        return offset;
+    case Waveform::Sine:
+        return offset + amplitude * std::sin(2.0 * PI * phase);
+    case Waveform::Square:
+        return offset + ((phase < 0.5) ? amplitude : -amplitude);
+    case Waveform::Ramp:
+        return offset + amplitude * phase;
+    case Waveform::Replay: {
+        if(replaySamples.empty()) {
+            return offset;
+        }
+        double start = replaySamples.front().first;
+        double duration = replaySamples.back().first - start;
+        double replayTime = start;
+        if(duration > 0.0) {
+            replayTime += std::fmod(timeInS, duration);
+        }
+        auto it = std::upper_bound(replaySamples.begin(), replaySamples.end(), replayTime,
+        [](double time, const std::pair<double, double>& sample) {
+            return time < sample.first;
+        });
+        if(it != replaySamples.begin()) {
+            it--;
+        }
+        return it->second;
+    }
+    default:
+        return offset;
+    }
+}
+
+StimGenerator::Waveform StimGenerator::getWaveform() const {
+    return waveform;
+}
+
+void StimGenerator::setWaveform(const Waveform &value) {
+    waveform = value;
+}
+
+double StimGenerator::getAmplitude() const {
+    return amplitude;
+}
+
+void StimGenerator::setAmplitude(double value) {
+    amplitude = value;
+}
+
+double StimGenerator::getOffset() const {
+    return offset;
+}
+
+void StimGenerator::setOffset(double value) {
+    offset = value;
+}
+
+double StimGenerator::getPeriodInS() const {
+    return periodInS;
+}
+
+void StimGenerator::setPeriodInS(double value) {
+    periodInS = value;
+}
+
+void StimGenerator::setReplaySamples(const std::vector<std::pair<double, double>> &samples) {
+    replaySamples = samples;
+}
+
+const std::vector<std::pair<double, double>>& StimGenerator::getReplaySamples() const {
+    return replaySamples;
+}
+
+std::string StimGenerator::getWaveformString() const {
+    switch (waveform) {
+    case Waveform::Constant:
+        return "constant";
+    case Waveform::Sine:
+        return "sine";
+    case Waveform::Square:
+        return "square";
+    case Waveform::Ramp:
+        return "ramp";
+    case Waveform::Replay:
+        return "replay";
+    default:
+        return "";
+    }
+}
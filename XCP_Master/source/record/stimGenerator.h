@@ -0,0 +1,60 @@
+/**
+*@file stimGenerator.h
+*@author Michael Wolf
+*@date 19.10.2026
+*@brief Signal source for the stimulation (STIM) of a signal. Generates a waveform or replays a recorded signal.
+*/
+
+#ifndef STIMGENERATOR_H
+#define STIMGENERATOR_H
+
+#include <vector>
+#include <utility>
+#include <string>
+
+class StimGenerator {
+  public:
+    enum class Waveform {Constant, Sine, Square, Ramp, Replay};
+
+    StimGenerator(const Waveform waveform = Waveform::Constant,
+                  const double amplitude = 0.0,
+                  const double offset = 0.0,
+                  const double periodInS = 1.0);
+
+    /**
+     * @brief valueAt calculates the stimulus value.
+     * @param timeInS time since the start of the measurement.
+     * A replayed signal holds each sample until the next one and starts again at the beginning after its last sample.
+     */
+    double valueAt(const double timeInS) const;
+
+    Waveform getWaveform() const;
+    void setWaveform(const Waveform &value);
+
+    double getAmplitude() const;
+    void setAmplitude(double value);
+
+    double getOffset() const;
+    void setOffset(double value);
+
+    double getPeriodInS() const;
+    void setPeriodInS(double value);
+
+    /**
+     * @brief setReplaySamples sets the signal to replay.
+     * @param samples pairs of time (in s, ascending) and value, e.g. the column of a recorded measurement.
+     */
+    void setReplaySamples(const std::vector<std::pair<double, double>>& samples);
+    const std::vector<std::pair<double, double>>& getReplaySamples() const;
+
+    std::string getWaveformString() const;
+
+  private:
+    Waveform waveform;
+    double amplitude;
+    double offset;
+    double periodInS;
+    std::vector<std::pair<double, double>> replaySamples;
+};
+
+#endif // STIMGENERATOR_H
@@ -0,0 +1,119 @@
+/**
+*@file summaryPyramid.cpp
+*@author Michael Wolf
+*@date 19.10.2026
+*@brief Multi-resolution min/max summary of a sample column. Level 0 summarizes FANOUT samples per bucket, every further
+* level FANOUT buckets of the level below. The min/max of any sample range is read in O(FANOUT * LEVEL_COUNT), independent
+* of the length of the range. The buckets of samples which the column dropped are dropped as well.
+* The physical values are summarized, so the min and max stay correct for conversions which are not monotonic.
+*/
+
+#include "summaryPyramid.h"
+
+#include <algorithm>
+
+SummaryPyramid::SummaryPyramid()
+    : size(0) {
+
+    size_t span = FANOUT;
+    for(size_t level = 0; level < LEVEL_COUNT; level++) {
+        spans[level] = span;
+        firstBuckets[level] = 0;
+        span *= FANOUT;
+    }
+}
+
+void SummaryPyramid::clear() {
+    for(size_t level = 0; level < LEVEL_COUNT; level++) {
+        levels[level].clear();
+        firstBuckets[level] = 0;
+    }
+    size = 0;
+}
+
+void SummaryPyramid::setConversion(const ConversionFunction& conversion) {
+    this->conversion = conversion;
+    clear();
+}
+
+double SummaryPyramid::getValue(const SampleColumn& column, const size_t index) const {
+    return conversion.convert(column.getValueAsDouble(index));
+}
+
+/**
+ * Every sample updates the open bucket of each level, the buckets are appended when a sample starts a new one.
+ * If the column dropped samples which were never summarized, the pyramid restarts at the first sample in memory,
+ * the first bucket of a level is incomplete then and never used by getRange().
+ */
+void SummaryPyramid::update(const SampleColumn& column) {
+    size_t columnSize = column.getSize();
+    size_t firstIndex = column.getFirstIndex();
+    if(size < firstIndex) {
+        clear();
+        size = firstIndex;
+        for(size_t level = 0; level < LEVEL_COUNT; level++) {
+            firstBuckets[level] = size / spans[level];
+        }
+    }
+    for(; size < columnSize; size++) {
+        double value = getValue(column, size);
+        for(size_t level = 0; level < LEVEL_COUNT; level++) {
+            std::deque<Bucket>& buckets = levels[level];
+            if(size % spans[level] == 0 || buckets.empty()) {
+                Bucket bucket;
+                bucket.min = value;
+                bucket.max = value;
+                buckets.push_back(bucket);
+            } else {
+                Bucket& bucket = buckets.back();
+                bucket.min = std::min(bucket.min, value);
+                bucket.max = std::max(bucket.max, value);
+            }
+        }
+    }
+    for(size_t level = 0; level < LEVEL_COUNT; level++) {
+        while(!levels[level].empty() && (firstBuckets[level] + 1) * spans[level] <= firstIndex) {
+            levels[level].pop_front();
+            firstBuckets[level]++;
+        }
+    }
+}
+
+size_t SummaryPyramid::getSize() const {
+    return size;
+}
+
+/**
+ * From first on, the largest complete bucket which starts at the current index and ends in the range is taken.
+ * Samples which are not summarized yet and the unaligned ends of the range are read from the column.
+ */
+bool SummaryPyramid::getRange(const SampleColumn& column, const size_t first, const size_t last, double& min, double& max) const {
+    size_t end = std::min(last, column.getSize());
+    if(first >= end) {
+        return false;
+    }
+    min = getValue(column, first);
+    max = min;
+    size_t index = first;
+    while(index < end) {
+        size_t taken = 0;
+        for(size_t level = LEVEL_COUNT; level-- > 0;) {
+            size_t span = spans[level];
+            if(index % span == 0 && index + span <= end && index + span <= size && index / span >= firstBuckets[level]) {
+                const Bucket& bucket = levels[level][index / span - firstBuckets[level]];
+                min = std::min(min, bucket.min);
+                max = std::max(max, bucket.max);
+                taken = span;
+                break;
+            }
+        }
+        if(taken == 0) {
+            double value = getValue(column, index);
+            min = std::min(min, value);
+            max = std::max(max, value);
+            taken = 1;
+        }
+        index += taken;
+    }
+    return true;
+}
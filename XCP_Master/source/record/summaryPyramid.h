@@ -0,0 +1,70 @@
+/**
+*@file summaryPyramid.h
+*@author Michael Wolf
+*@date 19.10.2026
+*@brief Multi-resolution min/max summary of a sample column. Level 0 summarizes FANOUT samples per bucket, every further
+* level FANOUT buckets of the level below. The min/max of any sample range is read in O(FANOUT * LEVEL_COUNT), independent
+* of the length of the range. The buckets of samples which the column dropped are dropped as well.
+* The physical values are summarized, so the min and max stay correct for conversions which are not monotonic.
+*/
+
+#ifndef SUMMARYPYRAMID_H
+#define SUMMARYPYRAMID_H
+
+#include "sampleStore.h"
+#include "conversionFunction.h"
+
+#include <deque>
+#include <stdint.h>
+#include <stddef.h>
+
+class SummaryPyramid {
+  public:
+    static const size_t FANOUT = 16;
+    static const size_t LEVEL_COUNT = 6; // top level: 16^6 samples per bucket
+
+    SummaryPyramid();
+
+    void clear();
+
+    /**
+     * @brief setConversion from the raw to the physical values, the identity by default. Clears the pyramid.
+     */
+    void setConversion(const ConversionFunction& conversion);
+
+    /**
+     * @return physical value of a sample of the column.
+     */
+    double getValue(const SampleColumn& column, const size_t index) const;
+
+    /**
+     * @brief update summarizes the samples appended to the column since the last update and drops the buckets of
+     * the samples the column dropped. The column must only grow, clear() the pyramid if the column is replaced.
+     */
+    void update(const SampleColumn& column);
+
+    /**
+     * @return number of samples summarized.
+     */
+    size_t getSize() const;
+
+    /**
+     * @brief getRange min and max of the physical values of the samples [first, last) of the column.
+     * @return false if the range is empty.
+     */
+    bool getRange(const SampleColumn& column, const size_t first, const size_t last, double& min, double& max) const;
+
+  private:
+    struct Bucket {
+        double min;
+        double max;
+    };
+
+    ConversionFunction conversion;
+    std::deque<Bucket> levels[LEVEL_COUNT];
+    size_t firstBuckets[LEVEL_COUNT]; // index of the first bucket in memory
+    size_t spans[LEVEL_COUNT]; // samples per bucket
+    size_t size;
+};
+
+#endif // SUMMARYPYRAMID_H
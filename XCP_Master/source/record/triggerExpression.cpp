@@ -0,0 +1,403 @@
+/**
+*@file triggerExpression.cpp
+*@author Michael Wolf
+*@date 19.10.2026
+*@brief Condition on the live values of the recorded signals, e.g. "speed > 120 && gear == 3" or "temp > temp.upperLimit".
+* The expression is compiled once into a postfix program which is evaluated for every sample without allocation.
+*/
+
+#include "triggerExpression.h"
+
+#include <cctype>
+#include <cmath>
+#include <cstdlib>
+#include <cstring>
+#include <algorithm>
+
+namespace {
+const char* const OPERATORS[] = {"||", "&&", "<=", ">=", "==", "!=", "<", ">", "!", "+", "-", "*", "/"};
+const std::string LOWER_LIMIT_SUFFIX = ".lowerLimit";
+const std::string UPPER_LIMIT_SUFFIX = ".upperLimit";
+const size_t MAX_STACK_DEPTH = 64;
+
+bool isNameChar(const char c) {
+    return std::isalnum((unsigned char) c) || c == '_' || c == '.' || c == '[' || c == ']';
+}
+
+bool hasSuffix(const std::string& str, const std::string& suffix) {
+    return str.size() > suffix.size() && str.compare(str.size() - suffix.size(), suffix.size(), suffix) == 0;
+}
+}
+
+TriggerExpression::TriggerExpression()
+    : maxStackDepth(0),
+      signalTable(nullptr),
+      tokenIndex(0),
+      stackDepth(0) {
+
+}
+
+bool TriggerExpression::compile(const std::string& text, const std::vector<RecordSignal>& signalTable) {
+    this->text = text;
+    this->signalTable = &signalTable;
+    error.clear();
+    program.clear();
+    signalIds.clear();
+    maxStackDepth = 0;
+    stackDepth = 0;
+    tokenIndex = 0;
+
+    bool isCompiled = tokenize(text) && parseOr();
+    if(isCompiled && tokens[tokenIndex].type != TOKEN::END) {
+        isCompiled = fail("unexpected '" + tokens[tokenIndex].text + "'");
+    }
+    tokens.clear();
+    this->signalTable = nullptr;
+    if(!isCompiled) {
+        program.clear();
+        signalIds.clear();
+        return false;
+    }
+    std::sort(signalIds.begin(), signalIds.end());
+    signalIds.erase(std::unique(signalIds.begin(), signalIds.end()), signalIds.end());
+    return true;
+}
+
+/**
+ * Stack machine, the stack depth is checked at compile time. Booleans are 1.0 and 0.0, comparisons with NaN are false.
+ */
+bool TriggerExpression::evaluate(const std::vector<double>& values) const {
+    if(program.empty()) {
+        return false;
+    }
+    double stack[MAX_STACK_DEPTH];
+    size_t top = 0;
+    for(const auto& instruction : program) {
+        switch (instruction.op) {
+        case OP::CONSTANT:
+            stack[top++] = instruction.constant;
+            continue;
+        case OP::SIGNAL:
+            stack[top++] = instruction.signalId < values.size() ? values[instruction.signalId] : NAN;
+            continue;
+        case OP::NEG:
+            stack[top - 1] = -stack[top - 1];
+            continue;
+        case OP::NOT:
+            stack[top - 1] = (stack[top - 1] != 0.0 && !std::isnan(stack[top - 1])) ? 0.0 : 1.0;
+            continue;
+        default:
+            break;
+        }
+        double right = stack[--top];
+        double& left = stack[top - 1];
+        switch (instruction.op) {
+        case OP::ADD:
+            left = left + right;
+            break;
+        case OP::SUB:
+            left = left - right;
+            break;
+        case OP::MUL:
+            left = left * right;
+            break;
+        case OP::DIV:
+            left = left / right;
+            break;
+        case OP::LESS:
+            left = (left < right) ? 1.0 : 0.0;
+            break;
+        case OP::LESS_EQUAL:
+            left = (left <= right) ? 1.0 : 0.0;
+            break;
+        case OP::GREATER:
+            left = (left > right) ? 1.0 : 0.0;
+            break;
+        case OP::GREATER_EQUAL:
+            left = (left >= right) ? 1.0 : 0.0;
+            break;
+        case OP::EQUAL:
+            left = (left == right) ? 1.0 : 0.0;
+            break;
+        case OP::NOT_EQUAL:
+            left = (left != right && !std::isnan(left) && !std::isnan(right)) ? 1.0 : 0.0;
+            break;
+        case OP::AND:
+            left = (left != 0.0 && right != 0.0 && !std::isnan(left) && !std::isnan(right)) ? 1.0 : 0.0;
+            break;
+        case OP::OR:
+            left = ((left != 0.0 && !std::isnan(left)) || (right != 0.0 && !std::isnan(right))) ? 1.0 : 0.0;
+            break;
+        default:
+            break;
+        }
+    }
+    return stack[0] != 0.0 && !std::isnan(stack[0]);
+}
+
+bool TriggerExpression::getIsEmpty() const {
+    return program.empty();
+}
+
+std::string TriggerExpression::getText() const {
+    return text;
+}
+
+std::string TriggerExpression::getError() const {
+    return error;
+}
+
+const std::vector<uint32_t>& TriggerExpression::getSignalIds() const {
+    return signalIds;
+}
+
+/***************************************************************
+*  Compiler
+****************************************************************/
+bool TriggerExpression::tokenize(const std::string& text) {
+    tokens.clear();
+    size_t i = 0;
+    while(i < text.size()) {
+        char c = text[i];
+        if(std::isspace((unsigned char) c)) {
+            i++;
+            continue;
+        }
+        Token token;
+        token.number = 0.0;
+        if(std::isdigit((unsigned char) c) || (c == '.' && i + 1 < text.size() && std::isdigit((unsigned char) text[i + 1]))) {
+            char* end;
+            token.type = TOKEN::NUMBER;
+            token.number = std::strtod(text.c_str() + i, &end);
+            size_t length = end - (text.c_str() + i);
+            token.text = text.substr(i, length);
+            i += length;
+        } else if(std::isalpha((unsigned char) c) || c == '_') {
+            size_t start = i;
+            while(i < text.size() && isNameChar(text[i])) {
+                i++;
+            }
+            token.type = TOKEN::NAME;
+            token.text = text.substr(start, i - start);
+        } else if(c == '"') {
+            size_t end = text.find('"', i + 1);
+            if(end == std::string::npos) {
+                return fail("missing closing '\"'");
+            }
+            token.type = TOKEN::NAME;
+            token.text = text.substr(i + 1, end - i - 1);
+            i = end + 1;
+        } else if(c == '(' || c == ')') {
+            token.type = (c == '(') ? TOKEN::OPEN : TOKEN::CLOSE;
+            token.text = std::string(1, c);
+            i++;
+        } else {
+            const char* op = nullptr;
+            for(const char* candidate : OPERATORS) {
+                if(text.compare(i, std::strlen(candidate), candidate) == 0) {
+                    op = candidate;
+                    break;
+                }
+            }
+            if(op == nullptr) {
+                return fail("unexpected character '" + std::string(1, c) + "'");
+            }
+            token.type = TOKEN::OPERATOR;
+            token.text = op;
+            i += token.text.size();
+        }
+        tokens.push_back(token);
+    }
+    Token end;
+    end.type = TOKEN::END;
+    end.text = "end of expression";
+    end.number = 0.0;
+    tokens.push_back(end);
+    return true;
+}
+
+bool TriggerExpression::parseOr() {
+    if(!parseAnd()) {
+        return false;
+    }
+    while(isOperator("||")) {
+        tokenIndex++;
+        if(!parseAnd()) {
+            return false;
+        }
+        emitOp(OP::OR);
+    }
+    return true;
+}
+
+bool TriggerExpression::parseAnd() {
+    if(!parseComparison()) {
+        return false;
+    }
+    while(isOperator("&&")) {
+        tokenIndex++;
+        if(!parseComparison()) {
+            return false;
+        }
+        emitOp(OP::AND);
+    }
+    return true;
+}
+
+bool TriggerExpression::parseComparison() {
+    if(!parseSum()) {
+        return false;
+    }
+    static const struct {
+        const char* text;
+        OP op;
+    } comparisons[] = {{"<", OP::LESS}, {"<=", OP::LESS_EQUAL}, {">", OP::GREATER}, {">=", OP::GREATER_EQUAL},
+        {"==", OP::EQUAL}, {"!=", OP::NOT_EQUAL}
+    };
+    for(const auto& comparison : comparisons) {
+        if(isOperator(comparison.text)) {
+            tokenIndex++;
+            if(!parseSum()) {
+                return false;
+            }
+            emitOp(comparison.op);
+            return true;
+        }
+    }
+    return true;
+}
+
+bool TriggerExpression::parseSum() {
+    if(!parseProduct()) {
+        return false;
+    }
+    while(isOperator("+") || isOperator("-")) {
+        OP op = isOperator("+") ? OP::ADD : OP::SUB;
+        tokenIndex++;
+        if(!parseProduct()) {
+            return false;
+        }
+        emitOp(op);
+    }
+    return true;
+}
+
+bool TriggerExpression::parseProduct() {
+    if(!parseUnary()) {
+        return false;
+    }
+    while(isOperator("*") || isOperator("/")) {
+        OP op = isOperator("*") ? OP::MUL : OP::DIV;
+        tokenIndex++;
+        if(!parseUnary()) {
+            return false;
+        }
+        emitOp(op);
+    }
+    return true;
+}
+
+bool TriggerExpression::parseUnary() {
+    if(isOperator("-") || isOperator("!")) {
+        OP op = isOperator("-") ? OP::NEG : OP::NOT;
+        tokenIndex++;
+        if(!parseUnary()) {
+            return false;
+        }
+        emitOp(op);
+        return true;
+    }
+    return parsePrimary();
+}
+
+bool TriggerExpression::parsePrimary() {
+    const Token& token = tokens[tokenIndex];
+    switch (token.type) {
+    case TOKEN::NUMBER: {
+        tokenIndex++;
+        Instruction instruction = {OP::CONSTANT, 0, token.number};
+        program.push_back(instruction);
+        stackDepth++;
+        break;
+    }
+    case TOKEN::NAME:
+        tokenIndex++;
+        if(!resolveName(token.text)) {
+            return false;
+        }
+        break;
+    case TOKEN::OPEN:
+        tokenIndex++;
+        if(!parseOr()) {
+            return false;
+        }
+        if(tokens[tokenIndex].type != TOKEN::CLOSE) {
+            return fail("missing ')'");
+        }
+        tokenIndex++;
+        return true;
+    default:
+        return fail("unexpected '" + token.text + "'");
+    }
+    maxStackDepth = std::max(maxStackDepth, stackDepth);
+    if(maxStackDepth > MAX_STACK_DEPTH) {
+        return fail("expression too complex");
+    }
+    return true;
+}
+
+/**
+ * A name is a signal of the recording or the limit of a signal, the limit is a constant of the program.
+ */
+bool TriggerExpression::resolveName(const std::string& name) {
+    auto findSignal = [this](const std::string& signalName) -> uint32_t {
+        for(uint32_t signalId = 0; signalId < signalTable->size(); signalId++) {
+            if((*signalTable)[signalId].name == signalName) {
+                return signalId;
+            }
+        }
+        return (uint32_t) signalTable->size();
+    };
+
+    Instruction instruction = {OP::SIGNAL, 0, 0.0};
+    uint32_t signalId = findSignal(name);
+    if(signalId < signalTable->size()) {
+        instruction.signalId = signalId;
+        signalIds.push_back(signalId);
+    } else if(hasSuffix(name, LOWER_LIMIT_SUFFIX) || hasSuffix(name, UPPER_LIMIT_SUFFIX)) {
+        bool isLower = hasSuffix(name, LOWER_LIMIT_SUFFIX);
+        std::string signalName = name.substr(0, name.size() - (isLower ? LOWER_LIMIT_SUFFIX : UPPER_LIMIT_SUFFIX).size());
+        signalId = findSignal(signalName);
+        if(signalId >= signalTable->size()) {
+            return fail("unknown signal '" + signalName + "'");
+        }
+        const RecordSignal& signal = (*signalTable)[signalId];
+        instruction.op = OP::CONSTANT;
+        instruction.constant = isLower ? signal.lowerLimit : signal.upperLimit;
+    } else {
+        return fail("unknown signal '" + name + "'");
+    }
+    program.push_back(instruction);
+    stackDepth++;
+    return true;
+}
+
+bool TriggerExpression::isOperator(const char* op) const {
+    const Token& token = tokens[tokenIndex];
+    return token.type == TOKEN::OPERATOR && token.text == op;
+}
+
+void TriggerExpression::emitOp(const OP op) {
+    Instruction instruction = {op, 0, 0.0};
+    program.push_back(instruction);
+    if(op != OP::NEG && op != OP::NOT) {
+        stackDepth--; // binary operators replace two values by one
+    }
+}
+
+bool TriggerExpression::fail(const std::string& error) {
+    if(this->error.empty()) {
+        this->error = error;
+    }
+    return false;
+}
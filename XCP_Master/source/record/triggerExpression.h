@@ -0,0 +1,89 @@
+/**
+*@file triggerExpression.h
+*@author Michael Wolf
+*@date 19.10.2026
+*@brief Condition on the live values of the recorded signals, e.g. "speed > 120 && gear == 3" or "temp > temp.upperLimit".
+* The expression is compiled once into a postfix program which is evaluated for every sample without allocation.
+*/
+
+#ifndef TRIGGEREXPRESSION_H
+#define TRIGGEREXPRESSION_H
+
+#include "recordFileFormat.h"
+
+#include <vector>
+#include <string>
+#include <stdint.h>
+
+/**
+ * Grammar, precedence from low to high:
+ *   ||, &&, comparison (< <= > >= == !=), + -, * /, unary - and ! (not)
+ * As in C, "!a > b" is "(!a) > b", the negation of a comparison needs parentheses: "!(a > b)".
+ * Operands are numbers, signal names and the limits from the source comments: <name>.lowerLimit, <name>.upperLimit.
+ * Names with other characters than letters, digits, '_', '.', '[' and ']' are written in double quotes.
+ * Comparisons with a signal which has no value yet are false.
+ */
+class TriggerExpression {
+  public:
+    TriggerExpression();
+
+    /**
+     * @brief compile parses the expression, the signal names are resolved in the signal table of the recording.
+     * @return false on a syntax error or an unknown signal, see getError().
+     */
+    bool compile(const std::string& text, const std::vector<RecordSignal>& signalTable);
+
+    /**
+     * @param values latest value per signal id, NaN if the signal has no value yet.
+     */
+    bool evaluate(const std::vector<double>& values) const;
+
+    bool getIsEmpty() const;
+    std::string getText() const;
+    std::string getError() const;
+    const std::vector<uint32_t>& getSignalIds() const; // signals used by the expression
+
+  private:
+    enum class OP : uint8_t {CONSTANT, SIGNAL, ADD, SUB, MUL, DIV, NEG, LESS, LESS_EQUAL, GREATER, GREATER_EQUAL, EQUAL, NOT_EQUAL, AND, OR, NOT};
+
+    struct Instruction {
+        OP op;
+        uint32_t signalId;
+        double constant;
+    };
+
+    enum class TOKEN {NUMBER, NAME, OPERATOR, OPEN, CLOSE, END};
+
+    struct Token {
+        TOKEN type;
+        std::string text;
+        double number;
+    };
+
+    bool tokenize(const std::string& text);
+    bool parseOr();
+    bool parseAnd();
+    bool parseComparison();
+    bool parseSum();
+    bool parseProduct();
+    bool parseUnary();
+    bool parsePrimary();
+    bool resolveName(const std::string& name);
+    bool isOperator(const char* op) const;
+    void emitOp(const OP op);
+    bool fail(const std::string& error);
+
+    std::string text;
+    std::string error;
+    std::vector<Instruction> program;
+    std::vector<uint32_t> signalIds;
+    size_t maxStackDepth;
+
+    // compiler state
+    const std::vector<RecordSignal>* signalTable;
+    std::vector<Token> tokens;
+    size_t tokenIndex;
+    size_t stackDepth;
+};
+
+#endif // TRIGGEREXPRESSION_H
@@ -0,0 +1,160 @@
+/**
+*@file triggerRecorder.cpp
+*@author Michael Wolf
+*@date 19.10.2026
+*@brief Condition triggered recording. All samples are kept in a ring buffer, when the start condition becomes true the
+* pre-trigger window is flushed and the samples are recorded until the stop condition plus the post-trigger window.
+* Then the recorder waits for the next trigger, so an endurance run stores only the interesting seconds.
+*/
+
+#include "triggerRecorder.h"
+
+#include <cmath>
+#include <algorithm>
+
+TriggerRecorder::TriggerRecorder()
+    : preTriggerRing(1),
+      state(State::Armed),
+      stopTime(0.0),
+      triggerCount(0) {
+
+}
+
+bool TriggerRecorder::start(const Settings& settings, const std::vector<RecordSignal>& signalTable, const std::vector<double>& sampleRates, const Sink& sink) {
+    this->settings = settings;
+    this->signalTable = signalTable;
+    this->sink = sink;
+    error.clear();
+    if(!startCondition.compile(settings.startExpression, signalTable)) {
+        error = "start condition: " + startCondition.getError();
+        return false;
+    }
+    if(!settings.stopExpression.empty() && !stopCondition.compile(settings.stopExpression, signalTable)) {
+        error = "stop condition: " + stopCondition.getError();
+        return false;
+    }
+    if(settings.stopExpression.empty()) {
+        stopCondition = TriggerExpression();
+    }
+
+    conversions.assign(signalTable.size(), ConversionFunction());
+    for(size_t signalId = 0; signalId < signalTable.size(); signalId++) {
+        conversions[signalId].compile(signalTable[signalId].conversion);
+    }
+    isConditionSignal.assign(signalTable.size(), false);
+    for(uint32_t signalId : startCondition.getSignalIds()) {
+        isConditionSignal[signalId] = true;
+    }
+    for(uint32_t signalId : stopCondition.getSignalIds()) {
+        isConditionSignal[signalId] = true;
+    }
+    latestValues.assign(signalTable.size(), NAN);
+    size_t ringDepth = calculateRingDepth(sampleRates);
+    preTriggerRing.setDepth(ringDepth);
+    flushBuffer.clear();
+    flushBuffer.shrink_to_fit();
+    flushBuffer.reserve(ringDepth);
+    state = State::Armed;
+    stopTime = 0.0;
+    triggerCount = 0;
+    return true;
+}
+
+/**
+ * Armed: the sample goes to the ring buffer. Triggered and PostTrigger: the sample is persisted.
+ * The conditions are only evaluated if the sample changed one of their signals.
+ */
+void TriggerRecorder::append(const double time, const uint32_t signalId, const int64_t value) {
+    if(signalId >= signalTable.size()) {
+        return;
+    }
+    RecordSample sample = {time, signalId, value};
+    bool isConditionChanged = isConditionSignal[signalId];
+    if(isConditionChanged) {
+        latestValues[signalId] = conversions[signalId].convert(rawToDouble(signalTable[signalId], value));
+    }
+
+    switch (state) {
+    case State::Armed:
+        preTriggerRing.push(sample);
+        if(isConditionChanged && startCondition.evaluate(latestValues)) {
+            state = State::Triggered;
+            triggerCount++;
+            flushPreTrigger(time); // contains this sample
+        }
+        return;
+    case State::Triggered:
+        sink.append(sample);
+        if(isConditionChanged) {
+            bool isStop = stopCondition.getIsEmpty() ? !startCondition.evaluate(latestValues) : stopCondition.evaluate(latestValues);
+            if(isStop) {
+                state = State::PostTrigger;
+                stopTime = time;
+            }
+        }
+        return;
+    case State::PostTrigger:
+        if(time - stopTime > settings.postTriggerSeconds) {
+            state = State::Armed;
+            preTriggerRing.clear();
+            append(time, signalId, value); // may trigger again
+            return;
+        }
+        sink.append(sample);
+        if(isConditionChanged && stopCondition.getIsEmpty() && startCondition.evaluate(latestValues)) {
+            state = State::Triggered; // condition true again within the post-trigger window, one continuous capture
+        }
+        return;
+    }
+}
+
+TriggerRecorder::State TriggerRecorder::getState() const {
+    return state;
+}
+
+uint32_t TriggerRecorder::getTriggerCount() const {
+    return triggerCount;
+}
+
+std::string TriggerRecorder::getError() const {
+    return error;
+}
+
+size_t TriggerRecorder::getRingDepth() const {
+    return preTriggerRing.getDepth();
+}
+
+/**
+ * The ring holds the pre-trigger seconds at the sum of the signal rates, with a margin for the jitter of the rates and one
+ * sample per signal at the window boundary. A signal without a known rate could fill the ring alone, then the maximum is used.
+ */
+size_t TriggerRecorder::calculateRingDepth(const std::vector<double>& sampleRates) const {
+    static const double RATE_MARGIN = 1.25;
+    if(sampleRates.size() != signalTable.size()) {
+        return settings.maxRingDepth;
+    }
+    double samplesPerSecond = 0.0;
+    for(double rate : sampleRates) {
+        if(!(rate > 0.0)) {
+            return settings.maxRingDepth;
+        }
+        samplesPerSecond += rate;
+    }
+    double depth = std::ceil(std::max(settings.preTriggerSeconds, 0.0) * samplesPerSecond * RATE_MARGIN) + sampleRates.size();
+    return (size_t) std::max(1.0, std::min(depth, (double) settings.maxRingDepth));
+}
+
+/**
+ * The ring buffer holds the samples in arrival order, only the samples within the pre-trigger window are persisted.
+ */
+void TriggerRecorder::flushPreTrigger(const double triggerTime) {
+    flushBuffer.resize(preTriggerRing.getSize());
+    flushBuffer.resize(preTriggerRing.snapshot(flushBuffer.data(), flushBuffer.size()));
+    auto first = flushBuffer.begin();
+    while(first != flushBuffer.end() && first->time < triggerTime - settings.preTriggerSeconds) {
+        first++;
+    }
+    flushBuffer.erase(flushBuffer.begin(), first);
+    sink.flush(flushBuffer);
+    preTriggerRing.clear();
+}
@@ -0,0 +1,85 @@
+/**
+*@file triggerRecorder.h
+*@author Michael Wolf
+*@date 19.10.2026
+*@brief Condition triggered recording. All samples are kept in a ring buffer, when the start condition becomes true the
+* pre-trigger window is flushed and the samples are recorded until the stop condition plus the post-trigger window.
+* Then the recorder waits for the next trigger, so an endurance run stores only the interesting seconds.
+*/
+
+#ifndef TRIGGERRECORDER_H
+#define TRIGGERRECORDER_H
+
+#include "recordFileFormat.h"
+#include "ringBuffer.h"
+#include "triggerExpression.h"
+#include "conversionFunction.h"
+
+#include <vector>
+#include <string>
+#include <functional>
+
+class TriggerRecorder {
+  public:
+    enum class State {Armed, Triggered, PostTrigger};
+
+    struct Settings {
+        std::string startExpression;
+        std::string stopExpression; // empty: stop when the start condition is false
+        double preTriggerSeconds = 5.0;
+        double postTriggerSeconds = 5.0;
+        size_t maxRingDepth = (1 << 20) - 1; // samples, bounds the memory of the pre-trigger window
+    };
+
+    /**
+     * @brief The Sink struct receives the samples to persist. append() is called for the live samples, flush() with the
+     * pre-trigger window (may block until the writer has room).
+     */
+    struct Sink {
+        std::function<void(const RecordSample& sample)> append;
+        std::function<void(const std::vector<RecordSample>& samples)> flush;
+    };
+
+    TriggerRecorder();
+
+    /**
+     * @brief start compiles the conditions and arms the trigger. The ring buffer holds the pre-trigger window of all signals.
+     * @param sampleRates samples per second, index: signal id. 0: unknown (non cyclic event), then the ring gets the maximum depth.
+     * @return false if a condition is invalid, see getError().
+     */
+    bool start(const Settings& settings, const std::vector<RecordSignal>& signalTable, const std::vector<double>& sampleRates, const Sink& sink);
+
+    /**
+     * @brief append processes one sample of the acquisition: updates the live value, evaluates the conditions and
+     * buffers or persists the sample. O(1) except at the trigger.
+     * @param signalId id in the signal table of start().
+     */
+    void append(const double time, const uint32_t signalId, const int64_t value);
+
+    State getState() const;
+    uint32_t getTriggerCount() const;
+    size_t getRingDepth() const; // samples
+    std::string getError() const;
+
+  private:
+    size_t calculateRingDepth(const std::vector<double>& sampleRates) const;
+    void flushPreTrigger(const double triggerTime);
+
+    Settings settings;
+    std::vector<RecordSignal> signalTable;
+    std::vector<ConversionFunction> conversions; // index: signal id
+    Sink sink;
+    TriggerExpression startCondition;
+    TriggerExpression stopCondition;
+    std::vector<bool> isConditionSignal; // index: signal id, the conditions are evaluated only for their signals
+    std::vector<double> latestValues; // index: signal id, physical value
+
+    RingBuffer<RecordSample> preTriggerRing;
+    std::vector<RecordSample> flushBuffer;
+    State state;
+    double stopTime;
+    uint32_t triggerCount;
+    std::string error;
+};
+
+#endif // TRIGGERRECORDER_H
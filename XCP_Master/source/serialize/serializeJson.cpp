@@ -9,6 +9,7 @@
 
 #include <memory>
 #include <iostream>
+#include <cmath>
 
 #include <QJsonArray>
 #include <QJsonDocument>
@@ -61,6 +62,32 @@ void SerializeJson::readFileSettings() {
     model->setFilesA2lFile(jsonObj["A2L file"].toString());
     model->setHashElfFile(jsonObj["ELF file hash"].toString().toUtf8());
     model->setFilesRecordPath(jsonObj["Record path"].toString());
+    try {
+        model->setRecordFormatSelected(Model::getRecordFormatsValueKey().at(jsonObj["Record format"].toString()));
+    } catch (const std::out_of_range& oor) {
+        std::cerr << "Out of Range error in readFileSettings(): " << oor.what() << std::endl;
+    }
+    Resampler::Settings resampleSettings;
+    try {
+        resampleSettings.timeBase = Model::getCsvTimeBasesValueKey().at(jsonObj["CSV time base"].toString());
+        resampleSettings.interpolation = Model::getCsvInterpolationsValueKey().at(jsonObj["CSV interpolation"].toString());
+    } catch (const std::out_of_range& oor) {
+        std::cerr << "Out of Range error in readFileSettings(): " << oor.what() << std::endl;
+    }
+    static const double MS_PER_SECOND = 1000.0;
+    resampleSettings.rasterInterval = jsonObj["CSV raster [ms]"].toInt(10) / MS_PER_SECOND;
+    model->setCsvResampleSettings(resampleSettings);
+
+    TriggerRecorder::Settings triggerSettings;
+    model->setIsRecordTriggerEnabled(jsonObj["Trigger enabled"].toBool(false));
+    triggerSettings.startExpression = jsonObj["Trigger start"].toString().toStdString();
+    triggerSettings.stopExpression = jsonObj["Trigger stop"].toString().toStdString();
+    triggerSettings.preTriggerSeconds = jsonObj["Trigger pre [s]"].toDouble(triggerSettings.preTriggerSeconds);
+    triggerSettings.postTriggerSeconds = jsonObj["Trigger post [s]"].toDouble(triggerSettings.postTriggerSeconds);
+    model->setRecordTriggerSettings(triggerSettings);
+    model->setIsLiveBusEnabled(jsonObj["Live bus enabled"].toBool(false));
+    model->setLiveBusName(jsonObj["Live bus name"].toString(LIVE_BUS::DEFAULT_NAME));
+    model->setGuiRefreshRate(jsonObj["GUI refresh rate [Hz]"].toInt(Model::DEFAULT_GUI_REFRESH_RATE));
 }
 
 void SerializeJson::readTransportProtocolConfig(Model::TRANSPORT_PROTOCOL transportProtocol) {
@@ -99,6 +126,7 @@ void SerializeJson::readXcpConfig() {
     xcpConfig->setMaxCto(jsonObj["max CTO"].toInt());
     xcpConfig->setMaxDto(jsonObj["max DTO"].toInt());
     xcpConfig->setTimeout(jsonObj["timeout"].toInt());
+    xcpConfig->setIsOverloadControlEnabled(jsonObj["overload control"].toBool());
 
     readXcpConfigEvents(jsonObj["events"].toArray());
 }
@@ -211,6 +239,21 @@ void SerializeJson::writeFileSettings() {
     jsonObj["A2L file"] = model->getFilesA2lFile();
     jsonObj["ELF file hash"] = QString::fromUtf8(model->getHashElfFile());
     jsonObj["Record path"] = model->getFilesRecordPath();
+    jsonObj["Record format"] = Model::getRecordFormatsKeyValue().at(model->getRecordFormatSelected());
+    Resampler::Settings resampleSettings = model->getCsvResampleSettings();
+    static const double MS_PER_SECOND = 1000.0;
+    jsonObj["CSV time base"] = Model::getCsvTimeBasesKeyValue().at(resampleSettings.timeBase);
+    jsonObj["CSV interpolation"] = Model::getCsvInterpolationsKeyValue().at(resampleSettings.interpolation);
+    jsonObj["CSV raster [ms]"] = (int) std::lround(resampleSettings.rasterInterval * MS_PER_SECOND);
+    TriggerRecorder::Settings triggerSettings = model->getRecordTriggerSettings();
+    jsonObj["Trigger enabled"] = model->getIsRecordTriggerEnabled();
+    jsonObj["Trigger start"] = QString::fromStdString(triggerSettings.startExpression);
+    jsonObj["Trigger stop"] = QString::fromStdString(triggerSettings.stopExpression);
+    jsonObj["Trigger pre [s]"] = triggerSettings.preTriggerSeconds;
+    jsonObj["Trigger post [s]"] = triggerSettings.postTriggerSeconds;
+    jsonObj["Live bus enabled"] = model->getIsLiveBusEnabled();
+    jsonObj["Live bus name"] = model->getLiveBusName();
+    jsonObj["GUI refresh rate [Hz]"] = model->getGuiRefreshRate();
     writeJson["files"] = jsonObj;
 }
 
@@ -260,6 +303,7 @@ void SerializeJson::writeXcpConfig() {
     jsonObj["timeout"] = xcpConfig->getTimeout();
     jsonObj["max CTO"] = xcpConfig->getMaxCto();
     jsonObj["max DTO"] = xcpConfig->getMaxDto();
+    jsonObj["overload control"] = xcpConfig->getIsOverloadControlEnabled();
 
     writeXcpConfigEvents(jsonObj);
 
@@ -59,6 +59,9 @@ void DialogRecordConfiguration::updateTableView() {
                 case RecordElement::TriggerMode::Event:
                     triggerName = recordElement->getEvent().getName();
                     break;
+                case RecordElement::TriggerMode::Stimulation:
+                    triggerName = "stim: " + recordElement->getEvent().getName() + " (" + QString::fromStdString(recordElement->getStimGenerator()->getWaveformString()) + ")";
+                    break;
                 default:
                     break;
                 }
@@ -110,7 +113,8 @@ void DialogRecordConfiguration::setEditorTableItemSelected(int rowIndex) {
 }
 
 void DialogRecordConfiguration::openInputDialogTrigger(std::shared_ptr<RecordElement> recordElement) {
-    DialogRecordConfigurationHelper dialog(events, recordElement->getPollingRateInMs());
+    QString signalName = QString::fromStdString(recordElement->getParseResult()->getName());
+    DialogRecordConfigurationHelper dialog(events, recordElement->getPollingRateInMs(), signalName);
     int dialogCode = dialog.exec();
     if(dialogCode == QDialog::Accepted) {
         QString triggerName = dialog.getTrigger();
@@ -118,7 +122,12 @@ void DialogRecordConfiguration::openInputDialogTrigger(std::shared_ptr<RecordEle
             recordElement->setTriggerMode(RecordElement::TriggerMode::Polling);
             recordElement->setPollingRateInMs(dialog.getRate());
         } else {
-            recordElement->setTriggerMode(RecordElement::TriggerMode::Event);
+            if(dialog.getIsStimulation()) {
+                recordElement->setTriggerMode(RecordElement::TriggerMode::Stimulation);
+                recordElement->setStimGenerator(dialog.getStimGenerator());
+            } else {
+                recordElement->setTriggerMode(RecordElement::TriggerMode::Event);
+            }
             for(const auto& event : events) {
                 if(triggerName.compare(event.getName()) == 0) {
                     recordElement->setEvent(event);
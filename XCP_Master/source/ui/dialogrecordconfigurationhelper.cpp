@@ -7,12 +7,20 @@
 
 #include "dialogrecordconfigurationhelper.h"
 #include "ui_dialogrecordconfigurationhelper.h"
+#include "libs/qtcsv/include/qtcsv/reader.h"
 
-DialogRecordConfigurationHelper::DialogRecordConfigurationHelper(const QVector<XcpEvent>& events, int ratePreset, QWidget *parent) :
+#include <QFileDialog>
+#include <QMessageBox>
+
+const QString DialogRecordConfigurationHelper::STIM_PREFIX = "stim: ";
+
+DialogRecordConfigurationHelper::DialogRecordConfigurationHelper(const QVector<XcpEvent>& events, int ratePreset, const QString& signalName, QWidget *parent) :
     QDialog(parent),
     ui(new Ui::dialogRecordConfigurationHelper),
     ratePreset(ratePreset),
-    rateUser(0) {
+    rateUser(0),
+    signalName(signalName),
+    isStimulation(false) {
     ui->setupUi(this);
     addEventsToComboBox(events);
     ui->rateTextEdit->setText(QString::number(ratePreset));
@@ -32,6 +40,10 @@ void DialogRecordConfigurationHelper::on_buttonBox_accepted() {
         } else {
             rateUser = rateTmp;
         }
+    } else if(isStimMode(trigger)) {
+        isStimulation = true;
+        trigger = trigger.mid(STIM_PREFIX.size()); // event name
+        createStimGenerator();
     }
 }
 
@@ -43,8 +55,21 @@ QString DialogRecordConfigurationHelper::getTrigger() const {
     return trigger;
 }
 
+bool DialogRecordConfigurationHelper::getIsStimulation() const {
+    return isStimulation;
+}
+
+std::shared_ptr<StimGenerator> DialogRecordConfigurationHelper::getStimGenerator() const {
+    return stimGenerator;
+}
+
 void DialogRecordConfigurationHelper::on_triggerComboBox_currentTextChanged(const QString &comboText) {
     ui->rateTextEdit->setEnabled(isPollingMode(comboText));
+    bool isStim = isStimMode(comboText);
+    ui->stimComboBox->setEnabled(isStim);
+    ui->offsetTextEdit->setEnabled(isStim);
+    ui->amplitudeTextEdit->setEnabled(isStim);
+    ui->periodTextEdit->setEnabled(isStim);
 }
 
 void DialogRecordConfigurationHelper::addEventsToComboBox(const QVector<XcpEvent>& events) {
@@ -52,8 +77,72 @@ void DialogRecordConfigurationHelper::addEventsToComboBox(const QVector<XcpEvent
     for(const auto& event: events) {
         ui->triggerComboBox->addItem(event.getName());
     }
+    for(const auto& event: events) {
+        ui->triggerComboBox->addItem(STIM_PREFIX + event.getName());
+    }
 }
 
 bool DialogRecordConfigurationHelper::isPollingMode(const QString &comboText) {
     return  (comboText.compare("polling") == 0);
 }
+
+bool DialogRecordConfigurationHelper::isStimMode(const QString &comboText) {
+    return comboText.startsWith(STIM_PREFIX);
+}
+
+void DialogRecordConfigurationHelper::createStimGenerator() {
+    static const double MS_TO_S = 0.001;
+    StimGenerator::Waveform waveform = static_cast<StimGenerator::Waveform>(ui->stimComboBox->currentIndex());
+    double amplitude = ui->amplitudeTextEdit->text().toDouble();
+    double offset = ui->offsetTextEdit->text().toDouble();
+    double periodInS = ui->periodTextEdit->text().isEmpty() ? 1.0 : ui->periodTextEdit->text().toDouble() * MS_TO_S;
+    stimGenerator = std::make_shared<StimGenerator>(waveform, amplitude, offset, periodInS);
+
+    if(waveform == StimGenerator::Waveform::Replay) {
+        QString fileName = QFileDialog::getOpenFileName(this,
+                           tr("Open recorded measurement"),
+                           QString(),
+                           tr("Record file (*.csv)"));
+        std::vector<std::pair<double, double>> samples;
+        if(fileName.isEmpty() || !loadReplaySamples(fileName, samples)) {
+            QMessageBox::warning(this, "OpenXCP", "No samples of " + signalName + " found. The offset is used as constant stimulus.");
+        }
+        stimGenerator->setReplaySamples(samples);
+    }
+}
+
+/**
+ * Reads the column of the signal from a measurement which was recorded by OpenXCP (see Backend::saveRecord()).
+ * Rows without a value of the signal are skipped.
+ */
+bool DialogRecordConfigurationHelper::loadReplaySamples(const QString &path, std::vector<std::pair<double, double>> &samples) {
+    static const QString SEPERATOR = ";";
+    QList<QStringList> rows = QtCSV::Reader::readToList(path, SEPERATOR, "");
+    int column = -1;
+    for(const auto& row : rows) {
+        if(column < 0) { // search the row with the signal names
+            if(!row.isEmpty() && row.first() == "t[s]") {
+                for(int i = 1; i < row.size(); i++) {
+                    if(row.at(i).startsWith(signalName + "[")) {
+                        column = i;
+                        break;
+                    }
+                }
+                if(column < 0) {
+                    return false;
+                }
+            }
+            continue;
+        }
+        if(column >= row.size() || row.at(column).trimmed().isEmpty()) {
+            continue;
+        }
+        bool isTimeValid, isValueValid;
+        double time = row.first().toDouble(&isTimeValid);
+        double value = row.at(column).toDouble(&isValueValid);
+        if(isTimeValid && isValueValid) {
+            samples.push_back(std::make_pair(time, value));
+        }
+    }
+    return !samples.empty();
+}
@@ -11,7 +11,10 @@
 #include <QDialog>
 #include <QString>
 
+#include <memory>
+
 #include "xcpConfig/xcpEvent.h"
+#include "record/stimGenerator.h"
 
 namespace Ui {
 class dialogRecordConfigurationHelper;
@@ -21,13 +24,17 @@ class DialogRecordConfigurationHelper : public QDialog {
     Q_OBJECT
 
   public:
-    explicit DialogRecordConfigurationHelper(const QVector<XcpEvent>& events, int ratePreset, QWidget *parent = 0);
+    explicit DialogRecordConfigurationHelper(const QVector<XcpEvent>& events, int ratePreset, const QString& signalName = QString(), QWidget *parent = 0);
     ~DialogRecordConfigurationHelper();
 
     QString getTrigger() const;
 
     int getRate() const;
 
+    bool getIsStimulation() const;
+
+    std::shared_ptr<StimGenerator> getStimGenerator() const;
+
   private slots:
     void on_buttonBox_accepted();
 
@@ -38,11 +45,18 @@ class DialogRecordConfigurationHelper : public QDialog {
     QString trigger;
     int ratePreset;
     int rateUser;
+    QString signalName;
+    bool isStimulation;
+    std::shared_ptr<StimGenerator> stimGenerator;
 
     static const int POLLING_RATE_MIN = 10;
+    static const QString STIM_PREFIX;
 
     void addEventsToComboBox(const QVector<XcpEvent>& events);
     bool isPollingMode(const QString &comboText);
+    bool isStimMode(const QString &comboText);
+    void createStimGenerator();
+    bool loadReplaySamples(const QString& path, std::vector<std::pair<double, double>>& samples);
 };
 
 #endif // DIALOGRECORDCONFIGURATIONHELPER_H
@@ -0,0 +1,142 @@
+/**
+*@file editorTableModel.cpp
+*@author Michael Wolf
+*@date 19.10.2026
+*@brief Table model of the parse results in the editor tab. The cells are formatted on demand for the visible rows only,
+* so the table opens in constant time for ELF files with millions of symbols. A filter shows the results of a name search,
+* its rows are appended while the search is running.
+*/
+
+#include "editorTableModel.h"
+
+EditorTableModel::EditorTableModel(QSharedPointer<Model> model, QObject *parent)
+    : QAbstractTableModel(parent),
+      isFiltered(false),
+      model(model),
+      selectIcon(":/resource/icons_gnome/24x24/status/starred.png") {
+
+}
+
+int EditorTableModel::rowCount(const QModelIndex &parent) const {
+    if(parent.isValid()) {
+        return 0;
+    }
+    return isFiltered ? (int) rows.size() : parseResults.size();
+}
+
+int EditorTableModel::columnCount(const QModelIndex &parent) const {
+    return parent.isValid() ? 0 : COLUMN_COUNT;
+}
+
+QVariant EditorTableModel::data(const QModelIndex &index, int role) const {
+    int parseResultIndex = getParseResultIndex(index.row());
+    if(!index.isValid() || parseResultIndex < 0) {
+        return QVariant();
+    }
+    const shared_ptr<ParseResultBase>& var = parseResults.at(parseResultIndex);
+    if(role == Qt::DecorationRole && index.column() == SELECTED && var->getIsSelectedByUser()) {
+        return selectIcon;
+    }
+    if(role != Qt::DisplayRole) {
+        return QVariant();
+    }
+    switch(index.column()) {
+    case SELECTED:
+        return var->getIsSelectedByUser() ? QString("select") : QString();
+    case DATATYPE:
+        return QString::fromStdString(var->getDataType());
+    case NAME:
+        return QString::fromStdString(var->getName());
+    case ADDRESS:
+        return QString::number(var->getAddress(), 16).toUpper();
+    case COMMENT:
+        if(var->getSrcParserObj() != nullptr) {
+            return QString::fromStdString(var->getSrcParserObj()->getComment());
+        }
+        return QString();
+    case ABSTRACT_TYPE:
+        return QString::fromStdString(var->getAbstractDataType());
+    default:
+        return QVariant();
+    }
+}
+
+QVariant EditorTableModel::headerData(int section, Qt::Orientation orientation, int role) const {
+    if(orientation != Qt::Horizontal) {
+        return QAbstractTableModel::headerData(section, orientation, role);
+    }
+    if(role == Qt::TextAlignmentRole) {
+        return (int) Qt::AlignCenter;
+    }
+    if(role == Qt::DecorationRole && section == SELECTED) {
+        return selectIcon;
+    }
+    if(role != Qt::DisplayRole) {
+        return QVariant();
+    }
+    static const char* HEADERS[COLUMN_COUNT] = {"Selected", "Datatype", "Name", "Address", "Comment", "Abstract type"};
+    if(section < 0 || section >= COLUMN_COUNT) {
+        return QVariant();
+    }
+    return QString(HEADERS[section]);
+}
+
+void EditorTableModel::rebuild() {
+    beginResetModel();
+    parseResults = model->getParseResults();
+    rows.clear();
+    isFiltered = false;
+    endResetModel();
+}
+
+std::vector<std::string> EditorTableModel::getNames() const {
+    std::vector<std::string> names;
+    names.reserve(parseResults.size());
+    for(const shared_ptr<ParseResultBase>& var : parseResults) {
+        names.push_back(var->getName());
+    }
+    return names;
+}
+
+void EditorTableModel::beginFilter() {
+    beginResetModel();
+    rows.clear();
+    isFiltered = true;
+    endResetModel();
+}
+
+void EditorTableModel::appendFilterRows(const std::vector<uint32_t>& parseResultIndices) {
+    if(!isFiltered || parseResultIndices.empty()) {
+        return;
+    }
+    int first = (int) rows.size();
+    beginInsertRows(QModelIndex(), first, first + (int) parseResultIndices.size() - 1);
+    for(uint32_t parseResultIndex : parseResultIndices) {
+        rows.push_back((int) parseResultIndex);
+    }
+    endInsertRows();
+}
+
+void EditorTableModel::clearFilter() {
+    if(!isFiltered) {
+        return;
+    }
+    beginResetModel();
+    rows.clear();
+    isFiltered = false;
+    endResetModel();
+}
+
+int EditorTableModel::getParseResultIndex(const int row) const {
+    if(row < 0 || row >= rowCount()) {
+        return -1;
+    }
+    return isFiltered ? rows[row] : row;
+}
+
+void EditorTableModel::updateRow(const int row) {
+    if(row < 0 || row >= rowCount()) {
+        return;
+    }
+    emit dataChanged(index(row, 0), index(row, COLUMN_COUNT - 1));
+}
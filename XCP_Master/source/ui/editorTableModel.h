@@ -0,0 +1,80 @@
+/**
+*@file editorTableModel.h
+*@author Michael Wolf
+*@date 19.10.2026
+*@brief Table model of the parse results in the editor tab. The cells are formatted on demand for the visible rows only,
+* so the table opens in constant time for ELF files with millions of symbols. A filter shows the results of a name search,
+* its rows are appended while the search is running.
+*/
+
+#ifndef EDITORTABLEMODEL_H
+#define EDITORTABLEMODEL_H
+
+#include <QAbstractTableModel>
+#include <QSharedPointer>
+#include <QVector>
+#include <QIcon>
+
+#include <memory>
+#include <vector>
+#include <string>
+
+#include "main/model.h"
+
+class EditorTableModel : public QAbstractTableModel {
+    Q_OBJECT
+
+  public:
+    enum COLUMN {SELECTED, DATATYPE, NAME, ADDRESS, COMMENT, ABSTRACT_TYPE, COLUMN_COUNT};
+
+    EditorTableModel(QSharedPointer<Model> model, QObject *parent = Q_NULLPTR);
+
+    int rowCount(const QModelIndex &parent = QModelIndex()) const override;
+    int columnCount(const QModelIndex &parent = QModelIndex()) const override;
+    QVariant data(const QModelIndex &index, int role = Qt::DisplayRole) const override;
+    QVariant headerData(int section, Qt::Orientation orientation, int role = Qt::DisplayRole) const override;
+
+    /**
+     * @brief rebuild reads the parse results of the model and shows all of them. Call after parsing or loading a project.
+     */
+    void rebuild();
+
+    /**
+     * @return the names of the parse results, the index of a name is the parse result index.
+     */
+    std::vector<std::string> getNames() const;
+
+    /**
+     * @brief beginFilter shows no rows until the results of a search are appended.
+     */
+    void beginFilter();
+
+    /**
+     * @brief appendFilterRows appends the parse result indices found by the search.
+     */
+    void appendFilterRows(const std::vector<uint32_t>& parseResultIndices);
+
+    /**
+     * @brief clearFilter shows all parse results.
+     */
+    void clearFilter();
+
+    /**
+     * @return index in the parse results of the model or -1.
+     */
+    int getParseResultIndex(const int row) const;
+
+    /**
+     * @brief updateRow invalidates the row, e.g. after the selection of the parse result changed.
+     */
+    void updateRow(const int row);
+
+  private:
+    QVector<shared_ptr<ParseResultBase>> parseResults; // shared with the model
+    std::vector<int> rows; // parse result index per row, empty if not filtered
+    bool isFiltered;
+    QSharedPointer<Model> model;
+    QIcon selectIcon;
+};
+
+#endif // EDITORTABLEMODEL_H
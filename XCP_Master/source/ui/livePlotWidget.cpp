@@ -0,0 +1,282 @@
+/**
+*@file livePlotWidget.cpp
+*@author Michael Wolf
+*@date 19.10.2026
+*@brief Time series plot of the selected measurements, drawn from the live sample store since the connect. Every trace is decimated
+* to the pixel width of the plot, so a frame costs the same for a window of 1 s or 1 h.
+* Mouse wheel: zoom, drag: pan, double click: follow the latest samples.
+*/
+
+#include "livePlotWidget.h"
+
+#include <QPainter>
+#include <QPolygonF>
+#include <QWheelEvent>
+#include <QMouseEvent>
+
+#include <cmath>
+#include <limits>
+#include <algorithm>
+
+namespace {
+const int MARGIN_LEFT = 60;
+const int MARGIN_RIGHT = 10;
+const int MARGIN_TOP = 5;
+const int MARGIN_BOTTOM = 20;
+const int TICK_COUNT = 6;
+const double DEFAULT_WINDOW_SECONDS = 10.0;
+const double MIN_WINDOW_SECONDS = 0.01;
+const double MAX_WINDOW_SECONDS = 1e6;
+const double ZOOM_FACTOR = 1.25;
+
+const Qt::GlobalColor TRACE_COLORS[] = {Qt::blue, Qt::red, Qt::darkGreen, Qt::magenta, Qt::darkCyan, Qt::darkYellow, Qt::darkRed, Qt::black};
+
+/**
+ * @brief niceStep tick distance of 1, 2 or 5 * 10^n for about count ticks on the range.
+ */
+double niceStep(const double range, const int count) {
+    double raw = range / count;
+    double magnitude = std::pow(10.0, std::floor(std::log10(raw)));
+    double normalized = raw / magnitude;
+    if(normalized < 1.5) {
+        return magnitude;
+    } else if(normalized < 3.0) {
+        return 2.0 * magnitude;
+    } else if(normalized < 7.0) {
+        return 5.0 * magnitude;
+    }
+    return 10.0 * magnitude;
+}
+}
+
+LivePlotWidget::LivePlotWidget(QWidget *parent)
+    : QWidget(parent),
+      mode(PlotDecimator::MODE::MIN_MAX),
+      isFollowing(true),
+      windowSeconds(DEFAULT_WINDOW_SECONDS),
+      viewBegin(0.0),
+      viewEnd(DEFAULT_WINDOW_SECONDS),
+      dragX(0),
+      dragViewBegin(0.0) {
+
+    setMinimumHeight(120);
+    setToolTip("Mouse wheel: zoom, drag: pan, double click: follow the latest samples");
+}
+
+void LivePlotWidget::setSignalNames(const QStringList& names) {
+    signalNames = names;
+    resolveTraces();
+    update();
+}
+
+void LivePlotWidget::setMode(const PlotDecimator::MODE mode) {
+    this->mode = mode;
+    update();
+}
+
+void LivePlotWidget::refresh(const std::shared_ptr<SampleStore>& sampleStore) {
+    if(sampleStore != this->sampleStore) {
+        this->sampleStore = sampleStore;
+        resolveTraces();
+    }
+    if(this->sampleStore) {
+        for(Trace& trace : traces) {
+            trace.pyramid.update(this->sampleStore->getColumn(trace.signalId));
+        }
+    }
+    if(isFollowing) {
+        viewEnd = std::max(getLatestTime(), windowSeconds);
+        viewBegin = viewEnd - windowSeconds;
+    }
+    update();
+}
+
+/***************************************************************
+*  Paint
+****************************************************************/
+/**
+ * The traces share the value axis, it is scaled to the visible points of all traces. The points are physical values
+ * already, the pyramid converts the samples before they are decimated.
+ */
+void LivePlotWidget::paintEvent(QPaintEvent *event) {
+    Q_UNUSED(event);
+    QPainter painter(this);
+    painter.fillRect(rect(), palette().base());
+    QRect area = getPlotArea();
+    painter.setPen(palette().mid().color());
+    painter.drawRect(area);
+    if(traces.empty() || area.width() <= 0 || area.height() <= 0) {
+        painter.setPen(palette().text().color());
+        painter.drawText(area, Qt::AlignCenter, "Select measurements in the table to plot their values since the connect.");
+        return;
+    }
+
+    double min = std::numeric_limits<double>::max();
+    double max = -std::numeric_limits<double>::max();
+    for(Trace& trace : traces) {
+        PlotDecimator::decimate(mode, sampleStore->getColumn(trace.signalId), trace.pyramid, viewBegin, viewEnd, (size_t) area.width(), trace.points);
+        for(const PlotPoint& point : trace.points) {
+            if(point.time >= viewBegin && point.time <= viewEnd) {
+                min = std::min(min, point.value);
+                max = std::max(max, point.value);
+            }
+        }
+    }
+    if(min > max) {
+        min = -1.0;
+        max = 1.0;
+    } else if(min == max) {
+        min -= 1.0;
+        max += 1.0;
+    }
+    double margin = (max - min) * 0.05;
+    min -= margin;
+    max += margin;
+    auto valueToY = [&](const double value) {
+        return area.bottom() - (value - min) / (max - min) * area.height();
+    };
+
+    // grid and axes
+    painter.setPen(QPen(palette().mid().color(), 0, Qt::DotLine));
+    double valueStep = niceStep(max - min, TICK_COUNT);
+    for(double value = std::ceil(min / valueStep) * valueStep; value <= max; value += valueStep) {
+        int y = (int) valueToY(value);
+        painter.drawLine(area.left(), y, area.right(), y);
+        painter.drawText(QRect(0, y - 8, MARGIN_LEFT - 4, 16), Qt::AlignRight | Qt::AlignVCenter, QString::number(value, 'g', 4));
+    }
+    double timeStep = niceStep(viewEnd - viewBegin, TICK_COUNT);
+    for(double time = std::ceil(viewBegin / timeStep) * timeStep; time <= viewEnd; time += timeStep) {
+        int x = (int) timeToX(time, area);
+        painter.drawLine(x, area.top(), x, area.bottom());
+        painter.drawText(QRect(x - 40, area.bottom() + 2, 80, MARGIN_BOTTOM - 2), Qt::AlignCenter, QString::number(time, 'g', 6) + " s");
+    }
+
+    // traces
+    painter.save();
+    painter.setClipRect(area);
+    painter.setRenderHint(QPainter::Antialiasing, false);
+    for(const Trace& trace : traces) {
+        QPolygonF polyline;
+        polyline.reserve((int) trace.points.size());
+        for(const PlotPoint& point : trace.points) {
+            polyline.append(QPointF(timeToX(point.time, area), valueToY(point.value)));
+        }
+        painter.setPen(QPen(trace.color, 1));
+        painter.drawPolyline(polyline);
+    }
+    painter.restore();
+
+    // legend
+    int y = area.top() + 4;
+    for(const Trace& trace : traces) {
+        painter.setPen(QPen(trace.color, 2));
+        painter.drawLine(area.left() + 6, y + 7, area.left() + 22, y + 7);
+        painter.setPen(palette().text().color());
+        painter.drawText(area.left() + 26, y, area.width() - 30, 14, Qt::AlignLeft | Qt::AlignVCenter, trace.name);
+        y += 16;
+    }
+}
+
+/***************************************************************
+*  Zoom and pan
+****************************************************************/
+/**
+ * While following, the wheel changes the length of the window. Otherwise it zooms around the time under the cursor.
+ */
+void LivePlotWidget::wheelEvent(QWheelEvent *event) {
+    double factor = event->angleDelta().y() > 0 ? 1.0 / ZOOM_FACTOR : ZOOM_FACTOR;
+    double length = std::min(std::max((viewEnd - viewBegin) * factor, MIN_WINDOW_SECONDS), MAX_WINDOW_SECONDS);
+    if(isFollowing) {
+        windowSeconds = length;
+        viewBegin = viewEnd - windowSeconds;
+    } else {
+        QRect area = getPlotArea();
+        double anchor = xToTime(event->pos().x(), area);
+        double ratio = (anchor - viewBegin) / (viewEnd - viewBegin);
+        viewBegin = anchor - ratio * length;
+        viewEnd = viewBegin + length;
+    }
+    update();
+    event->accept();
+}
+
+void LivePlotWidget::mousePressEvent(QMouseEvent *event) {
+    if(event->button() == Qt::LeftButton) {
+        dragX = event->pos().x();
+        dragViewBegin = viewBegin;
+    }
+}
+
+void LivePlotWidget::mouseMoveEvent(QMouseEvent *event) {
+    if(!(event->buttons() & Qt::LeftButton)) {
+        return;
+    }
+    QRect area = getPlotArea();
+    double length = viewEnd - viewBegin;
+    isFollowing = false;
+    viewBegin = dragViewBegin + (dragX - event->pos().x()) * length / std::max(area.width(), 1);
+    viewEnd = viewBegin + length;
+    update();
+}
+
+void LivePlotWidget::mouseDoubleClickEvent(QMouseEvent *event) {
+    Q_UNUSED(event);
+    isFollowing = true;
+    windowSeconds = viewEnd - viewBegin;
+    refresh(sampleStore);
+}
+
+/***************************************************************
+*  Utility
+****************************************************************/
+void LivePlotWidget::resolveTraces() {
+    traces.clear();
+    if(!sampleStore) {
+        return;
+    }
+    const std::vector<RecordSignal>& signalTable = sampleStore->getSignalTable();
+    for(const QString& name : signalNames) {
+        for(uint32_t signalId = 0; signalId < signalTable.size(); signalId++) {
+            if(signalTable[signalId].name != name.toStdString()) {
+                continue;
+            }
+            Trace trace;
+            trace.name = name;
+            trace.signalId = signalId;
+            ConversionFunction conversion;
+            conversion.compile(signalTable[signalId].conversion);
+            trace.pyramid.setConversion(conversion);
+            trace.color = TRACE_COLORS[traces.size() % (sizeof(TRACE_COLORS) / sizeof(TRACE_COLORS[0]))];
+            if(!signalTable[signalId].unit.empty()) {
+                trace.name += " [" + QString::fromStdString(signalTable[signalId].unit) + "]";
+            }
+            traces.push_back(trace);
+            break;
+        }
+    }
+}
+
+double LivePlotWidget::getLatestTime() const {
+    double latest = 0.0;
+    if(sampleStore) {
+        for(const Trace& trace : traces) {
+            const SampleColumn& column = sampleStore->getColumn(trace.signalId);
+            if(column.getSize() > 0) {
+                latest = std::max(latest, column.getTime(column.getSize() - 1));
+            }
+        }
+    }
+    return latest;
+}
+
+QRect LivePlotWidget::getPlotArea() const {
+    return rect().adjusted(MARGIN_LEFT, MARGIN_TOP, -MARGIN_RIGHT, -MARGIN_BOTTOM);
+}
+
+double LivePlotWidget::timeToX(const double time, const QRect& area) const {
+    return area.left() + (time - viewBegin) / (viewEnd - viewBegin) * area.width();
+}
+
+double LivePlotWidget::xToTime(const int x, const QRect& area) const {
+    return viewBegin + (double) (x - area.left()) / std::max(area.width(), 1) * (viewEnd - viewBegin);
+}
@@ -0,0 +1,76 @@
+/**
+*@file livePlotWidget.h
+*@author Michael Wolf
+*@date 19.10.2026
+*@brief Time series plot of the selected measurements, drawn from the live sample store since the connect. Every trace is decimated
+* to the pixel width of the plot, so a frame costs the same for a window of 1 s or 1 h.
+* Mouse wheel: zoom, drag: pan, double click: follow the latest samples.
+*/
+
+#ifndef LIVEPLOTWIDGET_H
+#define LIVEPLOTWIDGET_H
+
+#include <QWidget>
+#include <QStringList>
+#include <QColor>
+
+#include <memory>
+#include <vector>
+
+#include "record/sampleStore.h"
+#include "record/summaryPyramid.h"
+#include "record/plotDecimator.h"
+
+class LivePlotWidget : public QWidget {
+    Q_OBJECT
+
+  public:
+    explicit LivePlotWidget(QWidget *parent = Q_NULLPTR);
+
+    /**
+     * @brief setSignalNames the signals to plot, resolved by name in the signal table of the sample store.
+     */
+    void setSignalNames(const QStringList& names);
+    void setMode(const PlotDecimator::MODE mode);
+
+    /**
+     * @brief refresh summarizes the new samples and repaints, called once per frame. A new sample store (connect) resets the plot.
+     */
+    void refresh(const std::shared_ptr<SampleStore>& sampleStore);
+
+  protected:
+    void paintEvent(QPaintEvent *event) override;
+    void wheelEvent(QWheelEvent *event) override;
+    void mousePressEvent(QMouseEvent *event) override;
+    void mouseMoveEvent(QMouseEvent *event) override;
+    void mouseDoubleClickEvent(QMouseEvent *event) override;
+
+  private:
+    struct Trace {
+        QString name;
+        uint32_t signalId;
+        SummaryPyramid pyramid; // of the physical values
+        QColor color;
+        std::vector<PlotPoint> points; // of the last frame, physical values
+    };
+
+    void resolveTraces();
+    double getLatestTime() const;
+    QRect getPlotArea() const;
+    double timeToX(const double time, const QRect& area) const;
+    double xToTime(const int x, const QRect& area) const;
+
+    std::shared_ptr<SampleStore> sampleStore;
+    QStringList signalNames;
+    std::vector<Trace> traces;
+    PlotDecimator::MODE mode;
+
+    bool isFollowing; // the view ends at the latest sample
+    double windowSeconds; // length of the view when following
+    double viewBegin;
+    double viewEnd;
+    int dragX;
+    double dragViewBegin;
+};
+
+#endif // LIVEPLOTWIDGET_H
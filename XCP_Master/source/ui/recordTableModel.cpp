@@ -0,0 +1,255 @@
+/**
+*@file recordTableModel.cpp
+*@author Michael Wolf
+*@date 19.10.2026
+*@brief Table model of the measurement and calibration tables in the record tab. The cells are formatted on demand from the
+* record elements. New values only mark their row dirty, refresh() invalidates the changed cells of the dirty rows once per frame.
+*/
+
+#include "recordTableModel.h"
+
+#include "parser/sourceparsemeasurement.h"
+#include "parser/sourceparsecharacteristic.h"
+#include "record/signalRegistry.h"
+#include "record/signalStatistics.h"
+
+RecordTableModel::RecordTableModel(const TABLE table, QSharedPointer<Model> model, QObject *parent)
+    : QAbstractTableModel(parent),
+      table(table),
+      model(model) {
+
+}
+
+int RecordTableModel::rowCount(const QModelIndex &parent) const {
+    return parent.isValid() ? 0 : (int) rows.size();
+}
+
+int RecordTableModel::columnCount(const QModelIndex &parent) const {
+    if(parent.isValid()) {
+        return 0;
+    }
+    return table == TABLE::MEASUREMENT ? MEASUREMENT_COLUMN_COUNT : CALIBRATION_COLUMN_COUNT;
+}
+
+QVariant RecordTableModel::data(const QModelIndex &index, int role) const {
+    if(!index.isValid() || index.row() >= (int) rows.size()) {
+        return QVariant();
+    }
+    const Row& row = rows[index.row()];
+    if(table == TABLE::MEASUREMENT) {
+        return measurementData(row, index.column(), role);
+    }
+    return calibrationData(row, index.column(), role);
+}
+
+QVariant RecordTableModel::headerData(int section, Qt::Orientation orientation, int role) const {
+    if(orientation != Qt::Horizontal) {
+        return QAbstractTableModel::headerData(section, orientation, role);
+    }
+    if(role == Qt::TextAlignmentRole) {
+        return (int) Qt::AlignCenter;
+    }
+    if(role != Qt::DisplayRole) {
+        return QVariant();
+    }
+    static const char* MEASUREMENT_HEADERS[MEASUREMENT_COLUMN_COUNT] = {"Id", "Name", "Value", "Phy. unit", "Min", "Max", "Mean", "Std. dev.",
+                                                                        "Rate [Hz]", "Comment"
+                                                                       };
+    static const char* CALIBRATION_HEADERS[CALIBRATION_COLUMN_COUNT] = {"Id", "Name", "Value", "Phy. unit", "Comment", "Minimum value",
+                                                                        "Maximum value", "Step size"
+                                                                       };
+    if(section < 0 || section >= columnCount()) {
+        return QVariant();
+    }
+    return QString(table == TABLE::MEASUREMENT ? MEASUREMENT_HEADERS[section] : CALIBRATION_HEADERS[section]);
+}
+
+/**
+ * The rows are the selected record elements of the table in the order of the record elements.
+ */
+void RecordTableModel::rebuild() {
+    beginResetModel();
+    rows.clear();
+    rowOfSignal.clear();
+    dirtyRows.clear();
+    QList<std::shared_ptr<RecordElement>> recordElements = model->getRecordElements();
+    for(int i = 0; i < recordElements.size(); i++) {
+        const std::shared_ptr<RecordElement>& recordElement = recordElements[i];
+        shared_ptr<ParseResultBase> parseResult = recordElement->getParseResult();
+        bool isTable = (table == TABLE::MEASUREMENT) ? (parseResult->getSrcMeasurement() != nullptr) : (parseResult->getSrcCharateristic() != nullptr);
+        if(!recordElement->getIsSelected() || !isTable) {
+            continue;
+        }
+        Row row;
+        row.recordElementsIndex = i;
+        row.recordElement = recordElement;
+        row.signalId = recordElement->getSignalId();
+        row.value = recordElement->getLatestValueInt();
+        row.min = 0.0;
+        row.max = 0.0;
+        if(model->getSignalRegistry()->isValid(row.signalId)) {
+            if(row.signalId >= rowOfSignal.size()) {
+                rowOfSignal.resize(row.signalId + 1, -1);
+            }
+            rowOfSignal[row.signalId] = (int) rows.size();
+        }
+        rows.push_back(row);
+    }
+    isRowDirty.assign(rows.size(), false);
+    endResetModel();
+}
+
+void RecordTableModel::markDirty(const uint32_t signalId) {
+    if(signalId >= rowOfSignal.size() || rowOfSignal[signalId] < 0) {
+        return;
+    }
+    int rowIndex = rowOfSignal[signalId];
+    if(!isRowDirty[rowIndex]) {
+        isRowDirty[rowIndex] = true;
+        dirtyRows.push_back(rowIndex);
+    }
+}
+
+void RecordTableModel::refresh() {
+    for(int rowIndex : dirtyRows) {
+        isRowDirty[rowIndex] = false;
+        updateRow(rowIndex);
+    }
+    dirtyRows.clear();
+}
+
+/**
+ * Measurement: the value, min and max are compared with the last refresh, mean, standard deviation and rate change with
+ * every sample. Only the range of the changed columns is invalidated.
+ */
+void RecordTableModel::updateRow(const int rowIndex) {
+    Row& row = rows[rowIndex];
+    int64_t value = row.recordElement->getLatestValueInt();
+    if(table == TABLE::CALIBRATION) {
+        if(value != row.value) {
+            row.value = value;
+            emit dataChanged(index(rowIndex, CALIBRATION_VALUE), index(rowIndex, CALIBRATION_VALUE), {Qt::DisplayRole});
+        }
+        return;
+    }
+    int firstColumn = MEASUREMENT_MEAN;
+    SignalStatistics::Summary session;
+    if(model->getSignalStatistics()->read(row.signalId, SignalStatistics::SCOPE::SESSION, session) && (session.min != row.min || session.max != row.max)) {
+        row.min = session.min;
+        row.max = session.max;
+        firstColumn = MEASUREMENT_MIN;
+    }
+    if(value != row.value) {
+        row.value = value;
+        firstColumn = MEASUREMENT_VALUE;
+    }
+    emit dataChanged(index(rowIndex, firstColumn), index(rowIndex, MEASUREMENT_RATE), {Qt::DisplayRole, Qt::ToolTipRole});
+}
+
+void RecordTableModel::updateValues() {
+    if(rows.empty()) {
+        return;
+    }
+    int column = table == TABLE::MEASUREMENT ? (int) MEASUREMENT_VALUE : (int) CALIBRATION_VALUE;
+    emit dataChanged(index(0, column), index((int) rows.size() - 1, column), {Qt::DisplayRole});
+}
+
+int RecordTableModel::getRecordElementsIndex(const int row) const {
+    if(row < 0 || row >= (int) rows.size()) {
+        return -1;
+    }
+    return rows[row].recordElementsIndex;
+}
+
+QVariant RecordTableModel::measurementData(const Row& row, const int column, const int role) const {
+    shared_ptr<ParseResultBase> parseResult = row.recordElement->getParseResult();
+    shared_ptr<SignalStatistics> statistics = model->getSignalStatistics();
+    if(role == Qt::ToolTipRole && column == MEASUREMENT_VALUE) {
+        SignalStatistics::Summary window;
+        if(statistics->read(row.signalId, SignalStatistics::SCOPE::WINDOW, window) && (window.count > 0)) {
+            return QString("Last %1 s: min %2, max %3, mean %4, std. dev. %5, %6 samples")
+                   .arg(statistics->getWindowSeconds()).arg(window.min).arg(window.max).arg(window.mean)
+                   .arg(window.stdDev).arg(window.count);
+        }
+        return QVariant();
+    }
+    if(role != Qt::DisplayRole) {
+        return QVariant();
+    }
+    SignalStatistics::Summary session;
+    bool isStatistics = (column >= MEASUREMENT_MIN && column <= MEASUREMENT_RATE)
+                        && statistics->read(row.signalId, SignalStatistics::SCOPE::SESSION, session) && (session.count > 0);
+    switch (column) {
+    case MEASUREMENT_ID:
+        return QString::number(row.recordElementsIndex);
+    case MEASUREMENT_NAME:
+        return QString::fromStdString(parseResult->getName());
+    case MEASUREMENT_VALUE:
+        return formatValue(row);
+    case MEASUREMENT_UNIT:
+        return QString::fromStdString(parseResult->getSrcParserObj()->getPhyUnit());
+    case MEASUREMENT_MIN:
+        return isStatistics ? QString::number(session.min) : "";
+    case MEASUREMENT_MAX:
+        return isStatistics ? QString::number(session.max) : "";
+    case MEASUREMENT_MEAN:
+        return isStatistics ? QString::number(session.mean) : "";
+    case MEASUREMENT_STD_DEV:
+        return isStatistics ? QString::number(session.stdDev) : "";
+    case MEASUREMENT_RATE: {
+        SignalStatistics::Summary window; // current rate, zero if the signal stopped
+        bool isWindow = isStatistics && statistics->read(row.signalId, SignalStatistics::SCOPE::WINDOW, window);
+        return isWindow ? QString::number(window.rate, 'f', 1) : "";
+    }
+    case MEASUREMENT_COMMENT:
+        return QString::fromStdString(parseResult->getSrcParserObj()->getComment());
+    default:
+        return QVariant();
+    }
+}
+
+QVariant RecordTableModel::calibrationData(const Row& row, const int column, const int role) const {
+    if(role != Qt::DisplayRole) {
+        return QVariant();
+    }
+    shared_ptr<ParseResultBase> parseResult = row.recordElement->getParseResult();
+    switch (column) {
+    case CALIBRATION_ID:
+        return QString::number(row.recordElementsIndex);
+    case CALIBRATION_NAME:
+        return QString::fromStdString(parseResult->getName());
+    case CALIBRATION_VALUE:
+        return formatValue(row);
+    case CALIBRATION_UNIT:
+        return QString::fromStdString(parseResult->getSrcParserObj()->getPhyUnit());
+    case CALIBRATION_COMMENT:
+        return QString::fromStdString(parseResult->getSrcParserObj()->getComment());
+    case CALIBRATION_MIN:
+        return QString::number(parseResult->getSrcParserObj()->getLowerLimit());
+    case CALIBRATION_MAX:
+        return QString::number(parseResult->getSrcParserObj()->getUpperLimit());
+    case CALIBRATION_STEP_SIZE:
+        return QString::number(parseResult->getSrcCharateristic()->getStepSize());
+    default:
+        return QVariant();
+    }
+}
+
+/**
+ * Measurement: the physical value if the signal has a conversion. Calibration: the value to set of a pending dataset is appended.
+ */
+QString RecordTableModel::formatValue(const Row& row) const {
+    const std::shared_ptr<RecordElement>& recordElement = row.recordElement;
+    QString value = QString::number(recordElement->getLatestValueInt());
+    if(table == TABLE::MEASUREMENT) {
+        const shared_ptr<SignalRegistry> signalRegistry = model->getSignalRegistry();
+        if(signalRegistry->isValid(row.signalId) && !signalRegistry->getSignal(row.signalId).conversion.getIsIdentity()) {
+            value = QString::number(signalRegistry->toPhysical(row.signalId, recordElement->getLatestValueInt()));
+        }
+    } else if(recordElement->getIsCalibrationPending()) {
+        QString valueToSet = recordElement->getIsFloat() ? QString::number(recordElement->getValueToSetFloat())
+                             : QString::number(recordElement->getValueToSetInt());
+        value += " (dataset: " + valueToSet + ")";
+    }
+    return value;
+}
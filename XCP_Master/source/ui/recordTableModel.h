@@ -0,0 +1,91 @@
+/**
+*@file recordTableModel.h
+*@author Michael Wolf
+*@date 19.10.2026
+*@brief Table model of the measurement and calibration tables in the record tab. The cells are formatted on demand from the
+* record elements. New values only mark their row dirty, refresh() invalidates the changed cells of the dirty rows once per frame.
+*/
+
+#ifndef RECORDTABLEMODEL_H
+#define RECORDTABLEMODEL_H
+
+#include <QAbstractTableModel>
+#include <QList>
+#include <QSharedPointer>
+
+#include <memory>
+#include <vector>
+
+#include "main/model.h"
+#include "record/recordElement.h"
+
+class RecordTableModel : public QAbstractTableModel {
+    Q_OBJECT
+
+  public:
+    enum class TABLE {MEASUREMENT, CALIBRATION};
+
+    enum MEASUREMENT_COLUMN {MEASUREMENT_ID, MEASUREMENT_NAME, MEASUREMENT_VALUE, MEASUREMENT_UNIT, MEASUREMENT_MIN, MEASUREMENT_MAX,
+                             MEASUREMENT_MEAN, MEASUREMENT_STD_DEV, MEASUREMENT_RATE, MEASUREMENT_COMMENT, MEASUREMENT_COLUMN_COUNT
+                            };
+    enum CALIBRATION_COLUMN {CALIBRATION_ID, CALIBRATION_NAME, CALIBRATION_VALUE, CALIBRATION_UNIT, CALIBRATION_COMMENT, CALIBRATION_MIN,
+                             CALIBRATION_MAX, CALIBRATION_STEP_SIZE, CALIBRATION_COLUMN_COUNT
+                            };
+
+    RecordTableModel(const TABLE table, QSharedPointer<Model> model, QObject *parent = Q_NULLPTR);
+
+    int rowCount(const QModelIndex &parent = QModelIndex()) const override;
+    int columnCount(const QModelIndex &parent = QModelIndex()) const override;
+    QVariant data(const QModelIndex &index, int role = Qt::DisplayRole) const override;
+    QVariant headerData(int section, Qt::Orientation orientation, int role = Qt::DisplayRole) const override;
+
+    /**
+     * @brief rebuild reads the selected record elements of the table and the signal ids. Call when the selection,
+     * the configuration or the signal registry (connect) changes.
+     */
+    void rebuild();
+
+    /**
+     * @brief markDirty marks the row of the signal for the next refresh, O(1). Called per sample.
+     */
+    void markDirty(const uint32_t signalId);
+
+    /**
+     * @brief refresh invalidates the cells of the dirty rows which changed since the last refresh. Called per frame.
+     */
+    void refresh();
+
+    /**
+     * @brief updateValues invalidates the value column of all rows, e.g. after the dataset changed.
+     */
+    void updateValues();
+
+    /**
+     * @return index in the record elements of the model or -1.
+     */
+    int getRecordElementsIndex(const int row) const;
+
+  private:
+    struct Row {
+        int recordElementsIndex;
+        std::shared_ptr<RecordElement> recordElement;
+        uint32_t signalId;
+        int64_t value; // of the last update, to find the changed cells
+        double min;
+        double max;
+    };
+
+    void updateRow(const int rowIndex);
+    QVariant measurementData(const Row& row, const int column, const int role) const;
+    QVariant calibrationData(const Row& row, const int column, const int role) const;
+    QString formatValue(const Row& row) const;
+
+    const TABLE table;
+    QSharedPointer<Model> model;
+    std::vector<Row> rows;
+    std::vector<int> rowOfSignal; // index: signal id, value: row or -1
+    std::vector<bool> isRowDirty;
+    std::vector<int> dirtyRows; // each row once, in the order of the first update
+};
+
+#endif // RECORDTABLEMODEL_H
@@ -0,0 +1,163 @@
+/**
+*@file calibrationMirror.cpp
+*@author Michael Wolf
+*@date 19.10.2026
+*@brief Local image of the slaves calibration memory. Only the bytes which differ from the image have to be downloaded.
+*/
+
+#include "calibrationMirror.h"
+
+#include <algorithm>
+#include <iterator>
+
+CalibrationMirror::CalibrationMirror() {
+
+}
+
+void CalibrationMirror::clear() {
+    blocks.clear();
+}
+
+void CalibrationMirror::update(const uint32_t addr, const uint8_t* data, const size_t size) {
+    if(size == 0) {
+        return;
+    }
+    uint64_t start = addr;
+    uint64_t end = start + size;
+
+    // collect all blocks which touch or overlap the new range and merge them into one block
+    auto first = blocks.upper_bound(addr);
+    if(first != blocks.begin()) {
+        auto prev = std::prev(first);
+        if((uint64_t) prev->first + prev->second.size() >= start) {
+            first = prev;
+        }
+    }
+    auto last = first;
+    while(last != blocks.end() && last->first <= end) {
+        last++;
+    }
+    if(first != last) {
+        start = std::min<uint64_t>(start, first->first);
+        auto lastMerged = std::prev(last);
+        end = std::max<uint64_t>(end, (uint64_t) lastMerged->first + lastMerged->second.size());
+    }
+
+    std::vector<uint8_t> merged(end - start);
+    for(auto it = first; it != last; it++) {
+        std::copy(it->second.begin(), it->second.end(), merged.begin() + (it->first - start));
+    }
+    std::copy(data, data + size, merged.begin() + (addr - start));
+    blocks.erase(first, last);
+    blocks.emplace((uint32_t) start, std::move(merged));
+}
+
+bool CalibrationMirror::read(const uint32_t addr, const size_t size, std::vector<uint8_t>& data) const {
+    auto it = blocks.upper_bound(addr);
+    if(it == blocks.begin()) {
+        return false;
+    }
+    it--;
+    uint64_t offset = addr - it->first;
+    if(offset + size > it->second.size()) {
+        return false;
+    }
+    data.assign(it->second.begin() + offset, it->second.begin() + offset + size);
+    return true;
+}
+
+bool CalibrationMirror::readByte(const uint64_t addr, uint8_t& value) const {
+    auto it = blocks.upper_bound((uint32_t) addr);
+    if(it == blocks.begin()) {
+        return false;
+    }
+    it--;
+    uint64_t offset = addr - it->first;
+    if(offset >= it->second.size()) {
+        return false;
+    }
+    value = it->second[offset];
+    return true;
+}
+
+std::vector<DownloadRange> CalibrationMirror::diff(const std::vector<DownloadRange>& ranges, const uint32_t maxGap) const {
+    std::vector<DownloadRange> changed;
+    for(const auto& range : ranges) {
+        size_t i = 0;
+        while(i < range.data.size()) {
+            uint8_t mirrored;
+            if(readByte((uint64_t) range.addr + i, mirrored) && mirrored == range.data[i]) {
+                i++;
+                continue;
+            }
+            // start of a changed run
+            uint64_t runAddr = (uint64_t) range.addr + i;
+            size_t runEnd = i + 1;
+            while(runEnd < range.data.size()) {
+                if(readByte((uint64_t) range.addr + runEnd, mirrored) && mirrored == range.data[runEnd]) {
+                    break;
+                }
+                runEnd++;
+            }
+
+            // merge with the previous run if the gap is small and its content is known
+            bool isMerged = false;
+            if(!changed.empty()) {
+                DownloadRange& previous = changed.back();
+                uint64_t gap = runAddr - previous.getEnd();
+                if(gap <= maxGap) {
+                    std::vector<uint8_t> gapData(gap);
+                    bool isGapKnown = true;
+                    for(uint64_t g = 0; g < gap; g++) {
+                        uint64_t gapAddr = previous.getEnd() + g;
+                        // inside the current target range the target content equals the mirror
+                        if(gapAddr >= range.addr) {
+                            gapData[g] = range.data[gapAddr - range.addr];
+                        } else if(!readByte(gapAddr, gapData[g])) {
+                            isGapKnown = false;
+                            break;
+                        }
+                    }
+                    if(isGapKnown) {
+                        previous.data.insert(previous.data.end(), gapData.begin(), gapData.end());
+                        previous.data.insert(previous.data.end(), range.data.begin() + i, range.data.begin() + runEnd);
+                        isMerged = true;
+                    }
+                }
+            }
+            if(!isMerged) {
+                DownloadRange run;
+                run.addr = (uint32_t) runAddr;
+                run.data.assign(range.data.begin() + i, range.data.begin() + runEnd);
+                changed.push_back(run);
+            }
+            i = runEnd;
+        }
+    }
+    return changed;
+}
+
+bool CalibrationMirror::align(DownloadRange& range, const uint32_t alignment) const {
+    uint32_t head = range.addr % alignment;
+    uint32_t tail = (alignment - (range.getEnd() % alignment)) % alignment;
+    if(head == 0 && tail == 0) {
+        return true;
+    }
+    std::vector<uint8_t> headData;
+    std::vector<uint8_t> tailData;
+    if((head > 0 && !read(range.addr - head, head, headData)) || (tail > 0 && !read((uint32_t) range.getEnd(), tail, tailData))) {
+        return false;
+    }
+    range.data.insert(range.data.begin(), headData.begin(), headData.end());
+    range.data.insert(range.data.end(), tailData.begin(), tailData.end());
+    range.addr -= head;
+    return true;
+}
+
+size_t CalibrationMirror::getSize() const {
+    size_t size = 0;
+    for(const auto& block : blocks) {
+        size += block.second.size();
+    }
+    return size;
+}
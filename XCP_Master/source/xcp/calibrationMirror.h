@@ -0,0 +1,57 @@
+/**
+*@file calibrationMirror.h
+*@author Michael Wolf
+*@date 19.10.2026
+*@brief Local image of the slaves calibration memory. Only the bytes which differ from the image have to be downloaded.
+*/
+
+#ifndef CALIBRATIONMIRROR_H
+#define CALIBRATIONMIRROR_H
+
+#include "downloadPlanner.h"
+
+#include <map>
+#include <vector>
+#include <stdint.h>
+#include <stddef.h>
+
+class CalibrationMirror {
+  public:
+    CalibrationMirror();
+
+    void clear();
+
+    /**
+     * @brief update stores memory content which is known to be in the slave (ELF image verified by checksum, upload, verified download).
+     */
+    void update(const uint32_t addr, const uint8_t* data, const size_t size);
+
+    /**
+     * @brief read copies the mirrored content.
+     * @return false if any byte of the range is unknown.
+     */
+    bool read(const uint32_t addr, const size_t size, std::vector<uint8_t>& data) const;
+
+    /**
+     * @brief diff reduces the target ranges to the bytes which differ from the mirror. Unknown bytes count as changed.
+     * Changed ranges with a gap of at most maxGap bytes are merged, the gap is filled with the (unchanged) mirror content,
+     * since one longer download is cheaper than an additional SET_MTA and DOWNLOAD round trip.
+     * @param ranges sorted, non overlapping ranges (see DownloadPlanner::mergeRanges()).
+     */
+    std::vector<DownloadRange> diff(const std::vector<DownloadRange>& ranges, const uint32_t maxGap) const;
+
+    /**
+     * @brief align extends the range to multiples of alignment (start and size) with the mirrored content around it.
+     * @return false if the padding bytes are unknown, the range is left unchanged then.
+     */
+    bool align(DownloadRange& range, const uint32_t alignment) const;
+
+    size_t getSize() const;
+
+  private:
+    bool readByte(const uint64_t addr, uint8_t& value) const;
+
+    std::map<uint32_t, std::vector<uint8_t>> blocks; // key: start address, blocks do not touch or overlap
+};
+
+#endif // CALIBRATIONMIRROR_H
@@ -6,12 +6,15 @@
 */
 
 #include "commandPayload.h"
+#include "record/signalRegistry.h"
 
 CommandPayload::CommandPayload() {
     cmd = UNINITIALIZED;
     id = UNINITIALIZED;
     sizeDataType = UNINITIALIZED;
     rateInMsec = UNINITIALIZED;
+    isResponseExpected = true;
+    signalId = SignalRegistry::INVALID_ID;
 }
 
 CommandPayload::CommandPayload(QByteArray payload, uint8_t cmd, uint64_t id, uint32_t sizeDataType, uint32_t rateInMsec)
@@ -19,7 +22,9 @@ CommandPayload::CommandPayload(QByteArray payload, uint8_t cmd, uint64_t id, uin
       cmd(cmd),
       id(id),
       sizeDataType(sizeDataType),
-      rateInMsec(rateInMsec) {
+      rateInMsec(rateInMsec),
+      isResponseExpected(true),
+      signalId(SignalRegistry::INVALID_ID) {
 }
 
 QByteArray CommandPayload::getPayload() const {
@@ -62,6 +67,18 @@ void CommandPayload::setRateInMsec(const uint32_t &value) {
     rateInMsec = value;
 }
 
+bool CommandPayload::getIsResponseExpected() const {
+    return isResponseExpected;
+}
 
+void CommandPayload::setIsResponseExpected(bool value) {
+    isResponseExpected = value;
+}
 
+uint32_t CommandPayload::getSignalId() const {
+    return signalId;
+}
 
+void CommandPayload::setSignalId(const uint32_t &value) {
+    signalId = value;
+}
@@ -39,12 +39,20 @@ class CommandPayload {
     uint32_t getRateInMsec() const;
     void setRateInMsec(const uint32_t &value);
 
+    bool getIsResponseExpected() const;
+    void setIsResponseExpected(bool value);
+
+    uint32_t getSignalId() const;
+    void setSignalId(const uint32_t &value);
+
   private:
     QByteArray payload;
     uint8_t cmd;
     uint64_t id;
     uint32_t sizeDataType;
     uint32_t rateInMsec;
+    bool isResponseExpected; // false for packets inside a master block (DOWNLOAD_NEXT), only the last one is answered
+    uint32_t signalId; // signal of an upload, see SignalRegistry
 };
 
 #endif // COMMANDPAYLOAD_H
@@ -9,9 +9,11 @@
 #include "daqList.h"
 
 
-DaqList::DaqList(const uint16_t eventChannelNr)
+DaqList::DaqList(const uint16_t eventChannelNr, const Direction direction)
     : eventChannel(eventChannelNr),
-      daqListNr(0) {
+      daqListNr(0),
+      direction(direction),
+      prescaler(1) {
 
 }
 
@@ -43,3 +45,18 @@ void DaqList::addToOdtEntries(const std::shared_ptr<RecordElement> recordElement
     odtEntries.append(recordElement);
 }
 
+DaqList::Direction DaqList::getDirection() const {
+    return direction;
+}
+
+void DaqList::setDirection(const Direction &value) {
+    direction = value;
+}
+
+uint8_t DaqList::getPrescaler() const {
+    return prescaler;
+}
+
+void DaqList::setPrescaler(const uint8_t &value) {
+    prescaler = value;
+}
@@ -15,7 +15,9 @@
 
 class DaqList {
   public:
-    DaqList(const uint16_t eventChannelNr);
+    enum class Direction {Daq, Stim};
+
+    DaqList(const uint16_t eventChannelNr, const Direction direction = Direction::Daq);
 
     uint16_t getEventChannel() const;
     void setEventChannel(const uint16_t &value);
@@ -27,9 +29,17 @@ class DaqList {
     void setOdtEntries(const QList<std::shared_ptr<RecordElement>>& recordElementList);
     void addToOdtEntries(const std::shared_ptr<RecordElement> recordElement);
 
+    Direction getDirection() const;
+    void setDirection(const Direction &value);
+
+    uint8_t getPrescaler() const;
+    void setPrescaler(const uint8_t &value);
+
   private:
     uint16_t eventChannel;
     uint16_t daqListNr;
+    Direction direction; // Daq: slave to master, Stim: master to slave
+    uint8_t prescaler; // transmission rate prescaler, 1: every cycle of the event
     QList<std::shared_ptr<RecordElement>> odtEntries;
 };
 
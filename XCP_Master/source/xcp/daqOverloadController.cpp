@@ -0,0 +1,92 @@
+/**
+*@file daqOverloadController.cpp
+*@author Michael Wolf
+*@date 19.10.2026
+*@brief Counts DAQ overloads per DAQ list and adapts the transmission rate prescalers: a list which overloads is slowed down, a list which stays quiet is restored step by step.
+*/
+
+#include "daqOverloadController.h"
+
+#include <algorithm>
+
+DaqOverloadController::DaqOverloadController(const uint8_t prescalerMax, const int quietWindowsToRestore)
+    : prescalerMax(prescalerMax),
+      quietWindowsToRestore(quietWindowsToRestore) {
+
+}
+
+void DaqOverloadController::clear() {
+    daqLists.clear();
+}
+
+void DaqOverloadController::addDaqList(const uint16_t daqListNr, const uint8_t prescaler) {
+    DaqListState state;
+    state.prescalerOriginal = prescaler;
+    state.prescaler = prescaler;
+    state.overloadCount = 0;
+    state.overloadsInWindow = 0;
+    state.quietWindows = 0;
+    daqLists[daqListNr] = state;
+}
+
+void DaqOverloadController::setPrescaler(const uint16_t daqListNr, const uint8_t prescaler) {
+    auto it = daqLists.find(daqListNr);
+    if(it == daqLists.end()) {
+        return;
+    }
+    it->second.prescaler = std::max(prescaler, it->second.prescalerOriginal);
+}
+
+void DaqOverloadController::overloadDetected(const uint16_t daqListNr) {
+    auto it = daqLists.find(daqListNr);
+    if(it == daqLists.end()) {
+        return;
+    }
+    it->second.overloadCount++;
+    it->second.overloadsInWindow++;
+}
+
+void DaqOverloadController::overloadDetectedAll() {
+    for(auto& daqList : daqLists) {
+        daqList.second.overloadCount++;
+        daqList.second.overloadsInWindow++;
+    }
+}
+
+std::vector<DaqOverloadController::Evaluation> DaqOverloadController::evaluate(const bool isAdaptionEnabled) {
+    std::vector<Evaluation> evaluations;
+    for(auto& daqList : daqLists) {
+        DaqListState& state = daqList.second;
+        bool isPrescalerChanged = false;
+        if(state.overloadsInWindow > 0) {
+            state.quietWindows = 0;
+            if(isAdaptionEnabled && state.prescaler < prescalerMax) {
+                state.prescaler = (uint8_t) std::min<int>(prescalerMax, state.prescaler * 2);
+                isPrescalerChanged = true;
+            }
+        } else if(state.prescaler > state.prescalerOriginal) {
+            state.quietWindows++;
+            if(isAdaptionEnabled && state.quietWindows >= quietWindowsToRestore) {
+                state.prescaler = (uint8_t) std::max<int>(state.prescalerOriginal, state.prescaler / 2);
+                state.quietWindows = 0;
+                isPrescalerChanged = true;
+            }
+        }
+
+        if(state.overloadsInWindow > 0 || isPrescalerChanged) {
+            evaluations.push_back({daqList.first, state.overloadsInWindow, state.overloadCount, state.prescaler, isPrescalerChanged});
+        }
+        state.overloadsInWindow = 0;
+    }
+    return evaluations;
+}
+
+uint32_t DaqOverloadController::getOverloadCount(const uint16_t daqListNr) const {
+    auto it = daqLists.find(daqListNr);
+    return (it == daqLists.end()) ? 0 : it->second.overloadCount;
+}
+
+uint8_t DaqOverloadController::getPrescaler(const uint16_t daqListNr) const {
+    auto it = daqLists.find(daqListNr);
+    return (it == daqLists.end()) ? 1 : it->second.prescaler;
+}
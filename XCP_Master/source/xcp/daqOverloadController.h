@@ -0,0 +1,65 @@
+/**
+*@file daqOverloadController.h
+*@author Michael Wolf
+*@date 19.10.2026
+*@brief Counts DAQ overloads per DAQ list and adapts the transmission rate prescalers: a list which overloads is slowed down, a list which stays quiet is restored step by step.
+*/
+
+#ifndef DAQOVERLOADCONTROLLER_H
+#define DAQOVERLOADCONTROLLER_H
+
+#include <map>
+#include <vector>
+#include <stdint.h>
+
+class DaqOverloadController {
+  public:
+    struct Evaluation {
+        uint16_t daqListNr;
+        uint32_t overloadsInWindow;
+        uint32_t overloadCount;
+        uint8_t prescaler;
+        bool isPrescalerChanged;
+    };
+
+    DaqOverloadController(const uint8_t prescalerMax = 16, const int quietWindowsToRestore = 5);
+
+    void clear();
+    void addDaqList(const uint16_t daqListNr, const uint8_t prescaler = 1);
+    /**
+     * @brief setPrescaler sets the prescaler the slave runs the list with, e.g. after the slave accepted or rejected a change.
+     */
+    void setPrescaler(const uint16_t daqListNr, const uint8_t prescaler);
+
+    void overloadDetected(const uint16_t daqListNr);
+    /**
+     * @brief overloadDetectedAll is used for EV_DAQ_OVERLOAD, the event does not tell which list is affected.
+     */
+    void overloadDetectedAll();
+
+    /**
+     * @brief evaluate closes the current observation window.
+     * @param isAdaptionEnabled if true the prescaler of an overloaded list is doubled (up to prescalerMax),
+     * the prescaler of a list without overload for quietWindowsToRestore windows is halved (down to the original prescaler).
+     * @return lists with overloads in the window or with a changed prescaler.
+     */
+    std::vector<Evaluation> evaluate(const bool isAdaptionEnabled);
+
+    uint32_t getOverloadCount(const uint16_t daqListNr) const;
+    uint8_t getPrescaler(const uint16_t daqListNr) const;
+
+  private:
+    struct DaqListState {
+        uint8_t prescalerOriginal;
+        uint8_t prescaler;
+        uint32_t overloadCount;
+        uint32_t overloadsInWindow;
+        int quietWindows;
+    };
+
+    uint8_t prescalerMax;
+    int quietWindowsToRestore;
+    std::map<uint16_t, DaqListState> daqLists; // key: DAQ list number
+};
+
+#endif // DAQOVERLOADCONTROLLER_H
@@ -0,0 +1,57 @@
+/**
+*@file downloadPlanner.cpp
+*@author Michael Wolf
+*@date 19.10.2026
+*@brief Prepares a set of memory writes for a bulk download: sorts the writes by address and merges adjacent and overlapping writes to contiguous ranges.
+*/
+
+#include "downloadPlanner.h"
+
+#include <algorithm>
+
+std::vector<DownloadRange> DownloadPlanner::mergeRanges(const std::vector<DownloadRange>& writes) {
+    std::vector<size_t> order(writes.size());
+    for(size_t i = 0; i < order.size(); i++) {
+        order[i] = i;
+    }
+    std::stable_sort(order.begin(), order.end(), [&writes](size_t a, size_t b) {
+        return writes[a].addr < writes[b].addr;
+    });
+
+    // 1. union of all address intervals
+    struct Interval {
+        uint32_t addr;
+        uint64_t end;
+    };
+    std::vector<Interval> intervals;
+    for(size_t index : order) {
+        const DownloadRange& write = writes[index];
+        if(write.data.empty()) {
+            continue;
+        }
+        if(!intervals.empty() && write.addr <= intervals.back().end) {
+            intervals.back().end = std::max(intervals.back().end, write.getEnd());
+        } else {
+            intervals.push_back({write.addr, write.getEnd()});
+        }
+    }
+
+    std::vector<DownloadRange> ranges(intervals.size());
+    for(size_t i = 0; i < intervals.size(); i++) {
+        ranges[i].addr = intervals[i].addr;
+        ranges[i].data.resize(intervals[i].end - intervals[i].addr);
+    }
+
+    // 2. copy the writes in input order, so later writes overwrite earlier ones
+    for(const DownloadRange& write : writes) {
+        if(write.data.empty()) {
+            continue;
+        }
+        auto it = std::upper_bound(ranges.begin(), ranges.end(), write.addr, [](uint32_t addr, const DownloadRange& range) {
+            return addr < range.addr;
+        });
+        DownloadRange& range = *(--it);
+        std::copy(write.data.begin(), write.data.end(), range.data.begin() + (write.addr - range.addr));
+    }
+    return ranges;
+}
@@ -0,0 +1,36 @@
+/**
+*@file downloadPlanner.h
+*@author Michael Wolf
+*@date 19.10.2026
+*@brief Prepares a set of memory writes for a bulk download: sorts the writes by address and merges adjacent and overlapping writes to contiguous ranges.
+*/
+
+#ifndef DOWNLOADPLANNER_H
+#define DOWNLOADPLANNER_H
+
+#include <vector>
+#include <stdint.h>
+
+struct DownloadRange {
+    uint32_t addr;
+    std::vector<uint8_t> data;
+
+    uint64_t getEnd() const {
+        return (uint64_t) addr + data.size();
+    }
+};
+
+class DownloadPlanner {
+  public:
+
+    DownloadPlanner() = delete;
+
+    /**
+     * @brief mergeRanges sorts the writes by address and merges writes which touch or overlap.
+     * If writes overlap, the write which comes later in the input wins.
+     * @return non overlapping ranges, sorted by address.
+     */
+    static std::vector<DownloadRange> mergeRanges(const std::vector<DownloadRange>& writes);
+};
+
+#endif // DOWNLOADPLANNER_H
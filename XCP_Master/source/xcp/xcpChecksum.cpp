@@ -0,0 +1,204 @@
+/**
+*@file xcpChecksum.cpp
+*@author Michael Wolf
+*@date 19.10.2026
+*@brief Local calculation of the XCP BUILD_CHECKSUM algorithms, used to verify the slave memory against the ELF image.
+*/
+
+#include "xcpChecksum.h"
+#include "xcpprotocoldefinitions.h"
+
+#include <array>
+
+/**************************************************************
+ *  Lookup tables
+ **************************************************************/
+namespace {
+
+const uint16_t CRC16_POLY_REFLECTED = 0xA001; // CRC-16/ARC, poly 0x8005 reflected
+const uint16_t CRC16_CCITT_POLY = 0x1021;
+const uint16_t CRC16_CCITT_INIT = 0xFFFF;
+const uint32_t CRC32_POLY_REFLECTED = 0xEDB88320;
+const uint32_t CRC32_INIT = 0xFFFFFFFF;
+
+const int CRC32_SLICES = 8;
+
+typedef std::array<uint16_t, 256> Crc16Table;
+typedef std::array<std::array<uint32_t, 256>, CRC32_SLICES> Crc32Tables;
+
+const Crc16Table& crc16Table() {
+    static const Crc16Table table = [] {
+        Crc16Table t;
+        for(uint32_t i = 0; i < 256; i++) {
+            uint16_t crc = i;
+            for(int bit = 0; bit < 8; bit++) {
+                crc = (crc & 1) ? (crc >> 1) ^ CRC16_POLY_REFLECTED : (crc >> 1);
+            }
+            t[i] = crc;
+        }
+        return t;
+    }();
+    return table;
+}
+
+const Crc16Table& crc16CcittTable() {
+    static const Crc16Table table = [] {
+        Crc16Table t;
+        for(uint32_t i = 0; i < 256; i++) {
+            uint16_t crc = i << 8;
+            for(int bit = 0; bit < 8; bit++) {
+                crc = (crc & 0x8000) ? (crc << 1) ^ CRC16_CCITT_POLY : (crc << 1);
+            }
+            t[i] = crc;
+        }
+        return t;
+    }();
+    return table;
+}
+
+/**
+ * Slicing-by-8: table[k][i] is the CRC of byte i followed by k zero bytes,
+ * so 8 input bytes are folded with 8 independent lookups per iteration.
+ */
+const Crc32Tables& crc32Tables() {
+    static const Crc32Tables tables = [] {
+        Crc32Tables t;
+        for(uint32_t i = 0; i < 256; i++) {
+            uint32_t crc = i;
+            for(int bit = 0; bit < 8; bit++) {
+                crc = (crc & 1) ? (crc >> 1) ^ CRC32_POLY_REFLECTED : (crc >> 1);
+            }
+            t[0][i] = crc;
+        }
+        for(uint32_t i = 0; i < 256; i++) {
+            for(int slice = 1; slice < CRC32_SLICES; slice++) {
+                uint32_t prev = t[slice - 1][i];
+                t[slice][i] = (prev >> 8) ^ t[0][prev & 0xFF];
+            }
+        }
+        return t;
+    }();
+    return tables;
+}
+
+}
+
+/**************************************************************
+ *  Checksum
+ **************************************************************/
+bool XcpChecksum::calculate(const uint8_t checksumType, const uint8_t* data, const size_t size, const bool isLittleEndian, uint32_t& checksum) {
+    switch (checksumType) {
+    case XCP_CHECKSUM_TYPE::XCP_ADD_11:
+        checksum = addBytes(data, size) & 0xFF;
+        return true;
+    case XCP_CHECKSUM_TYPE::XCP_ADD_12:
+        checksum = addBytes(data, size) & 0xFFFF;
+        return true;
+    case XCP_CHECKSUM_TYPE::XCP_ADD_14:
+        checksum = addBytes(data, size);
+        return true;
+    case XCP_CHECKSUM_TYPE::XCP_ADD_22:
+        if(size % 2 != 0) {
+            return false;
+        }
+        checksum = addWords(data, size, isLittleEndian) & 0xFFFF;
+        return true;
+    case XCP_CHECKSUM_TYPE::XCP_ADD_24:
+        if(size % 2 != 0) {
+            return false;
+        }
+        checksum = addWords(data, size, isLittleEndian);
+        return true;
+    case XCP_CHECKSUM_TYPE::XCP_ADD_44:
+        if(size % 4 != 0) {
+            return false;
+        }
+        checksum = addDwords(data, size, isLittleEndian);
+        return true;
+    case XCP_CHECKSUM_TYPE::XCP_CRC_16:
+        checksum = crc16(data, size);
+        return true;
+    case XCP_CHECKSUM_TYPE::XCP_CRC_16_CITT:
+        checksum = crc16Ccitt(data, size);
+        return true;
+    case XCP_CHECKSUM_TYPE::XCP_CRC_32:
+        checksum = crc32(data, size);
+        return true;
+    default:
+        return false;
+    }
+}
+
+uint16_t XcpChecksum::crc16(const uint8_t* data, const size_t size) {
+    const Crc16Table& table = crc16Table();
+    uint16_t crc = 0;
+    for(size_t i = 0; i < size; i++) {
+        crc = (crc >> 8) ^ table[(crc ^ data[i]) & 0xFF];
+    }
+    return crc;
+}
+
+uint16_t XcpChecksum::crc16Ccitt(const uint8_t* data, const size_t size) {
+    const Crc16Table& table = crc16CcittTable();
+    uint16_t crc = CRC16_CCITT_INIT;
+    for(size_t i = 0; i < size; i++) {
+        crc = (crc << 8) ^ table[((crc >> 8) ^ data[i]) & 0xFF];
+    }
+    return crc;
+}
+
+uint32_t XcpChecksum::crc32(const uint8_t* data, const size_t size) {
+    const Crc32Tables& t = crc32Tables();
+    uint32_t crc = CRC32_INIT;
+    size_t i = 0;
+    for(; i + CRC32_SLICES <= size; i += CRC32_SLICES) {
+        uint32_t low = crc ^ (static_cast<uint32_t>(data[i])
+                              | static_cast<uint32_t>(data[i + 1]) << 8
+                              | static_cast<uint32_t>(data[i + 2]) << 16
+                              | static_cast<uint32_t>(data[i + 3]) << 24);
+        crc = t[7][low & 0xFF] ^ t[6][(low >> 8) & 0xFF] ^ t[5][(low >> 16) & 0xFF] ^ t[4][low >> 24]
+              ^ t[3][data[i + 4]] ^ t[2][data[i + 5]] ^ t[1][data[i + 6]] ^ t[0][data[i + 7]];
+    }
+    for(; i < size; i++) {
+        crc = (crc >> 8) ^ t[0][(crc ^ data[i]) & 0xFF];
+    }
+    return crc ^ CRC32_INIT;
+}
+
+/**************************************************************
+ *  Additive checksums (plain loops, vectorized by the compiler)
+ **************************************************************/
+uint32_t XcpChecksum::addBytes(const uint8_t* data, const size_t size) {
+    uint32_t sum = 0;
+    for(size_t i = 0; i < size; i++) {
+        sum += data[i];
+    }
+    return sum;
+}
+
+uint32_t XcpChecksum::addWords(const uint8_t* data, const size_t size, const bool isLittleEndian) {
+    uint32_t sumLow = 0;
+    uint32_t sumHigh = 0;
+    for(size_t i = 0; i < size; i += 2) {
+        sumLow += data[i];
+        sumHigh += data[i + 1];
+    }
+    // sum of words == sum of low bytes + 256 * sum of high bytes (mod 2^32)
+    return isLittleEndian ? sumLow + (sumHigh << 8) : sumHigh + (sumLow << 8);
+}
+
+uint32_t XcpChecksum::addDwords(const uint8_t* data, const size_t size, const bool isLittleEndian) {
+    uint32_t sum = 0;
+    for(size_t i = 0; i < size; i += 4) {
+        uint32_t dword;
+        if(isLittleEndian) {
+            dword = static_cast<uint32_t>(data[i]) | static_cast<uint32_t>(data[i + 1]) << 8
+                    | static_cast<uint32_t>(data[i + 2]) << 16 | static_cast<uint32_t>(data[i + 3]) << 24;
+        } else {
+            dword = static_cast<uint32_t>(data[i + 3]) | static_cast<uint32_t>(data[i + 2]) << 8
+                    | static_cast<uint32_t>(data[i + 1]) << 16 | static_cast<uint32_t>(data[i]) << 24;
+        }
+        sum += dword;
+    }
+    return sum;
+}
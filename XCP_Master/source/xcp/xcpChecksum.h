@@ -0,0 +1,37 @@
+/**
+*@file xcpChecksum.h
+*@author Michael Wolf
+*@date 19.10.2026
+*@brief Local calculation of the XCP BUILD_CHECKSUM algorithms, used to verify the slave memory against the ELF image.
+*/
+
+#ifndef XCPCHECKSUM_H
+#define XCPCHECKSUM_H
+
+#include <stdint.h>
+#include <stddef.h>
+
+class XcpChecksum {
+  public:
+
+    XcpChecksum() = delete;
+
+    /**
+     * @brief calculate computes the checksum of the given memory block the same way the slave does it.
+     * @param checksumType XCP_CHECKSUM_TYPE as reported in the BUILD_CHECKSUM response.
+     * @param isLittleEndian byte order of the slave, used to combine WORD and DWORD elements (ADD_2x, ADD_44).
+     * @return false if the checksum type is unknown, user defined or the block size does not match the element size.
+     */
+    static bool calculate(const uint8_t checksumType, const uint8_t* data, const size_t size, const bool isLittleEndian, uint32_t& checksum);
+
+    static uint16_t crc16(const uint8_t* data, const size_t size);
+    static uint16_t crc16Ccitt(const uint8_t* data, const size_t size);
+    static uint32_t crc32(const uint8_t* data, const size_t size);
+
+  private:
+    static uint32_t addBytes(const uint8_t* data, const size_t size);
+    static uint32_t addWords(const uint8_t* data, const size_t size, const bool isLittleEndian);
+    static uint32_t addDwords(const uint8_t* data, const size_t size, const bool isLittleEndian);
+};
+
+#endif // XCPCHECKSUM_H
@@ -49,6 +49,45 @@ const uint8_t ERR_VERIFY                            = 0x32;
 const uint8_t ERR_RESOURCE_TEMPORARY_NOT_ACCESSIBLE = 0x33;
 const uint8_t ERR_SUBCMD_UNKNOWN                    = 0x34;
 }
+
+/******************************************************
+* Event codes (EV)
+*******************************************************/
+namespace XCP_EVENT {
+const uint8_t SLAVE_EVENT_CODE =            1;
+
+const uint8_t EV_RESUME_MODE =              0x00;
+const uint8_t EV_CLEAR_DAQ =                0x01;
+const uint8_t EV_STORE_DAQ =                0x02;
+const uint8_t EV_STORE_CAL =                0x03;
+const uint8_t EV_CMD_PENDING =              0x05;
+const uint8_t EV_DAQ_OVERLOAD =             0x06;
+const uint8_t EV_SESSION_TERMINATED =       0x07;
+const uint8_t EV_TIME_SYNC =                0x08;
+const uint8_t EV_STIM_TIMEOUT =             0x09;
+const uint8_t EV_SLEEP =                    0x0A;
+const uint8_t EV_WAKE_UP =                  0x0B;
+const uint8_t EV_USER =                     0xFE;
+const uint8_t EV_TRANSPORT =                0xFF;
+}
+
+/******************************************************
+* Service request codes (SERV)
+*******************************************************/
+namespace XCP_SERVICE_REQUEST {
+const uint8_t SLAVE_SERVICE_REQUEST_CODE =  1;
+const uint8_t SLAVE_TEXT =                  2;
+
+const uint8_t SERV_RESET =                  0x00;
+const uint8_t SERV_TEXT =                   0x01;
+}
+
+/******************************************************
+* DAQ data transfer object (DTO)
+*******************************************************/
+namespace XCP_DAQ_DTO {
+const uint8_t PID_OVERLOAD_INDICATION =     0x80;   /* MSB of the PID, set by the slave after an overload */
+}
 /******************************************************
 * Commands CTO
 *******************************************************/
@@ -57,11 +96,20 @@ const uint8_t CONNECT =                 0xFF;
 const uint8_t DISCONNECT =              0xFE;
 const uint8_t GET_STATUS =              0xFD;
 const uint8_t GET_SYNC =                0xFC;
+const uint8_t GET_COMM_MODE_INFO =      0xFB;
 const uint8_t SHORT_UPLOAD =            0xF4;
+const uint8_t UPLOAD =                  0xF5;
 const uint8_t SET_MTA =                 0xF6;
 const uint8_t DOWNLOAD =                0xF0;
+const uint8_t DOWNLOAD_NEXT =           0xEF;
+const uint8_t DOWNLOAD_MAX =            0xEE;
 const uint8_t BUILD_CHECKSUM =          0xF3;
+//calibration page switching
+const uint8_t SET_CAL_PAGE =            0xEB;
+const uint8_t GET_CAL_PAGE =            0xEA;
+const uint8_t COPY_CAL_PAGE =           0xE4;
 //DAQ
+const uint8_t GET_DAQ_PROCESSOR_INFO =  0xDA;
 const uint8_t FREE_DAQ =                0xD6;
 const uint8_t ALLOC_DAQ =               0xD5;
 const uint8_t ALLOC_ODT =               0xD4;
@@ -129,6 +177,22 @@ const uint8_t SLAVE_RESOURCE_PROTECT_STATUS_STIM    = 3;
 const uint8_t SLAVE_RESOURCE_PROTECT_STATUS_PGM     = 4;
 }
 /******************************************************
+* GET COMMUNICATION MODE INFO
+*******************************************************/
+namespace XCP_GET_COMM_MODE_INFO {
+const uint8_t MASTER_LENGTH =                  1;
+
+const uint8_t SLAVE_LENGTH =                   8;
+const uint8_t SLAVE_COMM_MODE_OPTIONAL =       2;
+const uint8_t SLAVE_MAX_BS =                   4;
+const uint8_t SLAVE_MIN_ST =                   5;
+const uint8_t SLAVE_QUEUE_SIZE =               6;
+const uint8_t SLAVE_DRIVER_VERSION =           7;
+
+const uint8_t SLAVE_COMM_MODE_OPTIONAL_MASTER_BLOCK_MODE = 0;
+const uint8_t SLAVE_COMM_MODE_OPTIONAL_INTERLEAVED_MODE =  1;
+}
+/******************************************************
 * SYNCHRONIZE COMMAND EXECUTION AFTER TIMEOUT
 *******************************************************/
 namespace XCP_SYNCH {
@@ -153,6 +217,16 @@ const uint8_t MASTER_ADDR_3 =             7;
 const uint8_t SLAVE_BYTE_ALIGNMENT_ELEMENT_1 = 1;
 }
 /******************************************************
+* UPLOAD FROM SLAVE TO MASTER
+*******************************************************/
+namespace XCP_UPLOAD {
+const uint8_t MASTER_LENGTH =             2;
+const uint8_t MASTER_ELEMENTS =           1;
+
+const uint8_t SLAVE_BYTE_ALIGNMENT_ELEMENT_1 = 1;
+const uint8_t MAX_ELEMENTS =              255;
+}
+/******************************************************
 * SET MEMORY TRANSFER ADDRESS IN SLAVE
 *******************************************************/
 namespace XCP_SET_MTA {
@@ -171,6 +245,20 @@ const uint8_t MASTER_ADDR_3 =             7;
 namespace XCP_DOWNLOAD {
 const uint8_t MASTER_ELEMENTS =                 1;
 const uint8_t MASTER_BYTE_ALIGNMENT_ELEMENT_1 = 2;
+const uint8_t MASTER_MAX_ELEMENTS =             255;
+}
+/******************************************************
+* DOWNLOAD FROM MASTER TO SLAVE (BLOCK MODE)
+*******************************************************/
+namespace XCP_DOWNLOAD_NEXT {
+const uint8_t MASTER_REMAINING_ELEMENTS =       1;
+const uint8_t MASTER_BYTE_ALIGNMENT_ELEMENT_1 = 2;
+}
+/******************************************************
+* DOWNLOAD FROM MASTER TO SLAVE (FIXED SIZE)
+*******************************************************/
+namespace XCP_DOWNLOAD_MAX {
+const uint8_t MASTER_BYTE_ALIGNMENT_ELEMENT_1 = 1;
 }
 /******************************************************
 *  BUILD CHECKSUM OVER MEMORY RANGE
@@ -195,6 +283,74 @@ const uint8_t SLAVE_CHECKSUM_2 =          6;
 const uint8_t SLAVE_CHECKSUM_3 =          7;
 }
 /******************************************************
+*  CHECKSUM TYPES (BUILD_CHECKSUM RESPONSE)
+*******************************************************/
+namespace XCP_CHECKSUM_TYPE {
+const uint8_t XCP_ADD_11 =                0x01;   /* add BYTE into a BYTE checksum, ignore overflows */
+const uint8_t XCP_ADD_12 =                0x02;   /* add BYTE into a WORD checksum, ignore overflows */
+const uint8_t XCP_ADD_14 =                0x03;   /* add BYTE into a DWORD checksum, ignore overflows */
+const uint8_t XCP_ADD_22 =                0x04;   /* add WORD into a WORD checksum, ignore overflows */
+const uint8_t XCP_ADD_24 =                0x05;   /* add WORD into a DWORD checksum, ignore overflows */
+const uint8_t XCP_ADD_44 =                0x06;   /* add DWORD into DWORD, ignore overflows */
+const uint8_t XCP_CRC_16 =                0x07;   /* CRC-16 (ARC) */
+const uint8_t XCP_CRC_16_CITT =           0x08;   /* CRC-16 (CCITT) */
+const uint8_t XCP_CRC_32 =                0x09;   /* CRC-32 */
+const uint8_t XCP_USER_DEFINED =          0xFF;   /* user defined algorithm, in external DLL */
+}
+/******************************************************
+* SET CALIBRATION PAGE
+*******************************************************/
+namespace XCP_SET_CAL_PAGE {
+const uint8_t MASTER_LENGTH =             4;
+const uint8_t MASTER_MODE =               1;
+const uint8_t MASTER_SEGMENT =            2;
+const uint8_t MASTER_PAGE =               3;
+
+const uint8_t MODE_ECU =                  0x01;   /* page used by the slave's application */
+const uint8_t MODE_XCP =                  0x02;   /* page accessed by XCP (DOWNLOAD / UPLOAD) */
+const uint8_t MODE_ALL =                  0x80;   /* apply to all segments, segment number is ignored */
+}
+/******************************************************
+* GET CALIBRATION PAGE
+*******************************************************/
+namespace XCP_GET_CAL_PAGE {
+const uint8_t MASTER_LENGTH =             3;
+const uint8_t MASTER_MODE =               1;
+const uint8_t MASTER_SEGMENT =            2;
+
+const uint8_t SLAVE_LENGTH =              4;
+const uint8_t SLAVE_PAGE =                3;
+}
+/******************************************************
+* COPY PAGE
+*******************************************************/
+namespace XCP_COPY_CAL_PAGE {
+const uint8_t MASTER_LENGTH =             5;
+const uint8_t MASTER_SRC_SEGMENT =        1;
+const uint8_t MASTER_SRC_PAGE =           2;
+const uint8_t MASTER_DEST_SEGMENT =       3;
+const uint8_t MASTER_DEST_PAGE =          4;
+}
+/******************************************************
+* GET GENERAL INFORMATION ON DAQ PROCESSOR
+*******************************************************/
+namespace XCP_GET_DAQ_PROCESSOR_INFO {
+const uint8_t MASTER_LENGTH =                   1;
+
+const uint8_t SLAVE_LENGTH =                    8;
+const uint8_t SLAVE_DAQ_PROPERTIES =            1;
+const uint8_t SLAVE_MAX_DAQ_0 =                 2;
+const uint8_t SLAVE_MAX_DAQ_1 =                 3;
+const uint8_t SLAVE_MAX_EVENT_CHANNEL_0 =       4;
+const uint8_t SLAVE_MAX_EVENT_CHANNEL_1 =       5;
+const uint8_t SLAVE_MIN_DAQ =                   6;
+const uint8_t SLAVE_DAQ_KEY_BYTE =              7;
+
+const uint8_t SLAVE_DAQ_PROPERTIES_PRESCALER_SUPPORTED =    1;
+const uint8_t SLAVE_DAQ_PROPERTIES_OVERLOAD_MSB =           6;
+const uint8_t SLAVE_DAQ_PROPERTIES_OVERLOAD_EVENT =         7;
+}
+/******************************************************
 * CLEAR DYNAMIC DAQ CONFIGURATION
 *******************************************************/
 namespace XCP_FREE_DAQ {
@@ -285,6 +441,9 @@ const uint8_t MASTER_LENGTH =               4;
 const uint8_t MASTER_MODE =                 1;
 const uint8_t MASTER_DAQ_LIST_NR_0 =        2;
 const uint8_t MASTER_DAQ_LIST_NR_1 =        3;
+const uint8_t MODE_STOP =                   0x00;
+const uint8_t MODE_START =                  0x01;
+const uint8_t MODE_SELECT =                 0x02;
 
 const uint8_t SLAVE_LENGTH =                2;
 const uint8_t SLAVE_FIRST_PID =             1;
@@ -295,6 +454,9 @@ const uint8_t SLAVE_FIRST_PID =             1;
 namespace XCP_START_STOP_SYNCH {
 const uint8_t MASTER_LENGTH =               2;
 const uint8_t MASTER_MODE =                 1;
+const uint8_t MODE_STOP_ALL =               0x00;
+const uint8_t MODE_START_SELECTED =         0x01;
+const uint8_t MODE_STOP_SELECTED =          0x02;
 }
 
 
@@ -7,10 +7,15 @@
 
 #include "xcptask.h"
 #include "xcpConfig/ethernetconfig.h"
+#include "xcpChecksum.h"
+#include "parser/elfParser.h"
 
 #include <QBitArray>
 #include <iostream>
 #include <stdexcept>
+#include <algorithm>
+#include <cstring>
+#include <cmath>
 
 
 XcpTask::XcpTask(QSharedPointer<Model> &model, QObject *parent)
@@ -21,10 +26,16 @@ XcpTask::XcpTask(QSharedPointer<Model> &model, QObject *parent)
       timerPollingList(QMap<uint64_t, QSharedPointer<QTimer>>()),
       commandQueue(QQueue<CommandPayload>()),
       pollingList(std::map<uint64_t, CommandPayload>()),
-      isChecksumValid(false) {
+      isChecksumValid(false),
+      checksumBlockSizeMax(MAX_CHECKSUM_BLOCKSIZE),
+      isChecksumReadback(false),
+      isCalPageSwitchActive(false),
+      uploadBytesReceived(0) {
 
     createTimerResponseTimeout();
     createTimerTriggerSendNextCommandInQueue();
+    createTimerOverloadEvaluation();
+    createTimerMinSt();
 
     //Signal xcpTask to slot udpXcp
 
@@ -44,6 +55,7 @@ void XcpTask::slotConnect() {
             case EthernetConfig::PROTOCOL_UDP: {
                 ret = udpXcp.initSocket(*model->getEthernetConfig(), model->getXcpHostConfig()->getEndian());
                 clearCommandQueue();
+                calibrationMirror.clear();
                 CommandPayload cmdPayload = payloadConnect();
                 addToCommandQueue(cmdPayload);
                 isSendingPossible = true;
@@ -77,6 +89,7 @@ void XcpTask::slotDisconnect() {
             switch (model->getEthernetConfig()->getProtocol()) {
             case EthernetConfig::PROTOCOL_UDP: {
                 timerPollingList.clear();
+                timerStimList.clear();
                 eventDaqList.clear();
                 clearCommandQueue();
                 CommandPayload cmdPayload = payloadDisconnect();
@@ -110,11 +123,12 @@ void XcpTask::slotRecordStart() {
             switch (model->getEthernetConfig()->getProtocol()) {
             case EthernetConfig::PROTOCOL_UDP: {
                 for(const auto& cmdPayload: pollingList) {
-                    startTimerAddQueuePollingCommand(cmdPayload.second.getId(), cmdPayload.second.getRateInMsec());
+                    startTimerAddQueuePollingCommand(cmdPayload.first, cmdPayload.second.getRateInMsec());
                 }
                 daqDynamicConfig();
                 setStateAndInformBackend(State::Run);
                 timerTriggerSendNextCommandInQueue->start();
+                timerOverloadEvaluation->start();
                 break;
             }
             case EthernetConfig::PROTOCOL_TCP:
@@ -136,7 +150,9 @@ void XcpTask::slotRecordStart() {
 void XcpTask::slotRecordStop() {
     timerResponseTimeout->stop();
     timerTriggerSendNextCommandInQueue->stop();
+    timerOverloadEvaluation->stop();
     timerPollingList.clear();
+    timerStimList.clear();
     clearCommandQueue();
     daqStopAll();
     timerResponseTimeout->stop();
@@ -177,11 +193,28 @@ CommandPayload XcpTask::payloadGetStatus() {
     return CommandPayload(payload, command);
 }
 
+CommandPayload XcpTask::payloadGetCommModeInfo() {
+    static const uint8_t command = XCP_CMD::GET_COMM_MODE_INFO;
+    QByteArray payload;
+    payload.insert(XCP_PID, command);
+    printMsgDebug("CMD", "GET_COMM_MODE_INFO", payload);
+    return CommandPayload(payload, command);
+}
+
+CommandPayload XcpTask::payloadGetDaqProcessorInfo() {
+    static const uint8_t command = XCP_CMD::GET_DAQ_PROCESSOR_INFO;
+    QByteArray payload;
+    payload.insert(XCP_PID, command);
+    printMsgDebug("CMD", "GET_DAQ_PROCESSOR_INFO", payload);
+    return CommandPayload(payload, command);
+}
+
 CommandPayload XcpTask::payloadShortUploadRecordElement(const std::shared_ptr<RecordElement> recordElement) {
     uint64_t addr = recordElement->getParseResult()->getAddress();
     uint8_t size = recordElement->getParseResult()->getSize();
     CommandPayload cmdPayload = payloadShortUpload((uint32_t) addr, size);
     cmdPayload.setRateInMsec(recordElement->getPollingRateInMs());
+    cmdPayload.setSignalId(recordElement->getSignalId());
     return cmdPayload;
 }
 
@@ -229,6 +262,16 @@ CommandPayload XcpTask::payloadSetMta(const uint32_t addr, const uint8_t addrExt
     return CommandPayload(payload, command, addr);
 }
 
+CommandPayload XcpTask::payloadUpload(const uint8_t dataElements, const uint32_t addr) {
+    static const uint8_t command = XCP_CMD::UPLOAD;
+    QByteArray payload;
+    payload.insert(XCP_PID, command);
+    payload.insert(XCP_UPLOAD::MASTER_ELEMENTS, dataElements);
+    printMsgDebug("CMD", "UPLOAD", payload);
+
+    return CommandPayload(payload, command, addr, dataElements); // addr is only used to store the result in the mirror
+}
+
 CommandPayload XcpTask::payloadDownload(const uint8_t dataElements, const uint32_t data, const bool isByteAligned) {
     if(!isByteAligned) {
         return CommandPayload();  // will be "empty" if not byte aligned.
@@ -254,7 +297,7 @@ CommandPayload XcpTask::payloadDownload(const uint8_t dataElements, const uint32
     return CommandPayload(payload, command);
 }
 
-CommandPayload XcpTask::payloadBuildChecksum(const uint32_t blockSize) {
+CommandPayload XcpTask::payloadBuildChecksum(const uint32_t blockSize, const uint32_t startAddr) {
     static const uint8_t command = XCP_CMD::BUILD_CHECKSUM;
 
     uint8_t byte0 =  blockSize & 0x000000FF;
@@ -273,6 +316,41 @@ CommandPayload XcpTask::payloadBuildChecksum(const uint32_t blockSize) {
     payload.insert(XCP_BUILD_CHECKSUM::MASTER_BLOCK_SIZE_3, byte3);
 
     printMsgDebug("CMD", "BUILD_CHECKSUM", payload);
+
+    return CommandPayload(payload, command, startAddr, blockSize);
+}
+
+CommandPayload XcpTask::payloadDownloadRecordElement(const std::shared_ptr<RecordElement> recordElement) {
+    return payloadDownload(recordElement->getParseResult()->getSize(), rawValueToSet(recordElement));
+}
+
+CommandPayload XcpTask::payloadDownloadBytes(const uint8_t dataElements, const QByteArray& data) {
+    static const uint8_t command = XCP_CMD::DOWNLOAD;
+    QByteArray payload;
+    payload.insert(XCP_PID, command);
+    payload.insert(XCP_DOWNLOAD::MASTER_ELEMENTS, dataElements);
+    payload.append(data);
+    printMsgDebug("CMD", "DOWNLOAD", payload);
+    return CommandPayload(payload, command);
+}
+
+CommandPayload XcpTask::payloadDownloadNext(const uint8_t remainingElements, const QByteArray& data) {
+    static const uint8_t command = XCP_CMD::DOWNLOAD_NEXT;
+    QByteArray payload;
+    payload.insert(XCP_PID, command);
+    payload.insert(XCP_DOWNLOAD_NEXT::MASTER_REMAINING_ELEMENTS, remainingElements);
+    payload.append(data);
+    printMsgDebug("CMD", "DOWNLOAD_NEXT", payload);
+    return CommandPayload(payload, command);
+}
+
+CommandPayload XcpTask::payloadDownloadMax(const QByteArray& data) {
+    static const uint8_t command = XCP_CMD::DOWNLOAD_MAX;
+    QByteArray payload;
+    payload.insert(XCP_PID, command);
+    payload.append(data);
+    printMsgDebug("CMD", "DOWNLOAD_MAX", payload);
+    return CommandPayload(payload, command);
 }
 
 void XcpTask::addRecordElementsToPollingOrEventDaqList() {
@@ -285,23 +363,26 @@ void XcpTask::addRecordElementsToPollingOrEventDaqList() {
             addRecordElementsToPollingList(recordElement);
         } else if(triggerMode == RecordElement::TriggerMode::Event ) {
             addRecordElementsToEventDaqList(recordElement);
+        } else if(triggerMode == RecordElement::TriggerMode::Stimulation) {
+            addRecordElementsToEventDaqList(recordElement, DaqList::Direction::Stim);
         }
     }
 }
 
 void XcpTask::addRecordElementsToPollingList(const std::shared_ptr<RecordElement> recordElement) {
-    uint64_t key = recordElement->getParseResult()->getAddress();
+    uint64_t key = recordElement->getSignalId();
     CommandPayload cmdPayload = payloadShortUploadRecordElement(recordElement);
     pollingList.insert(std::make_pair(key, cmdPayload));
 }
 
-void XcpTask::addRecordElementsToEventDaqList(const std::shared_ptr<RecordElement> recordElement) {
+void XcpTask::addRecordElementsToEventDaqList(const std::shared_ptr<RecordElement> recordElement, const DaqList::Direction direction) {
     uint16_t eventChannel = recordElement->getEvent().getChannel();
-    QMap<uint16_t, DaqList>::iterator it = eventDaqList.find(eventChannel);
+    uint32_t key = eventChannel | ((direction == DaqList::Direction::Stim ? 1u : 0u) << 16); // DAQ lists first, STIM lists afterwards
+    QMap<uint32_t, DaqList>::iterator it = eventDaqList.find(key);
     if(it == eventDaqList.end()) {
-        DaqList daq(eventChannel); //new daqList
+        DaqList daq(eventChannel, direction); //new daqList
         daq.addToOdtEntries(recordElement);
-        eventDaqList.insert(eventChannel, daq);
+        eventDaqList.insert(key, daq);
     } else {
         it->addToOdtEntries(recordElement); //add to existing daqList
     }
@@ -314,17 +395,288 @@ void XcpTask::updatePollingListValuesFromSlave() {
 }
 
 void XcpTask::requestChecksumFromSlave(const uint32_t startAddr, const uint32_t size) {
-    CommandPayload setMta = payloadSetMta(startAddr);
-    addToCommandQueue(setMta);
-    CommandPayload buildChecksum = payloadBuildChecksum(size);
-    addToCommandQueue(buildChecksum);
+    uint32_t blocks = 0;
+    QList<CommandPayload> commands = checksumBlockCommands(startAddr, size, blocks);
+    if(commands.isEmpty()) {
+        checksumSegmentVerified(startAddr, true); // nothing to compare
+        return;
+    }
+    for(const auto& cmdPayload : commands) {
+        addToCommandQueue(cmdPayload, false);
+    }
+    checksumBlocksPending[startAddr] += blocks;
 
     sendNextCommandInQueue();
 }
+
+/**
+ * One SET_MTA and BUILD_CHECKSUM per block, no block is larger than the slave accepts.
+ * Without BUILD_CHECKSUM in the slave the range is read back as one block.
+ */
+QList<CommandPayload> XcpTask::checksumBlockCommands(const uint32_t startAddr, const uint32_t size, uint32_t& blocks) {
+    if(isChecksumReadback) {
+        blocks = (size > 0) ? 1 : 0;
+        return checksumReadbackCommands(startAddr, size);
+    }
+    QList<CommandPayload> commands;
+    uint32_t offset = 0;
+    blocks = 0;
+    while(offset < size) {
+        uint32_t blockSize = std::min(size - offset, checksumBlockSizeMax);
+        commands.append(payloadSetMta(startAddr + offset));
+        commands.append(payloadBuildChecksum(blockSize, startAddr + offset));
+        offset += blockSize;
+        blocks++;
+    }
+    return commands;
+}
+
+QList<CommandPayload> XcpTask::checksumReadbackCommands(const uint32_t blockAddr, const uint32_t blockSize) {
+    if(blockSize == 0) {
+        return QList<CommandPayload>();
+    }
+    ChecksumReadback readback;
+    readback.size = blockSize;
+    readback.data.reserve(blockSize);
+    checksumReadbacks.insert(blockAddr, readback);
+    return uploadCommands(blockAddr, blockSize);
+}
+
+/**
+ * One SET_MTA followed by UPLOAD commands, in slave block mode up to 255 bytes per UPLOAD.
+ */
+QList<CommandPayload> XcpTask::uploadCommands(const uint32_t addr, const uint32_t size) {
+    const int maxCto = xcpClientConfig->getMaxCto();
+    const int elementsPerUpload = xcpClientConfig->getIsSupported().slaveBlockModeAvailable
+                                  ? XCP_UPLOAD::MAX_ELEMENTS : maxCto - XCP_UPLOAD::SLAVE_BYTE_ALIGNMENT_ELEMENT_1;
+    QList<CommandPayload> commands;
+    commands.append(payloadSetMta(addr));
+    uint32_t offset = 0;
+    while(offset < size) {
+        uint32_t elements = std::min<uint32_t>(size - offset, elementsPerUpload);
+        commands.append(payloadUpload(elements, addr + offset));
+        offset += elements;
+    }
+    return commands;
+}
+
+/**
+ * The block is requested again before any other queued command, either split to the current block size or as readback.
+ */
+void XcpTask::repeatChecksumBlock(const uint32_t blockAddr, const uint32_t blockSize, const bool isReadback) {
+    QMap<uint32_t, ElfMemorySegment>::iterator it = checksumSegmentOfBlock(blockAddr);
+    if(it == checksumSegments.end()) {
+        return; // the segment failed already, nothing to repeat
+    }
+    uint32_t blocks = 1;
+    QList<CommandPayload> commands = isReadback ? checksumReadbackCommands(blockAddr, blockSize)
+                                                : checksumBlockCommands(blockAddr, blockSize, blocks);
+    addToHeadOfCommandQueue(commands);
+    checksumBlocksPending[it.key()] += blocks - 1;
+}
+
+/***************************************************************
+*  Bulk download
+****************************************************************/
+uint32_t XcpTask::rawValueToSet(const std::shared_ptr<RecordElement> recordElement) {
+    if(recordElement->getIsFloat()) {
+        float value = recordElement->getValueToSetFloat();
+        uint32_t raw;
+        std::memcpy(&raw, &value, sizeof(raw));
+        return raw;
+    }
+    return (uint32_t) recordElement->getValueToSetInt();
+}
+
+uint32_t XcpTask::rawValue(const std::shared_ptr<RecordElement> recordElement, const double value) {
+    if(recordElement->getIsFloat()) {
+        float valueFloat = (float) value;
+        uint32_t raw;
+        std::memcpy(&raw, &valueFloat, sizeof(raw));
+        return raw;
+    }
+    return (uint32_t) (int64_t) std::llround(value);
+}
+
+std::vector<uint8_t> XcpTask::rawValueToBytes(const uint32_t raw, const uint32_t size) {
+    bool isLittleEndian = (xcpClientConfig->getEndian() == XcpOptions::ENDIAN_LITTLE);
+    std::vector<uint8_t> bytes(size);
+    for(uint32_t i = 0; i < size; i++) {
+        uint32_t shift = isLittleEndian ? (i * 8) : ((size - 1 - i) * 8);
+        bytes[i] = (shift < 32) ? ((raw >> shift) & 0xFF) : 0;
+    }
+    return bytes;
+}
+
+DownloadRange XcpTask::downloadRangeRecordElement(const std::shared_ptr<RecordElement> recordElement) {
+    DownloadRange range;
+    range.addr = (uint32_t) recordElement->getParseResult()->getAddress();
+    range.data = rawValueToBytes(rawValueToSet(recordElement), recordElement->getParseResult()->getSize());
+    return range;
+}
+
+/**
+ * The range is streamed after one SET_MTA, the slave increments the MTA with every download.
+ * In master block mode a DOWNLOAD announces up to MAX_BS packets which are followed by DOWNLOAD_NEXT packets,
+ * only the last packet of a block is answered by the slave. Without master block mode full packets are sent with DOWNLOAD_MAX.
+ * Assumes address granularity BYTE.
+ */
+void XcpTask::addBulkDownloadToCommandQueue(const DownloadRange &range) {
+    const int maxCto = xcpClientConfig->getMaxCto();
+    const int elementsPerDownload = maxCto - XCP_DOWNLOAD::MASTER_BYTE_ALIGNMENT_ELEMENT_1;
+    const int elementsPerDownloadMax = maxCto - XCP_DOWNLOAD_MAX::MASTER_BYTE_ALIGNMENT_ELEMENT_1;
+    const XcpClientConfig::CommModeInfo commModeInfo = xcpClientConfig->getCommModeInfo();
+    const QByteArray data(reinterpret_cast<const char*>(range.data.data()), (int) range.data.size());
+
+    addToCommandQueue(payloadSetMta(range.addr), false);
+    int offset = 0;
+    if(commModeInfo.masterBlockMode) {
+        const int maxBlockElements = std::min<int>(XCP_DOWNLOAD::MASTER_MAX_ELEMENTS, std::max<int>(1, commModeInfo.maxBs) * elementsPerDownload);
+        while(offset < data.size()) {
+            int blockElements = std::min(data.size() - offset, maxBlockElements);
+            int packetElements = std::min(blockElements, elementsPerDownload);
+            CommandPayload download = payloadDownloadBytes(blockElements, data.mid(offset, packetElements));
+            download.setIsResponseExpected(packetElements == blockElements);
+            addToCommandQueue(download, false);
+
+            int sent = packetElements;
+            while(sent < blockElements) {
+                int remaining = blockElements - sent;
+                packetElements = std::min(remaining, elementsPerDownload);
+                CommandPayload downloadNext = payloadDownloadNext(remaining, data.mid(offset + sent, packetElements));
+                downloadNext.setIsResponseExpected(packetElements == remaining);
+                addToCommandQueue(downloadNext, false);
+                sent += packetElements;
+            }
+            offset += blockElements;
+        }
+    } else {
+        while(data.size() - offset >= elementsPerDownloadMax) {
+            addToCommandQueue(payloadDownloadMax(data.mid(offset, elementsPerDownloadMax)), false);
+            offset += elementsPerDownloadMax;
+        }
+        if(offset < data.size()) {
+            addToCommandQueue(payloadDownloadBytes(data.size() - offset, data.mid(offset)), false);
+        }
+    }
+}
+
+/**
+ * The ranges are aligned to CHECKSUM_ALIGNMENT with the mirrored content around them,
+ * since ADD_22, ADD_24 and ADD_44 are only defined for whole elements. The downloaded bytes win over the padding.
+ */
+void XcpTask::addDownloadVerificationToCommandQueue(const std::vector<DownloadRange> &ranges) {
+    isChecksumValid = true;
+    std::vector<DownloadRange> alignedRanges;
+    for(const auto& range : ranges) {
+        DownloadRange aligned = range;
+        if(calibrationMirror.align(aligned, CHECKSUM_ALIGNMENT)) {
+            alignedRanges.push_back(aligned);
+        }
+    }
+    alignedRanges.insert(alignedRanges.end(), ranges.begin(), ranges.end());
+    for(const auto& range : DownloadPlanner::mergeRanges(alignedRanges)) {
+        ElfMemorySegment segment;
+        segment.setName("dataset");
+        segment.setIsWritable(true);
+        segment.setAddr(range.addr);
+        segment.setData(range.data.data(), range.data.size());
+        checksumSegments.insert(range.addr, segment);
+        requestChecksumFromSlave(range.addr, segment.getSize());
+    }
+}
+
+/**
+ * Seeds the calibration mirror with the current content of all selected calibration parameters.
+ * The parameters are merged to contiguous ranges, each range is read with one SET_MTA and UPLOAD commands
+ * (in slave block mode up to 255 bytes per UPLOAD).
+ */
+void XcpTask::addMirrorUploadToCommandQueue() {
+    std::vector<DownloadRange> characteristics;
+    for(const auto& recordElement : model->getRecordElements()) {
+        shared_ptr<ParseResultBase> parseResult = recordElement->getParseResult();
+        if(recordElement->getIsSelected() && parseResult->getSrcCharateristic() != nullptr) {
+            DownloadRange range;
+            range.addr = (uint32_t) parseResult->getAddress();
+            range.data.resize(parseResult->getSize());
+            characteristics.push_back(range);
+        }
+    }
+
+    for(const auto& range : DownloadPlanner::mergeRanges(characteristics)) {
+        for(const auto& cmdPayload : uploadCommands(range.addr, range.data.size())) {
+            addToCommandQueue(cmdPayload, false);
+        }
+    }
+}
+
+/***************************************************************
+*  Calibration page switching
+****************************************************************/
+CommandPayload XcpTask::payloadSetCalPage(const uint8_t mode, const uint8_t page, const uint8_t segment) {
+    static const uint8_t command = XCP_CMD::SET_CAL_PAGE;
+    QByteArray payload;
+    payload.insert(XCP_PID, command);
+    payload.insert(XCP_SET_CAL_PAGE::MASTER_MODE, mode);
+    payload.insert(XCP_SET_CAL_PAGE::MASTER_SEGMENT, segment);
+    payload.insert(XCP_SET_CAL_PAGE::MASTER_PAGE, page);
+    printMsgDebug("CMD", "SET_CAL_PAGE", payload);
+    return CommandPayload(payload, command);
+}
+
+CommandPayload XcpTask::payloadGetCalPage(const uint8_t mode, const uint8_t segment) {
+    static const uint8_t command = XCP_CMD::GET_CAL_PAGE;
+    QByteArray payload;
+    payload.insert(XCP_PID, command);
+    payload.insert(XCP_GET_CAL_PAGE::MASTER_MODE, mode);
+    payload.insert(XCP_GET_CAL_PAGE::MASTER_SEGMENT, segment);
+    printMsgDebug("CMD", "GET_CAL_PAGE", payload);
+    return CommandPayload(payload, command);
+}
+
+CommandPayload XcpTask::payloadCopyCalPage(const uint8_t srcPage, const uint8_t destPage, const uint8_t srcSegment, const uint8_t destSegment) {
+    static const uint8_t command = XCP_CMD::COPY_CAL_PAGE;
+    QByteArray payload;
+    payload.insert(XCP_PID, command);
+    payload.insert(XCP_COPY_CAL_PAGE::MASTER_SRC_SEGMENT, srcSegment);
+    payload.insert(XCP_COPY_CAL_PAGE::MASTER_SRC_PAGE, srcPage);
+    payload.insert(XCP_COPY_CAL_PAGE::MASTER_DEST_SEGMENT, destSegment);
+    payload.insert(XCP_COPY_CAL_PAGE::MASTER_DEST_PAGE, destPage);
+    printMsgDebug("CMD", "COPY_CAL_PAGE", payload);
+    return CommandPayload(payload, command);
+}
+
+void XcpTask::calPageSwitchAbort() {
+    isCalPageSwitchActive = false;
+    clearCommandQueue(); // drop the remaining dataset commands, the page switch must not happen
+    checksumSegments.clear();
+    checksumBlocksPending.clear();
+    checksumReadbacks.clear();
+    calibrationMirrorStaged.clear(); // the slave keeps running on the page the mirror describes
+    datasetElements.clear();
+    uint8_t calPageActive = xcpClientConfig->getCalPageActive();
+    addToCommandQueue(payloadSetCalPage(XCP_SET_CAL_PAGE::MODE_XCP, calPageActive));
+    emit sigPrintMessage("Calibration dataset aborted. Slave is still running on page " + QString::number(calPageActive) + ".", true);
+}
+
+/**
+ * @return true if the command belongs to the dataset sequence: the page copy and switch, the downloads and their
+ * verification (no other checksum verification runs during a dataset). Errors of other commands, e.g. a SHORT_UPLOAD poll,
+ * do not abort the dataset.
+ */
+bool XcpTask::isCalPageSwitchCommand(const uint8_t cmd) const {
+    return cmd == XCP_CMD::SET_MTA || cmd == XCP_CMD::DOWNLOAD || cmd == XCP_CMD::DOWNLOAD_NEXT
+           || cmd == XCP_CMD::DOWNLOAD_MAX || cmd == XCP_CMD::BUILD_CHECKSUM || cmd == XCP_CMD::UPLOAD
+           || cmd == XCP_CMD::SET_CAL_PAGE || cmd == XCP_CMD::COPY_CAL_PAGE;
+}
+
 /***************************************************************
 *  Data acquisition
 ****************************************************************/
 void XcpTask::daqDynamicConfig() {
+    daqRemoveStimIfNotSupported();
+    daqOverloadController.clear();
+
     CommandPayload freeDaq = payloadFreeDaq();
     addToCommandQueue(freeDaq);
     CommandPayload allocDaq = payloadAllocDaq();
@@ -361,8 +713,13 @@ void XcpTask::daqDynamicConfig() {
     daqListNr = 0;
     for(auto& daq : eventDaqList) {
         daq.setDaqListNr(daqListNr);
-        uint16_t eventChannel = daq.getEventChannel(); //limitaion: one event has one daqList.
-        CommandPayload setDaqListMode = payloadSetDaqListMode(daqListNr, eventChannel);
+        uint16_t eventChannel = daq.getEventChannel(); //limitaion: one event has one daqList per direction.
+        bool isStim = (daq.getDirection() == DaqList::Direction::Stim);
+        CommandPayload setDaqListMode = payloadSetDaqListMode(daqListNr, eventChannel, isStim, daq.getPrescaler());
+        if(!isStim) {
+            daqOverloadController.addDaqList(daqListNr); // a prescaler adapted in the last recording is restored step by step
+            daqOverloadController.setPrescaler(daqListNr, daq.getPrescaler());
+        }
         CommandPayload startStopDaqList = payloadStartStopDaqList(daqListNr);
         addToCommandQueue(setDaqListMode);
         addToCommandQueue(startStopDaqList);
@@ -383,6 +740,74 @@ void XcpTask::daqStopAll() {
     sendNextCommandInQueue();
 }
 
+void XcpTask::daqRemoveStimIfNotSupported() {
+    if(xcpClientConfig->getIsSupported().stimulation) {
+        return;
+    }
+    bool isRemoved = false;
+    QMap<uint32_t, DaqList>::iterator it = eventDaqList.begin();
+    while(it != eventDaqList.end()) {
+        if(it->getDirection() == DaqList::Direction::Stim) {
+            it = eventDaqList.erase(it);
+            isRemoved = true;
+        } else {
+            it++;
+        }
+    }
+    if(isRemoved) {
+        emit sigPrintMessage("Slave does not support stimulation (STIM). Stimulated signals are ignored.", true);
+    }
+}
+
+/**
+ * The mode of a running DAQ list can not be changed, so the list is stopped, reconfigured and started again.
+ * Only this list is interrupted, the other lists keep running.
+ */
+/**
+ * The DAQ list keeps its prescaler until the slave accepts SET_DAQ_LIST_MODE, see daqListModeResponse().
+ * @return false if the slave does not support prescalers or the list is unknown.
+ */
+bool XcpTask::daqChangePrescaler(const uint16_t daqListNr, const uint8_t prescaler) {
+    if(!xcpClientConfig->getDaqProcessorInfo().prescalerSupported) {
+        return false;
+    }
+    for(const auto& daq : eventDaqList) {
+        if(daq.getDaqListNr() == daqListNr && daq.getDirection() == DaqList::Direction::Daq) {
+            addToCommandQueue(payloadStartStopDaqList(daqListNr, XCP_START_STOP_DAQ_LIST::MODE_STOP), false);
+            addToCommandQueue(payloadSetDaqListMode(daqListNr, daq.getEventChannel(), false, prescaler), false);
+            addToCommandQueue(payloadStartStopDaqList(daqListNr, XCP_START_STOP_DAQ_LIST::MODE_START), false);
+            return true;
+        }
+    }
+    return false;
+}
+
+/**
+ * An accepted prescaler is stored in the DAQ list, a rejected one resets the overload controller to the prescaler
+ * of the DAQ list.
+ */
+void XcpTask::daqListModeResponse(const CommandPayload& setDaqListMode, const bool isAccepted) {
+    QByteArray payload = setDaqListMode.getPayload();
+    if(payload.size() <= XCP_SET_DAQ_LIST_MODE::MASTER_TRANS_RATE_PRESC) {
+        return;
+    }
+    uint16_t daqListNr = (uint8_t) payload.at(XCP_SET_DAQ_LIST_MODE::MASTER_DAQ_LIST_NR_0)
+                         | ((uint8_t) payload.at(XCP_SET_DAQ_LIST_MODE::MASTER_DAQ_LIST_NR_1) << 8);
+    uint8_t prescaler = (uint8_t) payload.at(XCP_SET_DAQ_LIST_MODE::MASTER_TRANS_RATE_PRESC);
+    for(auto& daq : eventDaqList) {
+        if(daq.getDaqListNr() == daqListNr && daq.getDirection() == DaqList::Direction::Daq) {
+            if(isAccepted) {
+                daq.setPrescaler(prescaler);
+            } else if(prescaler != daq.getPrescaler()) {
+                emit sigPrintMessage("DAQ list " + QString::number(daqListNr) + ": prescaler " + QString::number(prescaler)
+                                     + " rejected by the slave.", true);
+            }
+            daqOverloadController.setPrescaler(daqListNr, daq.getPrescaler());
+            return;
+        }
+    }
+}
+
 CommandPayload XcpTask::payloadFreeDaq() {
     static const uint8_t command = XCP_CMD::FREE_DAQ;
     QByteArray payload;
@@ -489,12 +914,12 @@ CommandPayload XcpTask::payloadWriteDaq(const uint32_t addr, const uint8_t size,
     return CommandPayload(payload, command);
 }
 
-CommandPayload XcpTask::payloadSetDaqListMode(const uint16_t daqListNr, const uint16_t eventChannel) {
+CommandPayload XcpTask::payloadSetDaqListMode(const uint16_t daqListNr, const uint16_t eventChannel, const bool isStim, const uint8_t prescaler) {
     static const uint8_t command = XCP_CMD::SET_DAQ_LIST_MODE;
 
     QBitArray modeBits(8);
     modeBits.setBit(XCP_SET_DAQ_LIST_MODE::MASTER_MODE_ALTERNATE, false);
-    modeBits.setBit(XCP_SET_DAQ_LIST_MODE::MASTER_MODE_DIRECTION, false);
+    modeBits.setBit(XCP_SET_DAQ_LIST_MODE::MASTER_MODE_DIRECTION, isStim); // 0: DAQ (slave to master), 1: STIM (master to slave)
     modeBits.setBit(XCP_SET_DAQ_LIST_MODE::MASTER_MODE_RESERVED_0, false);
     modeBits.setBit(XCP_SET_DAQ_LIST_MODE::MASTER_MODE_DTO_CTR, false);
     modeBits.setBit(XCP_SET_DAQ_LIST_MODE::MASTER_MODE_TIMESTAMP, false);
@@ -509,7 +934,7 @@ CommandPayload XcpTask::payloadSetDaqListMode(const uint16_t daqListNr, const ui
     uint8_t eventChannelByte0 =  eventChannel & 0x000000FF;
     uint8_t eventChannelByte1 = (eventChannel & 0x0000FF00) >> 8;
 
-    static const uint8_t transmissionRatePrescaler = 1;
+    uint8_t transmissionRatePrescaler = std::max<uint8_t>(1, prescaler);
     static const uint8_t daqListPriority = 0;
 
     QByteArray payload;
@@ -526,12 +951,9 @@ CommandPayload XcpTask::payloadSetDaqListMode(const uint16_t daqListNr, const ui
     return CommandPayload(payload, command);
 }
 
-CommandPayload XcpTask::payloadStartStopDaqList(const uint16_t daqListNr) {
+CommandPayload XcpTask::payloadStartStopDaqList(const uint16_t daqListNr, const uint8_t mode) {
     static const uint8_t command = XCP_CMD::START_STOP_DAQ_LIST;
 
-    static const uint8_t SELECT = 0x02;
-    static const uint8_t mode = SELECT;
-
     uint8_t byte0 =  daqListNr & 0x000000FF;
     uint8_t byte1 = (daqListNr & 0x0000FF00) >> 8;
 
@@ -548,15 +970,11 @@ CommandPayload XcpTask::payloadStartStopDaqList(const uint16_t daqListNr) {
 CommandPayload XcpTask::payloadStartStopSynch(const bool doStart) {
     static const uint8_t command = XCP_CMD::START_STOP_SYNCH;
 
-    static const uint8_t STOP_ALL  = 0x00;
-    static const uint8_t START_SELECTED = 0x01;
-    static const uint8_t STOP_SELECTED  = 0x02;
-
     uint8_t mode;
     if(doStart) {
-        mode = START_SELECTED;
+        mode = XCP_START_STOP_SYNCH::MODE_START_SELECTED;
     } else {
-        mode = STOP_ALL;
+        mode = XCP_START_STOP_SYNCH::MODE_STOP_ALL;
     }
 
     QByteArray payload;
@@ -567,31 +985,85 @@ CommandPayload XcpTask::payloadStartStopSynch(const bool doStart) {
     return CommandPayload(payload, command);
 }
 
+/***************************************************************
+*  Stimulation (STIM)
+****************************************************************/
+/**
+ * A STIM DTO has the same layout as a DAQ DTO: the PID (one ODT per list, so the PID equals the DAQ list number)
+ * followed by the values of the ODT entries. The slave writes the values to its RAM with the next cycle of the event.
+ */
+QByteArray XcpTask::payloadStimData(const DaqList &daq, const double timeInS) {
+    QByteArray payload;
+    payload.append((char) daq.getDaqListNr());
+    for(const auto& odtEntry : daq.getOdtEntries()) {
+        double value = odtEntry->getStimGenerator()->valueAt(timeInS);
+        uint32_t raw = rawValue(odtEntry, value);
+        for(uint8_t byte : rawValueToBytes(raw, odtEntry->getParseResult()->getSize())) {
+            payload.append((char) byte);
+        }
+    }
+    return payload;
+}
+
+void XcpTask::stimStart() {
+    timerStimList.clear();
+    stimElapsedTimer.start();
+    for(const auto& daq : eventDaqList) {
+        if(daq.getDirection() != DaqList::Direction::Stim || daq.getOdtEntries().isEmpty()) {
+            continue;
+        }
+        int rateInMs = daq.getOdtEntries().first()->getEvent().getRateInMs();
+        startTimerStim(daq.getDaqListNr(), std::max(1, rateInMs));
+    }
+}
+
 /***************************************************************
 *  Response from client
 ****************************************************************/
 void XcpTask::slotResponseReceived(const QByteArray payload) {
-    timerResponseTimeout->stop();
-
     const uint8_t pid = payload.at(XCP_PID);
 
     switch (pid) {
     case XCP_CMD_RESPONSE_PACKET::RES_POSITIVE: {
+        timerResponseTimeout->stop();
         responseProcessPositive(lastCommandRequest, payload);
+        if(uploadBytesReceived > 0) {
+            timerResponseTimeout->start(); // slave block mode: the UPLOAD continues with the next packet
+            break;
+        }
         isSendingPossible = true;
         sendNextCommandInQueue();
         break;
     }
     case XCP_CMD_RESPONSE_PACKET::ERROR: {
+        timerResponseTimeout->stop();
+        if(lastCommandRequest.getCmd() == XCP_CMD::BUILD_CHECKSUM && responseBuildChecksumNegative(payload, lastCommandRequest)) {
+            isSendingPossible = true; // the block is repeated in smaller parts or read back
+            sendNextCommandInQueue();
+            break;
+        }
         responseProcessNegative(payload);
+        if(lastCommandRequest.getCmd() == XCP_CMD::BUILD_CHECKSUM) {
+            checksumBlockVerified((uint32_t) lastCommandRequest.getId(), false);
+        } else if(lastCommandRequest.getCmd() == XCP_CMD::UPLOAD) {
+            checksumReadbackFailed((uint32_t) lastCommandRequest.getId());
+            uploadBytesReceived = 0;
+        } else if(lastCommandRequest.getCmd() == XCP_CMD::SET_DAQ_LIST_MODE) {
+            daqListModeResponse(lastCommandRequest, false);
+        }
+        if(isCalPageSwitchActive && isCalPageSwitchCommand(lastCommandRequest.getCmd())) {
+            calPageSwitchAbort();
+        }
         isSendingPossible = true;
         sendNextCommandInQueue();
         break;
     }
-    case XCP_CMD_RESPONSE_PACKET::SERVICE_REQUEST: {
+    case XCP_CMD_RESPONSE_PACKET::SERVICE_REQUEST: { // asynchronous, a pending command is still waiting for its response
+        responseProcessServiceRequest(payload);
         break;
     }
     case XCP_CMD_RESPONSE_PACKET::EVENT: {
+        responseProcessEvent(payload);
         break;
     }
     default:
@@ -611,6 +1083,12 @@ void XcpTask::responseProcessPositive(const CommandPayload &lastCmdSend,  const
         ret = responseConnect(responsePayload);
         if(ret) {
             setStateAndInformBackend(State::Connected);
+            if(xcpClientConfig->getIsSupported().optionalAvailable) {
+                addToCommandQueue(payloadGetCommModeInfo());
+            }
+            if(xcpClientConfig->getIsSupported().daqList) {
+                addToCommandQueue(payloadGetDaqProcessorInfo());
+            }
             CommandPayload cmdPayload = payloadGetStatus();
             addToCommandQueue(cmdPayload);
         }
@@ -622,23 +1100,64 @@ void XcpTask::responseProcessPositive(const CommandPayload &lastCmdSend,  const
     }
     case XCP_CMD::GET_STATUS: {
         ret = responseGetStatus(responsePayload);
+        if(xcpClientConfig->getIsSupported().calibrationPaging) {
+            addToCommandQueue(payloadGetCalPage(XCP_SET_CAL_PAGE::MODE_ECU));
+        }
+        addMirrorUploadToCommandQueue();
         updatePollingListValuesFromSlave();
         break;
     }
+    case XCP_CMD::GET_COMM_MODE_INFO: {
+        ret = responseGetCommModeInfo(responsePayload);
+        break;
+    }
+    case XCP_CMD::GET_DAQ_PROCESSOR_INFO: {
+        ret = responseGetDaqProcessorInfo(responsePayload);
+        break;
+    }
     case XCP_CMD::SHORT_UPLOAD: {
-        ret = responseShortUpload(responsePayload, lastCmdSend.getId(), lastCmdSend.getSizeDataType());
+        ret = responseShortUpload(responsePayload, lastCmdSend.getId(), lastCmdSend.getSizeDataType(), lastCmdSend.getSignalId());
         break;
     }
     case XCP_CMD::SET_MTA: {
         ret = responseSetMta(responsePayload);
         break;
     }
-    case XCP_CMD::DOWNLOAD: {
+    case XCP_CMD::UPLOAD: {
+        ret = responseUpload(responsePayload, lastCmdSend);
+        break;
+    }
+    case XCP_CMD::DOWNLOAD:
+    case XCP_CMD::DOWNLOAD_NEXT:
+    case XCP_CMD::DOWNLOAD_MAX: {
         ret = responseDownload(responsePayload);
         break;
     }
     case XCP_CMD::BUILD_CHECKSUM: {
-        ret = responseBuildChecksum(responsePayload);
+        ret = responseBuildChecksum(responsePayload, (uint32_t) lastCmdSend.getId(), lastCmdSend.getSizeDataType());
+        break;
+    }
+    case XCP_CMD::SET_CAL_PAGE: {
+        ret = responseSetCalPage(responsePayload, lastCmdSend.getPayload());
+        break;
+    }
+    case XCP_CMD::GET_CAL_PAGE: {
+        ret = responseGetCalPage(responsePayload);
+        break;
+    }
+    case XCP_CMD::COPY_CAL_PAGE: {
+        ret = responseCopyCalPage(responsePayload);
+        break;
+    }
+    case XCP_CMD::SET_DAQ_LIST_MODE: {
+        daqListModeResponse(lastCmdSend, true);
+        break;
+    }
+    case XCP_CMD::START_STOP_SYNCH: {
+        uint8_t mode = lastCmdSend.getPayload().at(XCP_START_STOP_SYNCH::MASTER_MODE);
+        if(mode == XCP_START_STOP_SYNCH::MODE_START_SELECTED && state == State::Run) {
+            stimStart(); // the slave accepts STIM data as soon as the lists are running
+        }
         break;
     }
     default:
@@ -761,12 +1280,22 @@ bool XcpTask::responseConnect(const QByteArray &payload) {
     isSupported.slaveBlockModeAvailable = commBasicBits.at(XCP_CONNECT::SLAVE_COMM_BASIC_SLAVE_BLOCK_MODE);
     isSupported.optionalAvailable = commBasicBits.at(XCP_CONNECT::SLAVE_COMM_BASIC_OPTIONAL);
     xcpClientConfig->setIsSupported(isSupported);
+    xcpClientConfig->setDaqProcessorInfo(XcpClientConfig::DaqProcessorInfo()); // unknown until GET_DAQ_PROCESSOR_INFO
 
     if(commBasicBits.at(XCP_CONNECT::SLAVE_COMM_BASIC_BYTE_ORDER)) {
         xcpClientConfig->setEndian(XcpOptions::ENDIAN_BIG);
     } else {
         xcpClientConfig->setEndian(XcpOptions::ENDIAN_LITTLE);
     }
+    xcpClientConfig->setMaxCto((uint8_t) payload.at(XCP_CONNECT::SLAVE_MAX_CTO_SIZE));
+    uint8_t maxDto0 = payload.at(XCP_CONNECT::SLAVE_MAX_DTO_SIZE_0);
+    uint8_t maxDto1 = payload.at(XCP_CONNECT::SLAVE_MAX_DTO_SIZE_1);
+    if(xcpClientConfig->getEndian() == XcpOptions::ENDIAN_LITTLE) {
+        xcpClientConfig->setMaxDto((maxDto1 << 8) | maxDto0);
+    } else {
+        xcpClientConfig->setMaxDto((maxDto0 << 8) | maxDto1);
+    }
+
     QBitArray addrGranularityBits(2);
     addrGranularityBits.setBit(0, commBasicBits.at(XCP_CONNECT::SLAVE_COMM_BASIC_ADDR_GRANULARITY_0));
     addrGranularityBits.setBit(1, commBasicBits.at(XCP_CONNECT::SLAVE_COMM_BASIC_ADDR_GRANULARITY_1));
@@ -812,7 +1341,49 @@ bool XcpTask::responseGetStatus(const QByteArray &payload) {
     return true;
 }
 
-bool XcpTask::responseShortUpload(const QByteArray& payload, const uint64_t id, const int sizeDatatype) {
+bool XcpTask::responseGetCommModeInfo(const QByteArray &payload) {
+    printMsgDebug("RESP.", "GET_COMM_MODE_INFO", payload);
+    bool isSizeValid = isPayloadSizeValid(XCP_GET_COMM_MODE_INFO::SLAVE_LENGTH, payload.size());
+    if(!isSizeValid) {
+        return false;
+    }
+    QBitArray commModeOptionalBits = byteToBits(payload.at(XCP_GET_COMM_MODE_INFO::SLAVE_COMM_MODE_OPTIONAL));
+
+    XcpClientConfig::CommModeInfo commModeInfo = {};
+    commModeInfo.masterBlockMode = commModeOptionalBits.at(XCP_GET_COMM_MODE_INFO::SLAVE_COMM_MODE_OPTIONAL_MASTER_BLOCK_MODE);
+    commModeInfo.interleavedMode = commModeOptionalBits.at(XCP_GET_COMM_MODE_INFO::SLAVE_COMM_MODE_OPTIONAL_INTERLEAVED_MODE);
+    commModeInfo.maxBs = payload.at(XCP_GET_COMM_MODE_INFO::SLAVE_MAX_BS);
+    commModeInfo.minSt = payload.at(XCP_GET_COMM_MODE_INFO::SLAVE_MIN_ST);
+    commModeInfo.queueSize = payload.at(XCP_GET_COMM_MODE_INFO::SLAVE_QUEUE_SIZE);
+    xcpClientConfig->setCommModeInfo(commModeInfo);
+    return true;
+}
+
+bool XcpTask::responseGetDaqProcessorInfo(const QByteArray &payload) {
+    printMsgDebug("RESP.", "GET_DAQ_PROCESSOR_INFO", payload);
+    bool isSizeValid = isPayloadSizeValid(XCP_GET_DAQ_PROCESSOR_INFO::SLAVE_LENGTH, payload.size());
+    if(!isSizeValid) {
+        return false;
+    }
+    QBitArray daqPropertiesBits = byteToBits(payload.at(XCP_GET_DAQ_PROCESSOR_INFO::SLAVE_DAQ_PROPERTIES));
+    uint8_t maxDaq0 = payload.at(XCP_GET_DAQ_PROCESSOR_INFO::SLAVE_MAX_DAQ_0);
+    uint8_t maxDaq1 = payload.at(XCP_GET_DAQ_PROCESSOR_INFO::SLAVE_MAX_DAQ_1);
+    uint8_t maxEventChannel0 = payload.at(XCP_GET_DAQ_PROCESSOR_INFO::SLAVE_MAX_EVENT_CHANNEL_0);
+    uint8_t maxEventChannel1 = payload.at(XCP_GET_DAQ_PROCESSOR_INFO::SLAVE_MAX_EVENT_CHANNEL_1);
+    bool isLittleEndian = (xcpClientConfig->getEndian() == XcpOptions::ENDIAN_LITTLE);
+
+    XcpClientConfig::DaqProcessorInfo daqProcessorInfo = {};
+    daqProcessorInfo.prescalerSupported = daqPropertiesBits.at(XCP_GET_DAQ_PROCESSOR_INFO::SLAVE_DAQ_PROPERTIES_PRESCALER_SUPPORTED);
+    daqProcessorInfo.overloadMsb = daqPropertiesBits.at(XCP_GET_DAQ_PROCESSOR_INFO::SLAVE_DAQ_PROPERTIES_OVERLOAD_MSB);
+    daqProcessorInfo.overloadEvent = daqPropertiesBits.at(XCP_GET_DAQ_PROCESSOR_INFO::SLAVE_DAQ_PROPERTIES_OVERLOAD_EVENT);
+    daqProcessorInfo.maxDaq = isLittleEndian ? ((maxDaq1 << 8) | maxDaq0) : ((maxDaq0 << 8) | maxDaq1);
+    daqProcessorInfo.maxEventChannel = isLittleEndian ? ((maxEventChannel1 << 8) | maxEventChannel0) : ((maxEventChannel0 << 8) | maxEventChannel1);
+    daqProcessorInfo.minDaq = payload.at(XCP_GET_DAQ_PROCESSOR_INFO::SLAVE_MIN_DAQ);
+    xcpClientConfig->setDaqProcessorInfo(daqProcessorInfo);
+    return true;
+}
+
+bool XcpTask::responseShortUpload(const QByteArray& payload, const uint64_t id, const int sizeDatatype, const uint32_t signalId) {
     printMsgDebug("RESP.", "SHORT_UPLOAD", payload);
     bool isSizeValid = isPayloadSizeValid(sizeDatatype + 1, payload.size());
     if(!isSizeValid) {
@@ -828,7 +1399,34 @@ bool XcpTask::responseShortUpload(const QByteArray& payload, const uint64_t id,
             value = value << 8;
         }
     }
-    emit sigVariableValueUpdate(id, (int64_t) value);
+    calibrationMirror.update((uint32_t) id, reinterpret_cast<const uint8_t*>(payload.constData()) + XCP_PID + 1, sizeDatatype);
+    if(signalId != SignalRegistry::INVALID_ID) {
+        emit sigVariableValueUpdate(signalId, (int64_t) value);
+    }
+    return true;
+}
+
+bool XcpTask::responseUpload(const QByteArray &payload, const CommandPayload &lastCmdSend) {
+    printMsgDebug("RESP.", "UPLOAD", payload);
+    bool isSizeValid = isPayloadSizeValid(XCP_UPLOAD::SLAVE_BYTE_ALIGNMENT_ELEMENT_1 + 1, payload.size());
+    if(!isSizeValid) {
+        uploadBytesReceived = 0;
+        return false;
+    }
+    const uint32_t elementsRequested = lastCmdSend.getSizeDataType();
+    const uint32_t elementsRemaining = elementsRequested - uploadBytesReceived;
+    const uint32_t elementsInPacket = std::min<uint32_t>(elementsRemaining, payload.size() - XCP_UPLOAD::SLAVE_BYTE_ALIGNMENT_ELEMENT_1);
+
+    const uint8_t* data = reinterpret_cast<const uint8_t*>(payload.constData()) + XCP_UPLOAD::SLAVE_BYTE_ALIGNMENT_ELEMENT_1;
+    const uint32_t addr = (uint32_t) lastCmdSend.getId() + uploadBytesReceived;
+    if(!checksumReadbackReceived(addr, data, elementsInPacket)) {
+        calibrationMirror.update(addr, data, elementsInPacket);
+    }
+
+    uploadBytesReceived += elementsInPacket;
+    if(uploadBytesReceived >= elementsRequested) {
+        uploadBytesReceived = 0; // upload complete
+    }
     return true;
 }
 
@@ -850,25 +1448,126 @@ bool XcpTask::responseDownload(const QByteArray &payload) {
     return true;
 }
 
-bool XcpTask::responseBuildChecksum(const QByteArray &payload) {
+bool XcpTask::responseBuildChecksum(const QByteArray &payload, const uint32_t blockAddr, const uint32_t blockSize) {
     printMsgDebug("RESP.", "BUILD_CHECKSUM", payload);
     bool isSizeValid = isPayloadSizeValid(XCP_BUILD_CHECKSUM::SLAVE_LENGTH, payload.size());
     if(!isSizeValid) {
+        checksumBlockVerified(blockAddr, false);
         return false;
     }
 
-    uint32_t value = 0;
-    int readStart = XCP_BUILD_CHECKSUM::SLAVE_CHECKSUM_3;
-    int readEnd = XCP_BUILD_CHECKSUM::SLAVE_CHECKSUM_0;
-    for(int i = readStart; i >= readEnd; i--) { //little endian
-        value |= (unsigned char) payload.at(i);
-        if(i > readEnd) {
-            value = value << 8;
+    uint32_t value = payloadToUint32(payload, XCP_BUILD_CHECKSUM::SLAVE_CHECKSUM_0);
+
+    QMap<uint32_t, ElfMemorySegment>::iterator it = checksumSegmentOfBlock(blockAddr);
+    if(it == checksumSegments.end() || (uint64_t) blockAddr + blockSize > (uint64_t) it.key() + it->getSize()) {
+        return false; // checksum was not requested by slotVerifyChecksum() or the segment failed already
+    }
+    const ElfMemorySegment& segment = it.value();
+    const QString segmentName = QString::fromStdString(segment.getName());
+    const uint8_t* blockData = segment.getData().data() + (blockAddr - it.key());
+
+    uint8_t checksumType = payload.at(XCP_BUILD_CHECKSUM::SLAVE_CHECKSUM_TYPE);
+    bool isLittleEndian = (xcpClientConfig->getEndian() == XcpOptions::ENDIAN_LITTLE);
+    uint32_t checksumLocal = 0;
+    bool isTypeSupported = XcpChecksum::calculate(checksumType, blockData, blockSize, isLittleEndian, checksumLocal);
+    if(!isTypeSupported) { // user defined type or an unaligned block: compare the memory content instead
+        repeatChecksumBlock(blockAddr, blockSize, true);
+        return true;
+    }
+
+    bool isValid = (checksumLocal == value);
+    if(!isValid) {
+        emit sigPrintMessage("Checksum mismatch in segment " + segmentName
+                             + " (0x" + QString::number(blockAddr, 16).toUpper() + ", " + QString::number(blockSize) + " bytes)"
+                             + ": slave 0x" + QString::number(value, 16).toUpper()
+                             + ", ELF 0x" + QString::number(checksumLocal, 16).toUpper(), true);
+    }
+    checksumBlockVerified(blockAddr, isValid);
+    return isValid;
+}
+
+/**
+ * A block larger than the slave accepts is answered with ERR_OUT_OF_RANGE, the response carries the maximum block size
+ * in place of the checksum. The block is split and requested again before any other queued command.
+ * A slave without BUILD_CHECKSUM answers ERR_CMD_UNKNOWN, its memory is read back with UPLOAD from now on.
+ * @return false if the error is not handled here, the error is processed as usual then.
+ */
+bool XcpTask::responseBuildChecksumNegative(const QByteArray &payload, const CommandPayload &buildChecksum) {
+    if(payload.size() < 2) {
+        return false;
+    }
+    const uint8_t errorCode = payload.at(1);
+    const uint32_t blockAddr = (uint32_t) buildChecksum.getId();
+    const uint32_t blockSize = buildChecksum.getSizeDataType();
+    if(errorCode == XCP_ERROR::ERR_CMD_UNKNOWN) {
+        if(!isChecksumReadback) {
+            isChecksumReadback = true;
+            emit sigPrintMessage("Slave does not support BUILD_CHECKSUM. Memory is verified by UPLOAD.", false);
+        }
+        repeatChecksumBlock(blockAddr, blockSize, true);
+        return true;
+    }
+    if(errorCode != XCP_ERROR::ERR_OUT_OF_RANGE || payload.size() < XCP_BUILD_CHECKSUM::SLAVE_LENGTH) {
+        return false;
+    }
+    uint32_t blockSizeMax = payloadToUint32(payload, XCP_BUILD_CHECKSUM::SLAVE_CHECKSUM_0);
+    if(blockSizeMax >= CHECKSUM_ALIGNMENT) {
+        blockSizeMax -= blockSizeMax % CHECKSUM_ALIGNMENT; // keeps the following blocks aligned
+    }
+    if(blockSizeMax == 0) {
+        return false;
+    }
+    if(blockSizeMax >= blockSize) { // the size is not the reason (e.g. a block size which does not fit the checksum type)
+        repeatChecksumBlock(blockAddr, blockSize, true);
+        return true;
+    }
+
+    checksumBlockSizeMax = std::min(checksumBlockSizeMax, blockSizeMax);
+    repeatChecksumBlock(blockAddr, blockSize, false);
+    emit sigPrintMessage("Checksum block size limited to " + QString::number(checksumBlockSizeMax) + " bytes by the slave.", false);
+    return true;
+}
+
+bool XcpTask::responseSetCalPage(const QByteArray &payload, const QByteArray &requestPayload) {
+    printMsgDebug("RESP.", "SET_CAL_PAGE", payload);
+    bool isSizeValid = isPayloadSizeValid(1, payload.size());
+    if(!isSizeValid) {
+        return false;
+    }
+
+    uint8_t mode = requestPayload.at(XCP_SET_CAL_PAGE::MASTER_MODE);
+    uint8_t page = requestPayload.at(XCP_SET_CAL_PAGE::MASTER_PAGE);
+    if(mode & XCP_SET_CAL_PAGE::MODE_ECU) {
+        xcpClientConfig->setCalPageActive(page);
+        if(isCalPageSwitchActive) {
+            isCalPageSwitchActive = false;
+            for(const auto& range : calibrationMirrorStaged) {
+                calibrationMirror.update(range.addr, range.data.data(), range.data.size());
+            }
+            calibrationMirrorStaged.clear();
+            emit sigPrintMessage("Calibration dataset applied. Slave switched to page " + QString::number(page) + ".", false);
+            calibrationDatasetApplied();
         }
     }
+    return true;
+}
 
-    //TODO: sum up value
+bool XcpTask::responseGetCalPage(const QByteArray &payload) {
+    printMsgDebug("RESP.", "GET_CAL_PAGE", payload);
+    bool isSizeValid = isPayloadSizeValid(XCP_GET_CAL_PAGE::SLAVE_LENGTH, payload.size());
+    if(!isSizeValid) {
+        return false;
+    }
+    xcpClientConfig->setCalPageActive(payload.at(XCP_GET_CAL_PAGE::SLAVE_PAGE));
+    return true;
+}
 
+bool XcpTask::responseCopyCalPage(const QByteArray &payload) {
+    printMsgDebug("RESP.", "COPY_CAL_PAGE", payload);
+    bool isSizeValid = isPayloadSizeValid(1, payload.size());
+    if(!isSizeValid) {
+        return false;
+    }
     return true;
 }
 
@@ -877,11 +1576,17 @@ void XcpTask::responseProcessDaq(const QByteArray &payload) {
 
     const int DAQ_LIST_NR_BYTE = 0;
     uint8_t daqListNrResponse = payload.at(DAQ_LIST_NR_BYTE);
+    // only with OVERLOAD_MSB the MSB is an overload flag, otherwise it belongs to the PID
+    bool isOverloadMsb = xcpClientConfig->getDaqProcessorInfo().overloadMsb;
+    if(isOverloadMsb && (daqListNrResponse & XCP_DAQ_DTO::PID_OVERLOAD_INDICATION)) { // the slave lost at least one sample of this list before
+        daqListNrResponse &= ~XCP_DAQ_DTO::PID_OVERLOAD_INDICATION;
+        daqOverloadController.overloadDetected(daqListNrResponse);
+    }
 
     for(const auto& daq : eventDaqList) {
         uint16_t daqListNr = daq.getDaqListNr();
 
-        if(daqListNrResponse == daqListNr) { //find matching daq
+        if(daqListNrResponse == daqListNr && daq.getDirection() == DaqList::Direction::Daq) { //find matching daq
             QList<std::shared_ptr<RecordElement>> odtEntries = daq.getOdtEntries();
             int payloadOffset = DAQ_LIST_NR_BYTE;
 
@@ -900,7 +1605,7 @@ void XcpTask::responseProcessDaq(const QByteArray &payload) {
                         std::cerr << "Out of Range error in responseProcessDaq(): " << oor.what() << std::endl;
                     }
                 }
-                emit sigVariableValueUpdate(odtEntry->getParseResult()->getAddress(), (int64_t) value);
+                emit sigVariableValueUpdate(odtEntry->getSignalId(), (int64_t) value);
 
                 payloadOffset += sizeDatatype;
             }
@@ -909,30 +1614,144 @@ void XcpTask::responseProcessDaq(const QByteArray &payload) {
     }
 }
 
+void XcpTask::responseProcessEvent(const QByteArray &payload) {
+    printMsgDebug("RESP.", "EVENT", payload);
+    bool isSizeValid = isPayloadSizeValid(2, payload.size());
+    if(!isSizeValid) {
+        return;
+    }
+
+    const uint8_t eventCode = payload.at(XCP_EVENT::SLAVE_EVENT_CODE);
+    switch (eventCode) {
+    case XCP_EVENT::EV_DAQ_OVERLOAD: {
+        daqOverloadController.overloadDetectedAll(); // the event does not tell which DAQ list is affected
+        break;
+    }
+    case XCP_EVENT::EV_CMD_PENDING: {
+        if(!isSendingPossible) {
+            timerResponseTimeout->start(); // the slave is still processing the pending command
+        }
+        break;
+    }
+    case XCP_EVENT::EV_SESSION_TERMINATED: {
+        emit sigPrintMessage("XCP Event: EV_SESSION_TERMINATED. The slave terminated the session.", true);
+        resetXcpTask();
+        setStateAndInformBackend(State::Disconnected);
+        break;
+    }
+    case XCP_EVENT::EV_STIM_TIMEOUT: {
+        emit sigPrintMessage("XCP Event: EV_STIM_TIMEOUT", true);
+        break;
+    }
+    case XCP_EVENT::EV_RESUME_MODE: {
+        emit sigPrintMessage("XCP Event: EV_RESUME_MODE", false);
+        break;
+    }
+    case XCP_EVENT::EV_CLEAR_DAQ: {
+        emit sigPrintMessage("XCP Event: EV_CLEAR_DAQ", false);
+        break;
+    }
+    case XCP_EVENT::EV_STORE_DAQ: {
+        emit sigPrintMessage("XCP Event: EV_STORE_DAQ", false);
+        break;
+    }
+    case XCP_EVENT::EV_STORE_CAL: {
+        emit sigPrintMessage("XCP Event: EV_STORE_CAL", false);
+        break;
+    }
+    case XCP_EVENT::EV_SLEEP: {
+        emit sigPrintMessage("XCP Event: EV_SLEEP", false);
+        break;
+    }
+    case XCP_EVENT::EV_WAKE_UP: {
+        emit sigPrintMessage("XCP Event: EV_WAKE_UP", false);
+        break;
+    }
+    case XCP_EVENT::EV_TIME_SYNC:
+    case XCP_EVENT::EV_USER:
+    case XCP_EVENT::EV_TRANSPORT:
+    default:
+        break;
+    }
+}
+
+void XcpTask::responseProcessServiceRequest(const QByteArray &payload) {
+    printMsgDebug("RESP.", "SERVICE_REQUEST", payload);
+    bool isSizeValid = isPayloadSizeValid(2, payload.size());
+    if(!isSizeValid) {
+        return;
+    }
+
+    const uint8_t serviceRequestCode = payload.at(XCP_SERVICE_REQUEST::SLAVE_SERVICE_REQUEST_CODE);
+    switch (serviceRequestCode) {
+    case XCP_SERVICE_REQUEST::SERV_RESET: {
+        emit sigPrintMessage("XCP Service request: the slave requests to be reset.", true);
+        break;
+    }
+    case XCP_SERVICE_REQUEST::SERV_TEXT: {
+        QByteArray text = payload.mid(XCP_SERVICE_REQUEST::SLAVE_TEXT);
+        int end = text.indexOf('\0');
+        if(end >= 0) {
+            text.truncate(end);
+        }
+        emit sigPrintMessage("XCP Slave: " + QString::fromLatin1(text), false);
+        break;
+    }
+    default:
+        break;
+    }
+}
+
 
 /***************************************************************
 *  send command queue
 ****************************************************************/
 inline void XcpTask::sendNextCommandInQueue() {
     QMutexLocker locker(&mutexSend);
+    if(!isSendingPossible) {
+        return; // the head stays in the queue until the pending command is answered
+    }
     lastCommandRequest = removeHeadOfCommandQueue();
-    if(isSendingPossible && lastCommandRequest.getCmd() != CommandPayload::UNINITIALIZED) {
-        isSendingPossible = false;
+    while(lastCommandRequest.getCmd() != CommandPayload::UNINITIALIZED) {
         sendCommand(lastCommandRequest);
-        timerResponseTimeout->start();
+        if(lastCommandRequest.getIsResponseExpected()) {
+            isSendingPossible = false;
+            timerResponseTimeout->start();
+            break;
+        }
+        // master block mode: next packet of the block follows without response
+        uint8_t minSt = xcpClientConfig->getCommModeInfo().minSt;
+        if(minSt > 0) {
+            isSendingPossible = false; // the rest of the block is sent by slotMinStElapsed()
+            timerMinSt->start((minSt * 100 + 999) / 1000); // MIN_ST is given in 100 us
+            break;
+        }
+        lastCommandRequest = removeHeadOfCommandQueue();
     }
 }
 
-inline void XcpTask::addToCommandQueue(const CommandPayload& cmdPayload) {
-    static const int MAX_QUEUE_SIZE = 100;
+/**
+ * @param isSizeLimited false for command sequences which must not be cut (e.g. calibration datasets), true for polling.
+ */
+inline void XcpTask::addToCommandQueue(const CommandPayload& cmdPayload, const bool isSizeLimited) {
     QMutexLocker locker(&mutexCommandQueue);
-    if(commandQueue.size() < MAX_QUEUE_SIZE) {
+    if(!isSizeLimited || commandQueue.size() < MAX_QUEUE_SIZE) {
         commandQueue.enqueue(cmdPayload);
     } else {
         qWarning() << "XCP command queue full.";
     }
 }
 
+/**
+ * The commands are sent next, in the given order. Used to repeat a part of a sequence which must not be interrupted.
+ */
+inline void XcpTask::addToHeadOfCommandQueue(const QList<CommandPayload>& cmdPayloads) {
+    QMutexLocker locker(&mutexCommandQueue);
+    for(int i = cmdPayloads.size() - 1; i >= 0; i--) {
+        commandQueue.prepend(cmdPayloads.at(i));
+    }
+}
+
 inline CommandPayload XcpTask::removeHeadOfCommandQueue() {
     CommandPayload head;
     QMutexLocker locker(&mutexCommandQueue);
@@ -965,6 +1784,41 @@ void XcpTask::createTimerTriggerSendNextCommandInQueue() {
     timerTriggerSendNextCommandInQueue->setInterval(10);
 }
 
+void XcpTask::createTimerOverloadEvaluation() {
+    timerOverloadEvaluation = QSharedPointer<QTimer>::create(this);
+    connect(timerOverloadEvaluation.data(), SIGNAL(timeout()), this, SLOT(slotOverloadEvaluation()));
+    timerOverloadEvaluation->setInterval(OVERLOAD_EVALUATION_WINDOW_MS);
+}
+
+void XcpTask::createTimerMinSt() {
+    timerMinSt = QSharedPointer<QTimer>::create(this);
+    connect(timerMinSt.data(), SIGNAL(timeout()), this, SLOT(slotMinStElapsed()));
+    timerMinSt->setSingleShot(true);
+    timerMinSt->setTimerType(Qt::PreciseTimer);
+}
+
+void XcpTask::slotMinStElapsed() {
+    isSendingPossible = true;
+    sendNextCommandInQueue();
+}
+
+void XcpTask::slotOverloadEvaluation() {
+    bool isAdaptionEnabled = model->getXcpHostConfig()->getIsOverloadControlEnabled()
+                             && xcpClientConfig->getDaqProcessorInfo().prescalerSupported;
+    for(const auto& evaluation : daqOverloadController.evaluate(isAdaptionEnabled)) {
+        QString msg = "DAQ list " + QString::number(evaluation.daqListNr);
+        if(evaluation.overloadsInWindow > 0) {
+            msg += ": " + QString::number(evaluation.overloadsInWindow) + " overload(s), " + QString::number(evaluation.overloadCount) + " in total.";
+        } else {
+            msg += ": no overload.";
+        }
+        if(evaluation.isPrescalerChanged && daqChangePrescaler(evaluation.daqListNr, evaluation.prescaler)) {
+            msg += " Prescaler " + QString::number(evaluation.prescaler) + " requested.";
+        }
+        emit sigPrintMessage(msg, evaluation.overloadsInWindow > 0);
+    }
+}
+
 void XcpTask::slotTriggerSendNextCommandInQueue() {
     if(isSendingPossible) {
         sendNextCommandInQueue();
@@ -972,6 +1826,13 @@ void XcpTask::slotTriggerSendNextCommandInQueue() {
 }
 
 void XcpTask::slotResponseTimeout() {
+    uploadBytesReceived = 0;
+    if(isCalPageSwitchActive && isCalPageSwitchCommand(lastCommandRequest.getCmd())) {
+        calPageSwitchAbort(); // repeating a single command would break the SET_MTA / DOWNLOAD sequence
+        isSendingPossible = true;
+        sendNextCommandInQueue();
+        return;
+    }
     qDebug() << "Response timeout. Add last command to end of queue.";
     addToCommandQueue(lastCommandRequest);
     isSendingPossible = true;
@@ -987,6 +1848,16 @@ void XcpTask::startTimerAddQueuePollingCommand(const uint64_t key, const int mse
     timer->start(msec);
 }
 
+void XcpTask::startTimerStim(const uint16_t daqListNr, const int msec) {
+    QSharedPointer<QTimer> timer = QSharedPointer<QTimer>::create(this);
+    timer->setTimerType(Qt::PreciseTimer);
+    connect(timer.data(), &QTimer::timeout, [=]() {
+        slotStimForDaqListTimer(daqListNr);
+    });
+    timerStimList.insert(daqListNr, timer);
+    timer->start(msec);
+}
+
 void XcpTask::slotPollingForRecordElementTimer(const uint64_t key) {
     try {
         addToCommandQueue(pollingList.at(key));
@@ -995,6 +1866,25 @@ void XcpTask::slotPollingForRecordElementTimer(const uint64_t key) {
     }
 }
 
+void XcpTask::slotStimForDaqListTimer(uint16_t daqListNr) {
+    if(state != State::Run) {
+        return;
+    }
+    double timeInS = stimElapsedTimer.nsecsElapsed() / 1e9;
+    for(const auto& daq : eventDaqList) {
+        if(daq.getDaqListNr() == daqListNr && daq.getDirection() == DaqList::Direction::Stim) {
+            QByteArray payload = payloadStimData(daq, timeInS);
+            printMsgDebug("STIM", "DTO", payload);
+            udpXcp.writeDatagram(payload);
+            for(const auto& odtEntry : daq.getOdtEntries()) { // the stimulus is part of the measurement
+                double value = odtEntry->getStimGenerator()->valueAt(timeInS);
+                emit sigVariableValueUpdate(odtEntry->getSignalId(), (int64_t) rawValue(odtEntry, value));
+            }
+            break;
+        }
+    }
+}
+
 /***************************************************************
 *  Uitility
 ****************************************************************/
@@ -1011,12 +1901,25 @@ uint8_t XcpTask::bitsToByte(const QBitArray bits) {
     uint8_t sum = 0;
     for(int i = 0; i < bits.size(); i++) {
         if(bits.at(i)) {
-            sum += std::pow(i,2);
+            sum |= (1 << i);
         }
     }
     return sum;
 }
 
+/**
+ * @brief payloadToUint32 reads 4 bytes from position first in the byte order of the slave.
+ */
+uint32_t XcpTask::payloadToUint32(const QByteArray& payload, const int first) {
+    bool isLittleEndian = (xcpClientConfig->getEndian() == XcpOptions::ENDIAN_LITTLE);
+    uint32_t value = 0;
+    for(int i = 0; i < 4; i++) {
+        uint8_t byte = (uint8_t) payload.at(isLittleEndian ? (first + 3 - i) : (first + i));
+        value = (value << 8) | byte;
+    }
+    return value;
+}
+
 bool XcpTask::isPayloadSizeValid(size_t validMinimumSize, size_t payloadSize) {
     bool isSizeValid = true;
     if(payloadSize < validMinimumSize) {
@@ -1037,10 +1940,162 @@ void XcpTask::printMsgDebug(const QString& msgType, const QString& cmd, const QB
 void XcpTask::resetXcpTask() {
     timerResponseTimeout->stop();
     timerTriggerSendNextCommandInQueue->stop();
+    timerOverloadEvaluation->stop();
+    timerMinSt->stop();
     timerPollingList.clear();
+    timerStimList.clear();
     clearCommandQueue();
     pollingList.clear();
     eventDaqList.clear();
+    checksumSegments.clear();
+    checksumBlocksPending.clear();
+    checksumBlockSizeMax = MAX_CHECKSUM_BLOCKSIZE;
+    isChecksumReadback = false;
+    checksumReadbacks.clear();
+    datasetElements.clear();
+    isCalPageSwitchActive = false;
+    calibrationMirror.clear();
+    calibrationMirrorStaged.clear();
+    uploadBytesReceived = 0;
+    daqOverloadController.clear();
+}
+
+void XcpTask::checksumSegmentVerified(const uint32_t startAddr, const bool isValid) {
+    QMap<uint32_t, ElfMemorySegment>::iterator it = checksumSegments.find(startAddr);
+    if(it == checksumSegments.end()) {
+        return;
+    }
+    if(isValid && it->getIsWritable()) { // the slave memory is known now
+        if(isCalPageSwitchActive) { // written to the inactive page, the mirror follows with the page switch
+            DownloadRange range;
+            range.addr = (uint32_t) it->getAddr();
+            range.data = it->getData();
+            calibrationMirrorStaged.push_back(range);
+        } else {
+            calibrationMirror.update((uint32_t) it->getAddr(), it->getData().data(), it->getSize());
+        }
+    }
+    checksumSegments.erase(it);
+    checksumBlocksPending.remove(startAddr);
+    isChecksumValid = isChecksumValid && isValid;
+
+    if(!datasetElements.isEmpty()) { // verification of a calibration dataset
+        if(!isValid) {
+            emit sigPrintMessage("Calibration dataset verification failed.", true);
+            checksumSegments.clear();
+            checksumBlocksPending.clear();
+            checksumReadbacks.clear();
+            datasetElements.clear();
+            if(isCalPageSwitchActive) {
+                calPageSwitchAbort();
+            }
+        } else if(checksumSegments.isEmpty()) {
+            emit sigPrintMessage("Calibration dataset verified.", false);
+            if(!isCalPageSwitchActive) { // otherwise the dataset is applied with the acknowledged SET_CAL_PAGE
+                calibrationDatasetApplied();
+            }
+        }
+        return;
+    }
+
+    if(checksumSegments.isEmpty()) {
+        if(isChecksumValid) {
+            emit sigPrintMessage("Checksum verification passed: slave memory matches the ELF file.", false);
+        } else {
+            emit sigPrintMessage("Checksum verification failed: slave memory differs from the ELF file.", true);
+        }
+    }
+}
+
+/**
+ * A segment is valid once all of its blocks are valid, the first invalid block fails the segment.
+ */
+void XcpTask::checksumBlockVerified(const uint32_t blockAddr, const bool isValid) {
+    QMap<uint32_t, ElfMemorySegment>::iterator it = checksumSegmentOfBlock(blockAddr);
+    if(it == checksumSegments.end()) {
+        return; // the segment failed already
+    }
+    const uint32_t startAddr = it.key();
+    uint32_t& blocksPending = checksumBlocksPending[startAddr];
+    if(blocksPending > 0) {
+        blocksPending--;
+    }
+    if(!isValid || blocksPending == 0) {
+        checksumSegmentVerified(startAddr, isValid);
+    }
+}
+
+QMap<uint32_t, ElfMemorySegment>::iterator XcpTask::checksumSegmentOfBlock(const uint32_t blockAddr) {
+    QMap<uint32_t, ElfMemorySegment>::iterator it = checksumSegments.upperBound(blockAddr);
+    if(it == checksumSegments.begin()) {
+        return checksumSegments.end();
+    }
+    --it;
+    if((uint64_t) blockAddr >= (uint64_t) it.key() + it->getSize()) {
+        return checksumSegments.end();
+    }
+    return it;
+}
+
+/**
+ * @return false if the uploaded bytes do not belong to a readback, they are stored in the mirror then.
+ */
+bool XcpTask::checksumReadbackReceived(const uint32_t addr, const uint8_t* data, const uint32_t size) {
+    QMap<uint32_t, ChecksumReadback>::iterator it = checksumReadbacks.upperBound(addr);
+    if(it == checksumReadbacks.begin()) {
+        return false;
+    }
+    --it;
+    if((uint64_t) addr != (uint64_t) it.key() + it->data.size() || (uint32_t) it->data.size() >= it->size) {
+        return false; // not the next bytes of this readback
+    }
+    it->data.append(reinterpret_cast<const char*>(data), std::min(size, it->size - (uint32_t) it->data.size()));
+    if((uint32_t) it->data.size() < it->size) {
+        return true;
+    }
+
+    const uint32_t blockAddr = it.key();
+    const QByteArray readback = it->data;
+    checksumReadbacks.erase(it);
+    QMap<uint32_t, ElfMemorySegment>::iterator segment = checksumSegmentOfBlock(blockAddr);
+    if(segment == checksumSegments.end()) {
+        return true; // the segment failed already
+    }
+    const uint8_t* expected = segment->getData().data() + (blockAddr - segment.key());
+    bool isValid = (std::memcmp(readback.constData(), expected, readback.size()) == 0);
+    if(!isValid) {
+        emit sigPrintMessage("Readback mismatch in segment " + QString::fromStdString(segment->getName())
+                             + " (0x" + QString::number(blockAddr, 16).toUpper() + ", " + QString::number(readback.size()) + " bytes)", true);
+    }
+    checksumBlockVerified(blockAddr, isValid);
+    return true;
+}
+
+void XcpTask::checksumReadbackFailed(const uint32_t addr) {
+    QMap<uint32_t, ChecksumReadback>::iterator it = checksumReadbacks.upperBound(addr);
+    if(it == checksumReadbacks.begin()) {
+        return;
+    }
+    --it;
+    if((uint64_t) addr >= (uint64_t) it.key() + it->size) {
+        return; // not a readback
+    }
+    const uint32_t blockAddr = it.key();
+    checksumReadbacks.erase(it);
+    checksumBlockVerified(blockAddr, false);
+}
+
+/**
+ * The slave runs with the new dataset. Parameters of a failed dataset, or changed in the meantime, stay pending for the next dataset.
+ */
+void XcpTask::calibrationDatasetApplied() {
+    for(const auto& element : datasetElements) {
+        if(rawValueToSet(element.first) == element.second) {
+            element.first->setIsCalibrationPending(false);
+        }
+        emit sigVariableValueUpdate(element.first->getSignalId(), (int64_t) element.second);
+    }
+    datasetElements.clear();
 }
 
 void XcpTask::setStateAndInformBackend(const State& newState) {
@@ -1054,12 +2109,7 @@ void XcpTask::slotCalibration(int recordElementsIndex) {
         shared_ptr<ParseResultBase> parseResult = recordElement->getParseResult();
 
         CommandPayload setMta = payloadSetMta((uint32_t) parseResult->getAddress());
-        CommandPayload download;
-        if(recordElement->getIsFloat()) {
-            download = payloadDownload(parseResult->getSize(), (uint32_t) recordElement->getValueToSetFloat()); //@TODO hanlde floats
-        } else {
-            download = payloadDownload(parseResult->getSize(), (uint32_t) recordElement->getValueToSetInt());
-        }
+        CommandPayload download = payloadDownloadRecordElement(recordElement);
         CommandPayload shortUpload = payloadShortUploadRecordElement(recordElement);
 
         addToCommandQueue(setMta);
@@ -1071,6 +2121,96 @@ void XcpTask::slotCalibration(int recordElementsIndex) {
     }
 }
 
+void XcpTask::slotVerifyChecksum() {
+    if(state == State::Disconnected || state == State::Error) {
+        emit sigPrintMessage("Checksum verification not possible: not connected.", true);
+        return;
+    }
+    if(!checksumSegments.isEmpty() || isCalPageSwitchActive) {
+        emit sigPrintMessage("Checksum verification or calibration dataset already in progress.", true);
+        return;
+    }
 
+    ElfParser elfParser(model->getFilesElfFile().toStdString());
+    try {
+        elfParser.parseMemorySegments();
+    } catch (const std::exception& e) {
+        emit sigPrintMessage("Checksum verification: can not read ELF file. " + QString(e.what()), true);
+        return;
+    }
 
+    isChecksumValid = true;
+    for(const auto& segment : elfParser.getMemorySegments()) {
+        checksumSegments.insert((uint32_t) segment.getAddr(), segment);
+    }
+    if(checksumSegments.isEmpty()) {
+        emit sigPrintMessage("Checksum verification: ELF file contains no loadable sections.", true);
+        return;
+    }
+    for(const auto& segment : checksumSegments) {
+        requestChecksumFromSlave((uint32_t) segment.getAddr(), segment.getSize());
+    }
+}
 
+void XcpTask::slotCalibrationDataset() {
+    if(state == State::Disconnected || state == State::Error) {
+        emit sigPrintMessage("Connect to slave before calibrating.", true);
+        return;
+    }
+    if(isCalPageSwitchActive || !checksumSegments.isEmpty()) {
+        emit sigPrintMessage("Calibration dataset or checksum verification already in progress.", true);
+        return;
+    }
+
+    QList<std::shared_ptr<RecordElement>> dataset;
+    std::vector<DownloadRange> writes;
+    for(const auto& recordElement : model->getRecordElements()) {
+        if(recordElement->getIsCalibrationPending()) {
+            dataset.append(recordElement);
+            writes.push_back(downloadRangeRecordElement(recordElement));
+        }
+    }
+    if(dataset.isEmpty()) {
+        emit sigPrintMessage("Calibration dataset is empty.", false);
+        return;
+    }
+    // only bytes which differ from the mirror are downloaded. Small unchanged gaps are sent along,
+    // as long as they are cheaper than the SET_MTA, DOWNLOAD and BUILD_CHECKSUM round trips of a separate range.
+    const uint32_t maxGap = 3 * (xcpClientConfig->getMaxCto() - XCP_DOWNLOAD_MAX::MASTER_BYTE_ALIGNMENT_ELEMENT_1);
+    std::vector<DownloadRange> ranges = calibrationMirror.diff(DownloadPlanner::mergeRanges(writes), maxGap);
+    if(ranges.empty()) {
+        for(const auto& recordElement : dataset) {
+            recordElement->setIsCalibrationPending(false);
+        }
+        emit sigPrintMessage("Calibration dataset matches the slave memory. Nothing to download.", false);
+        return;
+    }
+    datasetElements.clear();
+    for(const auto& recordElement : dataset) {
+        datasetElements.append(qMakePair(recordElement, rawValueToSet(recordElement)));
+    }
+
+    bool isPagingSupported = xcpClientConfig->getIsSupported().calibrationPaging;
+    if(isPagingSupported) {
+        // the slaves application keeps running on the active page while the inactive page is written
+        uint8_t calPageActive = xcpClientConfig->getCalPageActive();
+        uint8_t calPageInactive = (calPageActive == 0) ? 1 : 0;
+        isCalPageSwitchActive = true;
+        addToCommandQueue(payloadCopyCalPage(calPageActive, calPageInactive), false);
+        addToCommandQueue(payloadSetCalPage(XCP_SET_CAL_PAGE::MODE_XCP, calPageInactive), false);
+        for(const auto& range : ranges) {
+            addBulkDownloadToCommandQueue(range);
+        }
+        addDownloadVerificationToCommandQueue(ranges); // before the switch: a checksum mismatch aborts the dataset
+        addToCommandQueue(payloadSetCalPage(XCP_SET_CAL_PAGE::MODE_ECU | XCP_SET_CAL_PAGE::MODE_XCP, calPageInactive), false);
+    } else {
+        emit sigPrintMessage("Slave does not support calibration paging. Dataset is written to the working page.", false);
+        for(const auto& range : ranges) {
+            addBulkDownloadToCommandQueue(range);
+        }
+        addDownloadVerificationToCommandQueue(ranges);
+    }
+    emit sigPrintMessage("Calibration dataset: " + QString::number(dataset.size()) + " parameters in "
+                         + QString::number(ranges.size()) + " memory ranges.", false);
+    sendNextCommandInQueue();
+}
@@ -13,6 +13,10 @@
 #include "xcpprotocoldefinitions.h"
 #include "commandPayload.h"
 #include "daqList.h"
+#include "downloadPlanner.h"
+#include "calibrationMirror.h"
+#include "daqOverloadController.h"
+#include "parser/elfMemorySegment.h"
 
 #include <memory>
 #include <map>
@@ -22,7 +26,9 @@
 #include <QTimer>
 #include <QMap>
 #include <QList>
+#include <QPair>
 #include <QMutex>
+#include <QElapsedTimer>
 
 class XcpTask : public QObject {
 
@@ -41,9 +47,11 @@ class XcpTask : public QObject {
     void slotRecordStop();
     void slotResponseReceived(const QByteArray xcpPacket);
     void slotCalibration(int recordElementsIndex);
+    void slotVerifyChecksum();
+    void slotCalibrationDataset();
 
   signals:
-    void sigVariableValueUpdate(uint64_t id, int64_t value);
+    void sigVariableValueUpdate(uint32_t signalId, int64_t value);
     void sigStateChange(XcpTask::State newState);
     void sigPrintMessage(QString msg, bool isError);
 
@@ -55,7 +63,8 @@ class XcpTask : public QObject {
     bool isChecksumValid;
 
     //polling
-    std::map<uint64_t, CommandPayload> pollingList;
+    static const int MAX_QUEUE_SIZE = 100;
+    std::map<uint64_t, CommandPayload> pollingList; // key: signal id
     QQueue<CommandPayload> commandQueue;
     CommandPayload lastCommandRequest;
     bool isSendingPossible;
@@ -63,10 +72,45 @@ class XcpTask : public QObject {
     QMutex mutexCommandQueue;
     QSharedPointer<QTimer> timerResponseTimeout;
     QSharedPointer<QTimer> timerTriggerSendNextCommandInQueue;
+    QSharedPointer<QTimer> timerMinSt; // master block mode: separation time between two packets of a block
     QMap<uint64_t, QSharedPointer<QTimer>> timerPollingList;
 
-    //event (DAQ)
-    QMap<uint16_t, DaqList> eventDaqList;
+    //event (DAQ and STIM), key: event channel | direction << 16
+    QMap<uint32_t, DaqList> eventDaqList;
+
+    //stimulation: one timer per STIM list, key is the DAQ list number
+    QMap<uint16_t, QSharedPointer<QTimer>> timerStimList;
+    QElapsedTimer stimElapsedTimer;
+
+    //DAQ overload: counted per DAQ list, evaluated once per window
+    static const int OVERLOAD_EVALUATION_WINDOW_MS = 1000;
+    DaqOverloadController daqOverloadController;
+    QSharedPointer<QTimer> timerOverloadEvaluation;
+
+    //checksum: ELF memory segments waiting for the slaves BUILD_CHECKSUM response, key is the start address
+    //a segment is checked in blocks of at most checksumBlockSizeMax bytes, the slave reports its limit with ERR_OUT_OF_RANGE
+    static const uint32_t MAX_CHECKSUM_BLOCKSIZE = 0x10000;
+    static const uint32_t CHECKSUM_ALIGNMENT = 4; // element size of ADD_44, also fits ADD_22 and ADD_24
+    QMap<uint32_t, ElfMemorySegment> checksumSegments;
+    QMap<uint32_t, uint32_t> checksumBlocksPending; // key: segment start address, value: blocks without response
+    uint32_t checksumBlockSizeMax;
+
+    //checksum readback: blocks the slave can not checksum (no BUILD_CHECKSUM, unknown type) are compared after an UPLOAD
+    struct ChecksumReadback {
+        uint32_t size;
+        QByteArray data;
+    };
+    bool isChecksumReadback; // the slave does not know BUILD_CHECKSUM
+    QMap<uint32_t, ChecksumReadback> checksumReadbacks; // key: block address
+
+    //calibration page switching: a dataset is written to the inactive page and activated at once
+    bool isCalPageSwitchActive;
+    QList<QPair<std::shared_ptr<RecordElement>, uint32_t>> datasetElements; // dataset waiting for its verification and page switch, with the raw value sent
+
+    //differential calibration: image of the slaves calibration memory
+    CalibrationMirror calibrationMirror;
+    std::vector<DownloadRange> calibrationMirrorStaged; // verified ranges on the inactive page, applied once the slave switched to it
+    uint32_t uploadBytesReceived; // > 0 while the slave sends an UPLOAD in slave block mode
 
   private:
     /***************************************************************
@@ -76,16 +120,47 @@ class XcpTask : public QObject {
     CommandPayload payloadConnect();
     CommandPayload payloadDisconnect();
     CommandPayload payloadGetStatus();
+    CommandPayload payloadGetCommModeInfo();
+    CommandPayload payloadGetDaqProcessorInfo();
     CommandPayload payloadShortUploadRecordElement(const std::shared_ptr<RecordElement> recordElement);
     CommandPayload payloadShortUpload(const uint32_t addr,const uint8_t dataElements,const uint8_t addrExtension = 0);
     CommandPayload payloadSetMta(const uint32_t addr,const uint8_t addrExtension = 0);
+    CommandPayload payloadUpload(const uint8_t dataElements, const uint32_t addr);
     CommandPayload payloadDownload(const uint8_t dataElements, const uint32_t data,const bool isByteAligned = true);
-    CommandPayload payloadBuildChecksum(const uint32_t blockSize);
+    CommandPayload payloadDownloadRecordElement(const std::shared_ptr<RecordElement> recordElement);
+    CommandPayload payloadDownloadBytes(const uint8_t dataElements, const QByteArray& data);
+    CommandPayload payloadDownloadNext(const uint8_t remainingElements, const QByteArray& data);
+    CommandPayload payloadDownloadMax(const QByteArray& data);
+    CommandPayload payloadBuildChecksum(const uint32_t blockSize, const uint32_t startAddr);
     void addRecordElementsToPollingOrEventDaqList();
     void addRecordElementsToPollingList(const std::shared_ptr<RecordElement> recordElement);
-    void addRecordElementsToEventDaqList(const std::shared_ptr<RecordElement> recordElement);
+    void addRecordElementsToEventDaqList(const std::shared_ptr<RecordElement> recordElement, const DaqList::Direction direction = DaqList::Direction::Daq);
     void updatePollingListValuesFromSlave();
     void requestChecksumFromSlave(const uint32_t startAddr, const uint32_t size);
+    QList<CommandPayload> checksumBlockCommands(const uint32_t startAddr, const uint32_t size, uint32_t& blocks);
+    QList<CommandPayload> checksumReadbackCommands(const uint32_t blockAddr, const uint32_t blockSize);
+    QList<CommandPayload> uploadCommands(const uint32_t addr, const uint32_t size);
+    void repeatChecksumBlock(const uint32_t blockAddr, const uint32_t blockSize, const bool isReadback);
+
+    /***************************************************************
+    *  Bulk download
+    ****************************************************************/
+    uint32_t rawValueToSet(const std::shared_ptr<RecordElement> recordElement);
+    uint32_t rawValue(const std::shared_ptr<RecordElement> recordElement, const double value);
+    std::vector<uint8_t> rawValueToBytes(const uint32_t raw, const uint32_t size);
+    DownloadRange downloadRangeRecordElement(const std::shared_ptr<RecordElement> recordElement);
+    void addBulkDownloadToCommandQueue(const DownloadRange& range);
+    void addDownloadVerificationToCommandQueue(const std::vector<DownloadRange>& ranges);
+    void addMirrorUploadToCommandQueue();
+
+    /***************************************************************
+    *  Calibration page switching
+    ****************************************************************/
+    CommandPayload payloadSetCalPage(const uint8_t mode, const uint8_t page, const uint8_t segment = 0);
+    CommandPayload payloadGetCalPage(const uint8_t mode, const uint8_t segment = 0);
+    CommandPayload payloadCopyCalPage(const uint8_t srcPage, const uint8_t destPage, const uint8_t srcSegment = 0, const uint8_t destSegment = 0);
+    void calPageSwitchAbort();
+    bool isCalPageSwitchCommand(const uint8_t cmd) const;
 
     /***************************************************************
     *  Data acquisition
@@ -96,12 +171,21 @@ class XcpTask : public QObject {
     CommandPayload payloadAllocOdtEntry(const uint16_t daqListNr, const uint8_t odtEntriesCount);
     CommandPayload payloadSetDaqPtr(const uint16_t daqListNr);
     CommandPayload payloadWriteDaq(const uint32_t addr,const uint8_t size,const uint8_t addrExtension = 0);
-    CommandPayload payloadSetDaqListMode(const uint16_t daqListNr, const uint16_t eventChannel);
-    CommandPayload payloadStartStopDaqList(const uint16_t daqListNr);
+    CommandPayload payloadSetDaqListMode(const uint16_t daqListNr, const uint16_t eventChannel, const bool isStim = false, const uint8_t prescaler = 1);
+    CommandPayload payloadStartStopDaqList(const uint16_t daqListNr, const uint8_t mode = XCP_START_STOP_DAQ_LIST::MODE_SELECT);
     CommandPayload payloadStartStopSynch(const bool doStart);
     void daqDynamicConfig();
     void daqStartSelected();
     void daqStopAll();
+    void daqRemoveStimIfNotSupported();
+    bool daqChangePrescaler(const uint16_t daqListNr, const uint8_t prescaler);
+    void daqListModeResponse(const CommandPayload& setDaqListMode, const bool isAccepted);
+
+    /***************************************************************
+    *  Stimulation (STIM)
+    ****************************************************************/
+    QByteArray payloadStimData(const DaqList& daq, const double timeInS);
+    void stimStart();
 
     /***************************************************************
     *  Response from client
@@ -110,16 +194,26 @@ class XcpTask : public QObject {
     void responseProcessNegative(const QByteArray& responsePayload);
     bool responseConnect(const QByteArray& payload);
     bool responseGetStatus(const QByteArray& payload);
-    bool responseShortUpload(const QByteArray& payload, const uint64_t id, const int sizeDatatype);
+    bool responseGetCommModeInfo(const QByteArray& payload);
+    bool responseGetDaqProcessorInfo(const QByteArray& payload);
+    bool responseShortUpload(const QByteArray& payload, const uint64_t id, const int sizeDatatype, const uint32_t signalId);
     bool responseSetMta(const QByteArray& payload);
+    bool responseUpload(const QByteArray& payload, const CommandPayload& lastCmdSend);
     bool responseDownload(const QByteArray& payload);
-    bool responseBuildChecksum(const QByteArray& payload);
+    bool responseBuildChecksum(const QByteArray& payload, const uint32_t blockAddr, const uint32_t blockSize);
+    bool responseBuildChecksumNegative(const QByteArray& payload, const CommandPayload& buildChecksum);
+    bool responseSetCalPage(const QByteArray& payload, const QByteArray& requestPayload);
+    bool responseGetCalPage(const QByteArray& payload);
+    bool responseCopyCalPage(const QByteArray& payload);
     void responseProcessDaq(const QByteArray& payload);
+    void responseProcessEvent(const QByteArray& payload);
+    void responseProcessServiceRequest(const QByteArray& payload);
 
     /***************************************************************
     *  send command queue
     ****************************************************************/
-    void addToCommandQueue(const CommandPayload& cmdPayload);
+    void addToCommandQueue(const CommandPayload& cmdPayload, const bool isSizeLimited = true);
+    void addToHeadOfCommandQueue(const QList<CommandPayload>& cmdPayloads);
     void sendNextCommandInQueue();
     CommandPayload  removeHeadOfCommandQueue();
     void clearCommandQueue();
@@ -128,13 +222,19 @@ class XcpTask : public QObject {
     *  Timer
     ****************************************************************/
     void startTimerAddQueuePollingCommand(const uint64_t key,const int msec);
+    void startTimerStim(const uint16_t daqListNr, const int msec);
     void createTimerResponseTimeout();
     void createTimerTriggerSendNextCommandInQueue();
+    void createTimerOverloadEvaluation();
+    void createTimerMinSt();
 
   private slots:
     void slotPollingForRecordElementTimer(uint64_t key);
     void slotResponseTimeout();
     void slotTriggerSendNextCommandInQueue();
+    void slotStimForDaqListTimer(uint16_t daqListNr);
+    void slotOverloadEvaluation();
+    void slotMinStElapsed();
 
     /***************************************************************
     *  Uitility
@@ -143,9 +243,16 @@ class XcpTask : public QObject {
     void setStateAndInformBackend(const State& newState);
     QBitArray byteToBits(uint8_t byte);
     uint8_t bitsToByte(const QBitArray bits);
+    uint32_t payloadToUint32(const QByteArray& payload, const int first);
     bool isPayloadSizeValid(size_t validSize, size_t payloadSize);
     void printMsgDebug(const QString& msgType, const QString& cmd, const QByteArray& packet);
     void resetXcpTask();
+    void checksumSegmentVerified(const uint32_t startAddr, const bool isValid);
+    void checksumBlockVerified(const uint32_t blockAddr, const bool isValid);
+    void calibrationDatasetApplied();
+    QMap<uint32_t, ElfMemorySegment>::iterator checksumSegmentOfBlock(const uint32_t blockAddr);
+    bool checksumReadbackReceived(const uint32_t addr, const uint8_t* data, const uint32_t size);
+    void checksumReadbackFailed(const uint32_t addr);
 };
 
 #endif // XCPTASK_H
@@ -17,9 +17,12 @@ XcpClientConfig::XcpClientConfig() {
     daqMode = XcpOptions::DAQ_MODE_DYNAMIC;
     sessionStatus = {false};
     resourceProtectStatus = {false};
+    commModeInfo = {};
+    daqProcessorInfo = {};
     stateNum = 0;
     sessionConfigId = 0;
     synchErrorCode = 0;
+    calPageActive = 0;
 }
 
 XcpOptions::VERSION XcpClientConfig::getVersion() const {
@@ -117,3 +120,27 @@ XcpClientConfig::ResourceProtectStatus XcpClientConfig::getResourceProtectStatus
 void XcpClientConfig::setResourceProtectStatus(const XcpClientConfig::ResourceProtectStatus &value) {
     resourceProtectStatus = value;
 }
+
+uint8_t XcpClientConfig::getCalPageActive() const {
+    return calPageActive;
+}
+
+void XcpClientConfig::setCalPageActive(const uint8_t &value) {
+    calPageActive = value;
+}
+
+XcpClientConfig::CommModeInfo XcpClientConfig::getCommModeInfo() const {
+    return commModeInfo;
+}
+
+void XcpClientConfig::setCommModeInfo(const XcpClientConfig::CommModeInfo &value) {
+    commModeInfo = value;
+}
+
+XcpClientConfig::DaqProcessorInfo XcpClientConfig::getDaqProcessorInfo() const {
+    return daqProcessorInfo;
+}
+
+void XcpClientConfig::setDaqProcessorInfo(const XcpClientConfig::DaqProcessorInfo &value) {
+    daqProcessorInfo = value;
+}
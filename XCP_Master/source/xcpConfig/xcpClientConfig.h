@@ -36,6 +36,23 @@ class XcpClientConfig {
         bool pgm;
     };
 
+    struct CommModeInfo {
+        bool masterBlockMode;
+        bool interleavedMode;
+        uint8_t maxBs;      // maximum number of packets in one master block
+        uint8_t minSt;      // minimum separation time between block packets in units of 100 us
+        uint8_t queueSize;
+    };
+
+    struct DaqProcessorInfo {
+        bool prescalerSupported;
+        bool overloadMsb;   // the slave indicates an overload with the MSB of the DTO PID
+        bool overloadEvent; // the slave indicates an overload with EV_DAQ_OVERLOAD
+        uint16_t maxDaq;
+        uint16_t maxEventChannel;
+        uint8_t minDaq;
+    };
+
   public:
     XcpClientConfig();
 
@@ -79,6 +96,15 @@ class XcpClientConfig {
     ResourceProtectStatus getResourceProtectStatus() const;
     void setResourceProtectStatus(const ResourceProtectStatus &value);
 
+    uint8_t getCalPageActive() const;
+    void setCalPageActive(const uint8_t &value);
+
+    CommModeInfo getCommModeInfo() const;
+    void setCommModeInfo(const CommModeInfo &value);
+
+    DaqProcessorInfo getDaqProcessorInfo() const;
+    void setDaqProcessorInfo(const DaqProcessorInfo &value);
+
   private:
     XcpOptions::VERSION version;
     XcpOptions::ENDIAN endian;
@@ -90,11 +116,15 @@ class XcpClientConfig {
     IsSupported isSupported;
     SessionStatus sessionStatus;
     ResourceProtectStatus resourceProtectStatus;
+    CommModeInfo commModeInfo;
+    DaqProcessorInfo daqProcessorInfo;
 
     uint8_t stateNum;
     uint16_t sessionConfigId;
 
     uint8_t synchErrorCode;
+
+    uint8_t calPageActive; // page the slave's application uses for calibration segment 0
 };
 
 #endif // XCPCLIENTCONFIG_H
@@ -24,7 +24,8 @@ XcpHostConfig::XcpHostConfig(XcpOptions::VERSION version,
       maxCto(maxCto),
       maxDto(maxDto),
       daqMode(daqMode),
-      events(events) {
+      events(events),
+      isOverloadControlEnabled(false) {
 
 }
 
@@ -113,6 +114,14 @@ void XcpHostConfig::removeAllEvents() {
     events.clear();
 }
 
+bool XcpHostConfig::getIsOverloadControlEnabled() const {
+    return isOverloadControlEnabled;
+}
+
+void XcpHostConfig::setIsOverloadControlEnabled(bool value) {
+    isOverloadControlEnabled = value;
+}
+
 
 void XcpHostConfig::write(QTextStream &stream) {
     writeProtocolLayer(stream);
@@ -54,6 +54,9 @@ class XcpHostConfig {
     bool removeEvent(const QString& eventName);
     void removeAllEvents();
 
+    bool getIsOverloadControlEnabled() const;
+    void setIsOverloadControlEnabled(bool value);
+
     void write(QTextStream& stream);
 
   private:
@@ -69,7 +72,7 @@ class XcpHostConfig {
     int maxCto;
     int maxDto;
     QVector<XcpEvent> events;
-
+    bool isOverloadControlEnabled; // adapt the DAQ prescalers if the slave reports an overload
 
 };
 